@@ -3,7 +3,10 @@
 #include <algorithm>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <queue>
+#include <unordered_set>
+#include <utility>
 
 #include <glm/gtc/matrix_transform.hpp>
 
@@ -16,6 +19,53 @@ Geometry::~Geometry() {
     }
 }
 
+void Geometry::upload() {
+    if (isUploaded()) {
+        return;
+    }
+
+    dbuff.setFaceType(facetype == Geometry::Triangles ? GL_TRIANGLES
+                                                      : GL_TRIANGLE_STRIP);
+    gbuff.uploadVertices(vertices);
+    dbuff.addGeometry(&gbuff);
+
+    // The element buffer binding is recorded in the VAO bound above
+    glGenBuffers(1, &EBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+
+    size_t icount = std::accumulate(
+        subgeom.begin(), subgeom.end(), size_t{0u},
+        [](size_t a, const SubGeometry& b) { return a + b.numIndices; });
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * icount, nullptr,
+                 GL_STATIC_DRAW);
+    for (auto& sg : subgeom) {
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sg.start * sizeof(uint32_t),
+                        sizeof(uint32_t) * sg.numIndices, sg.indices.data());
+    }
+
+    vertices.clear();
+    vertices.shrink_to_fit();
+}
+
+std::size_t Geometry::getCPUSize() const {
+    std::size_t size = vertices.capacity() * sizeof(GeometryVertex);
+    for (const auto& sg : subgeom) {
+        size += sg.indices.capacity() * sizeof(uint32_t);
+    }
+    return size;
+}
+
+std::size_t Geometry::getGPUSize() const {
+    if (!isUploaded()) {
+        return 0;
+    }
+    size_t icount = std::accumulate(
+        subgeom.begin(), subgeom.end(), size_t{0u},
+        [](size_t a, const SubGeometry& b) { return a + b.numIndices; });
+    return static_cast<std::size_t>(gbuff.getCount()) * sizeof(GeometryVertex) +
+           icount * sizeof(uint32_t);
+}
+
 ModelFrame::ModelFrame(unsigned int index, glm::mat3 dR, glm::vec3 dT)
     : index(index)
     , defaultRotation(dR)
@@ -100,6 +150,61 @@ ModelFrame* Clump::findFrame(const std::string& name) const {
 
 Clump::~Clump() = default;
 
+void Clump::buildPose() const {
+    if (!pose_.frames.empty() || !rootframe_) {
+        return;
+    }
+
+    // Depth first in the same order as findFrame(), which also places
+    // every parent before its children
+    std::vector<std::pair<ModelFrame*, int32_t>> open;
+    open.emplace_back(rootframe_.get(), -1);
+    while (!open.empty()) {
+        auto [frame, parent] = open.back();
+        open.pop_back();
+
+        auto index = static_cast<int32_t>(pose_.frames.size());
+        pose_.frames.push_back(frame);
+        pose_.parents.push_back(parent);
+        // Keep the first frame with each name
+        pose_.indices.emplace(frame->getName(), index);
+
+        const auto& children = frame->getChildren();
+        for (auto it = children.rbegin(); it != children.rend(); ++it) {
+            open.emplace_back(it->get(), index);
+        }
+    }
+
+    pose_.world.resize(pose_.frames.size());
+}
+
+int32_t Clump::findPoseIndex(const std::string& name) const {
+    buildPose();
+    auto it = pose_.indices.find(name);
+    return it != pose_.indices.end() ? it->second : -1;
+}
+
+void Clump::updatePose() {
+    buildPose();
+    const auto count = pose_.frames.size();
+    if (count == 0) {
+        return;
+    }
+
+    const auto root = pose_.frames[0];
+    pose_.world[0] = root->parent_
+                         ? root->parent_->getWorldTransform() * root->matrix
+                         : root->matrix;
+    for (auto i = 1u; i < count; ++i) {
+        pose_.world[i] =
+            pose_.world[pose_.parents[i]] * pose_.frames[i]->matrix;
+    }
+
+    for (auto i = 0u; i < count; ++i) {
+        pose_.frames[i]->worldtransform_ = pose_.world[i];
+    }
+}
+
 void Clump::recalculateMetrics() {
     boundingRadius = std::numeric_limits<float>::min();
     for (const auto& atomic : atomics_) {
@@ -150,3 +255,36 @@ ClumpPtr Clump::clone() const {
 
     return clump;
 }
+
+std::size_t Clump::getCPUSize() const {
+    std::unordered_set<const Geometry*> counted;
+    std::size_t size = 0;
+    for (const auto& atomic : getAtomics()) {
+        const auto& geometry = atomic->getGeometry();
+        if (geometry && counted.insert(geometry.get()).second) {
+            size += geometry->getCPUSize();
+        }
+    }
+    return size;
+}
+
+std::size_t Clump::getGPUSize() const {
+    std::unordered_set<const Geometry*> counted;
+    std::size_t size = 0;
+    for (const auto& atomic : getAtomics()) {
+        const auto& geometry = atomic->getGeometry();
+        if (geometry && counted.insert(geometry.get()).second) {
+            size += geometry->getGPUSize();
+        }
+    }
+    return size;
+}
+
+void Clump::upload() const {
+    for (const auto& atomic : getAtomics()) {
+        const auto& geometry = atomic->getGeometry();
+        if (geometry) {
+            geometry->upload();
+        }
+    }
+}
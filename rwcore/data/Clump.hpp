@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <gl/DrawBuffer.hpp>
@@ -26,6 +27,8 @@ class ModelFrame {
     std::string name;
     std::vector<ModelFramePtr> children_;
 
+    friend class Clump;
+
 public:
     ModelFrame(unsigned int index = 0, glm::mat3 dR = glm::mat3{1.0f},
                glm::vec3 dT = glm::vec3());
@@ -183,8 +186,32 @@ struct Geometry {
     std::vector<Material> materials;
     std::vector<SubGeometry> subgeom;
 
+    /// Decoded vertex data, released once uploaded
+    std::vector<GeometryVertex> vertices;
+
     Geometry();
     ~Geometry();
+
+    /**
+     * Creates the GL buffers for the decoded vertices and sub geometry
+     * indices. Must be called on the thread owning the GL context.
+     */
+    void upload();
+
+    bool isUploaded() const {
+        return gbuff.getVBOName() != 0;
+    }
+
+    /**
+     * @return Approximate size of the vertex and index data kept in main
+     * memory, in bytes
+     */
+    std::size_t getCPUSize() const;
+
+    /**
+     * @return Size of the GL buffers created by upload(), in bytes
+     */
+    std::size_t getGPUSize() const;
 };
 
 /**
@@ -267,6 +294,7 @@ public:
 
     void setFrame(const ModelFramePtr& root) {
         rootframe_ = root;
+        pose_ = {};
     }
 
     const ModelFramePtr& getFrame() const {
@@ -278,10 +306,72 @@ public:
      */
     ClumpPtr clone() const;
 
+    /**
+     * @return Every frame in the hierarchy, ordered so that each frame
+     * comes after its parent
+     *
+     * The order is built on first use after setFrame(), frames added to the
+     * hierarchy later are not included.
+     */
+    const std::vector<ModelFrame*>& getPoseFrames() const {
+        buildPose();
+        return pose_.frames;
+    }
+
+    /**
+     * @return The index of the frame with name in getPoseFrames(), or -1
+     */
+    int32_t findPoseIndex(const std::string& name) const;
+
+    /**
+     * Sets the transform of the frame at index without updating the
+     * hierarchy, which is done for all frames by updatePose()
+     */
+    void setPoseTransform(std::size_t index, const glm::mat4& m) {
+        buildPose();
+        pose_.frames[index]->matrix = m;
+    }
+
+    /**
+     * Updates the world transform of every frame in one pass, parents
+     * first
+     */
+    void updatePose();
+
+    /**
+     * Uploads the geometry of every atomic that has not been uploaded yet.
+     */
+    void upload() const;
+
+    /**
+     * @return Approximate size of the geometry kept in main memory, in
+     * bytes, counting geometry shared by several atomics once
+     */
+    std::size_t getCPUSize() const;
+
+    /**
+     * @return Size of the GL buffers used by the geometry, in bytes
+     */
+    std::size_t getGPUSize() const;
+
 private:
+    /**
+     * The frame hierarchy flattened into arrays
+     */
+    struct Pose {
+        std::vector<ModelFrame*> frames;
+        /// Index of each frame's parent, or -1 for the root
+        std::vector<int32_t> parents;
+        std::vector<glm::mat4> world;
+        std::unordered_map<std::string, int32_t> indices;
+    };
+
+    void buildPose() const;
+
     float boundingRadius;
     AtomicList atomics_;
     ModelFramePtr rootframe_;
+    mutable Pose pose_;
 };
 
 #endif
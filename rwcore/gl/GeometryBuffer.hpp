@@ -64,10 +64,13 @@ public:
      *
      * vertex_attributes() is assumed to exist so that vertex types
      * can implicitly declare the strides and offsets for their data.
+     *
+     * Use GL_STREAM_DRAW as the usage for data replaced every frame.
      */
     template <class T>
-    void uploadVertices(const std::vector<T>& data) {
-        uploadVertices(static_cast<GLsizei>(data.size()), data.size() * sizeof(T), data.data());
+    void uploadVertices(const std::vector<T>& data,
+                        GLenum usage = GL_STATIC_DRAW) {
+        uploadVertices(static_cast<GLsizei>(data.size()), data.size() * sizeof(T), data.data(), usage);
         // Assume T has a static method for attributes;
         attributes = T::vertex_attributes();
     }
@@ -75,7 +78,8 @@ public:
     /**
      * Uploads raw memory into the buffer.
      */
-    void uploadVertices(GLsizei num, GLsizeiptr size, const GLvoid* mem);
+    void uploadVertices(GLsizei num, GLsizeiptr size, const GLvoid* mem,
+                        GLenum usage = GL_STATIC_DRAW);
 
     const AttributeList& getDataAttributes() const {
         return attributes;
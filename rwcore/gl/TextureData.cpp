@@ -1 +1,21 @@
 #include "gl/TextureData.hpp"
+
+void TextureData::upload() {
+    if (!pending) {
+        return;
+    }
+
+    glGenTextures(1, &texName);
+    glBindTexture(GL_TEXTURE_2D, texName);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, pending->size.x, pending->size.y,
+                 0, pending->format, pending->type, pending->pixels.data());
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, pending->minFilter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, pending->magFilter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, pending->wrapS);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, pending->wrapT);
+
+    glGenerateMipmap(GL_TEXTURE_2D);
+
+    pending.reset();
+}
@@ -4,12 +4,35 @@
 #include <gl/gl_core_3_3.h>
 #include <glm/vec2.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
+
+/**
+ * Decoded texture pixels and sampler state, waiting to be uploaded.
+ *
+ * Filling one in does not require a GL context.
+ */
+struct TextureImage {
+    glm::ivec2 size{};
+    /// Format and component type of the pixels
+    GLenum format = GL_RGBA;
+    GLenum type = GL_UNSIGNED_BYTE;
+    GLint minFilter = GL_LINEAR_MIPMAP_LINEAR;
+    GLint magFilter = GL_LINEAR;
+    GLint wrapS = GL_REPEAT;
+    GLint wrapT = GL_REPEAT;
+    std::vector<std::uint8_t> pixels;
+};
 
 /**
  * Stores a handle and metadata about a loaded texture.
+ *
+ * A TextureData may be created from a decoded TextureImage, in which case
+ * it has no GL name until upload() is called.
  */
 class TextureData {
 public:
@@ -17,8 +40,17 @@ public:
         : texName(name), size(dims), hasAlpha(alpha) {
     }
 
+    TextureData(TextureImage&& image, bool alpha)
+        : texName(0)
+        , size(image.size)
+        , hasAlpha(alpha)
+        , pending(std::make_unique<TextureImage>(std::move(image))) {
+    }
+
     ~TextureData() {
-        glDeleteTextures(1, &texName);
+        if (texName) {
+            glDeleteTextures(1, &texName);
+        }
     }
 
     GLuint getName() const {
@@ -33,15 +65,59 @@ public:
         return hasAlpha;
     }
 
+    /**
+     * @return true if there is no decoded image waiting to be uploaded
+     */
+    bool isUploaded() const {
+        return pending == nullptr;
+    }
+
+    /**
+     * @return The decoded image waiting to be uploaded, nullptr once it has
+     * been uploaded
+     */
+    const TextureImage* getImage() const {
+        return pending.get();
+    }
+
+    /**
+     * Creates the GL texture from the decoded image and releases the
+     * image. Must be called on the thread owning the GL context.
+     */
+    void upload();
+
+    /**
+     * @return Size of the decoded image waiting to be uploaded, in bytes
+     */
+    std::size_t getCPUSize() const {
+        return pending ? pending->pixels.size() : 0;
+    }
+
+    /**
+     * @return Approximate size of the GL texture and its mipmaps, in bytes
+     */
+    std::size_t getGPUSize() const {
+        if (!texName) {
+            return 0;
+        }
+        // Textures are stored as RGBA8, and the mip chain adds a third
+        return static_cast<std::size_t>(size.x) * size.y * 4 * 4 / 3;
+    }
+
     static auto create(GLuint name, const glm::ivec2& size,
                          bool transparent) {
         return std::make_unique<TextureData>(name, size, transparent);
     }
 
+    static auto create(TextureImage&& image, bool transparent) {
+        return std::make_unique<TextureData>(std::move(image), transparent);
+    }
+
 private:
     GLuint texName;
     glm::ivec2 size;
     bool hasAlpha;
+    std::unique_ptr<TextureImage> pending;
 };
 using TextureArchive = std::unordered_map<std::string, std::unique_ptr<TextureData>>;
 
@@ -6,12 +6,10 @@
 #include <cstring>
 #include <cstdlib>
 #include <memory>
-#include <numeric>
 
 #include <glm/glm.hpp>
 
 #include "data/Clump.hpp"
-#include "gl/gl_core_3_3.h"
 #include "loaders/RWBinaryStream.hpp"
 #include "platform/FileHandle.hpp"
 #include "rw/debug.hpp"
@@ -57,16 +55,16 @@ LoaderDFF::FrameList LoaderDFF::readFrameList(const RWBStream &stream) {
         throw DFFLoaderException("Frame List missing struct chunk");
     }
 
-    char *headerPtr = listStream.getCursor();
+    const char *headerPtr = listStream.getCursor();
 
-    unsigned int numFrames = *reinterpret_cast<std::uint32_t *>(headerPtr);
+    unsigned int numFrames = *reinterpret_cast<const std::uint32_t *>(headerPtr);
     headerPtr += sizeof(std::uint32_t);
 
     FrameList framelist;
     framelist.reserve(numFrames);
 
     for (auto f = 0u; f < numFrames; ++f) {
-        auto data = reinterpret_cast<RWBSFrame *>(headerPtr);
+        auto data = reinterpret_cast<const RWBSFrame *>(headerPtr);
         headerPtr += sizeof(RWBSFrame);
         auto frame =
             std::make_shared<ModelFrame>(f, data->rotation, data->position);
@@ -123,7 +121,7 @@ LoaderDFF::GeometryList LoaderDFF::readGeometryList(const RWBStream &stream) {
         throw DFFLoaderException("Geometry List missing struct chunk");
     }
 
-    char *headerPtr = listStream.getCursor();
+    const char *headerPtr = listStream.getCursor();
 
     unsigned int numGeometries = bit_cast<std::uint32_t>(*headerPtr);
     headerPtr += sizeof(std::uint32_t);
@@ -155,7 +153,7 @@ GeometryPtr LoaderDFF::readGeometry(const RWBStream &stream) {
 
     auto geom = std::make_shared<Geometry>();
 
-    char *headerPtr = geomStream.getCursor();
+    const char *headerPtr = geomStream.getCursor();
 
     geom->flags = bit_cast<std::uint16_t>(*headerPtr);
     headerPtr += sizeof(std::uint16_t);
@@ -249,24 +247,7 @@ GeometryPtr LoaderDFF::readGeometry(const RWBStream &stream) {
         }
     }
 
-    geom->dbuff.setFaceType(geom->facetype == Geometry::Triangles
-                                ? GL_TRIANGLES
-                                : GL_TRIANGLE_STRIP);
-    geom->gbuff.uploadVertices(verts);
-    geom->dbuff.addGeometry(&geom->gbuff);
-
-    glGenBuffers(1, &geom->EBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geom->EBO);
-
-    size_t icount = std::accumulate(
-        geom->subgeom.begin(), geom->subgeom.end(), size_t{0u},
-        [](size_t a, const SubGeometry &b) { return a + b.numIndices; });
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * icount, nullptr,
-                 GL_STATIC_DRAW);
-    for (auto &sg : geom->subgeom) {
-        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, sg.start * sizeof(uint32_t),
-                        sizeof(uint32_t) * sg.numIndices, sg.indices.data());
-    }
+    geom->vertices = std::move(verts);
 
     return geom;
 }
@@ -303,7 +284,7 @@ void LoaderDFF::readMaterial(const GeometryPtr &geom, const RWBStream &stream) {
         throw DFFLoaderException("Material missing struct chunk");
     }
 
-    char *matData = materialStream.getCursor();
+    const char *matData = materialStream.getCursor();
 
     Geometry::Material material;
 
@@ -454,10 +435,18 @@ AtomicPtr LoaderDFF::readAtomic(FrameList &framelist,
     return atomic;
 }
 
-ClumpPtr LoaderDFF::loadFromMemory(const FileContentsInfo& file) {
+ClumpPtr LoaderDFF::loadFromMemory(const FileContentsView& file) {
+    auto model = decodeFromMemory(file);
+    if (model) {
+        model->upload();
+    }
+    return model;
+}
+
+ClumpPtr LoaderDFF::decodeFromMemory(const FileContentsView& file) {
     auto model = std::make_shared<Clump>();
 
-    RWBStream rootStream(file.data.get(), file.length);
+    RWBStream rootStream(file.data, file.length);
 
     auto rootID = rootStream.getNextChunk();
     if (rootID != CHUNK_CLUMP) {
@@ -30,7 +30,17 @@ public:
     using GeometryList = std::vector<GeometryPtr>;
     using FrameList = std::vector<ModelFramePtr>;
 
-    ClumpPtr loadFromMemory(const FileContentsInfo& file);
+    /**
+     * Decodes a DFF into a Clump, without creating any GL objects.
+     * This does not need a GL context and may run on any thread; call
+     * Clump::upload() on the result before rendering it.
+     */
+    ClumpPtr decodeFromMemory(const FileContentsView& file);
+
+    /**
+     * Decodes a DFF and uploads its geometry.
+     */
+    ClumpPtr loadFromMemory(const FileContentsView& file);
 
     void setTextureLookupCallback(const TextureLookupCallback& tlc) {
         textureLookup = tlc;
@@ -60,10 +60,10 @@ std::unique_ptr<char[]> LoaderIMG::loadToMemory(const std::string& assetname) {
 
     FILE* fp = fopen(imgName.string().c_str(), "rb");
     if (fp) {
-        auto raw_data = std::make_unique<char[]>(assetInfo.size * 2048);
+        auto raw_data = std::make_unique<char[]>(assetInfo.size * kIMGSectorSize);
 
-        fseek(fp, assetInfo.offset * 2048, SEEK_SET);
-        if (fread(raw_data.get(), 2048, assetInfo.size, fp) != assetInfo.size) {
+        fseek(fp, assetInfo.offset * kIMGSectorSize, SEEK_SET);
+        if (fread(raw_data.get(), kIMGSectorSize, assetInfo.size, fp) != assetInfo.size) {
             RW_ERROR("Error reading asset " << assetInfo.name);
         }
 
@@ -83,7 +83,7 @@ bool LoaderIMG::saveAsset(const std::string& assetname,
     if (dumpFile) {
         LoaderIMGFile asset;
         if (findAssetInfo(assetname, asset)) {
-            fwrite(raw_data.get(), 2048, asset.size, dumpFile);
+            fwrite(raw_data.get(), kIMGSectorSize, asset.size, dumpFile);
             printf("=> IMG: Saved %s to disk with filename %s\n",
                    assetname.c_str(), filename.c_str());
         }
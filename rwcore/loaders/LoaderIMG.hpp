@@ -8,6 +8,10 @@
 
 #include <rw/filesystem.hpp>
 
+/// Size in bytes of one sector of an IMG archive, offsets and sizes of the
+/// archived files are expressed in sectors.
+constexpr std::size_t kIMGSectorSize = 2048;
+
 /// \brief Points to one file within the archive
 class LoaderIMGFile {
 public:
@@ -54,6 +58,11 @@ public:
     /// Returns the number of asset files in the archive
     std::size_t getAssetCount() const;
 
+    /// Returns the path to the .img file holding the asset data
+    const rwfs::path& getArchivePath() const {
+        return m_archive;
+    }
+
     Version getVersion() const {
         return m_version;
     }
@@ -29,6 +29,10 @@ bool LoaderSDT::load(const rwfs::path& sdtPath, const rwfs::path& rawPath) {
 
         fclose(fp);
         m_archive = rawName;
+        if (!m_mapping.open(rawPath)) {
+            RW_ERROR("Error cannot map " << rawName);
+            return false;
+        }
         return true;
     } else {
         RW_ERROR("Error cannot open " << sdtName);
@@ -53,10 +57,7 @@ std::unique_ptr<char[]> LoaderSDT::loadToMemory(size_t index, bool asWave) {
         return nullptr;
     }
 
-    std::string rawName = m_archive;
-
-    FILE* fp = fopen(rawName.c_str(), "rb");
-    if (fp) {
+    if (m_mapping.isOpen()) {
         std::unique_ptr<char[]> raw_data;
         char* sample_data;
         if (asWave) {
@@ -83,12 +84,14 @@ std::unique_ptr<char[]> LoaderSDT::loadToMemory(size_t index, bool asWave) {
             sample_data = raw_data.get();
         }
 
-        fseek(fp, assetInfo.offset, SEEK_SET);
-        if (fread(sample_data, 1, assetInfo.size, fp) != assetInfo.size) {
+        if (assetInfo.offset + std::size_t{assetInfo.size} >
+            m_mapping.size()) {
             RW_ERROR("Error reading asset " << std::to_string(index));
+            return nullptr;
         }
+        std::memcpy(sample_data, m_mapping.data() + assetInfo.offset,
+                    assetInfo.size);
 
-        fclose(fp);
         return raw_data;
     } else
         return nullptr;
@@ -1,6 +1,7 @@
 #ifndef _LIBRW_LOADERSDT_HPP_
 #define _LIBRW_LOADERSDT_HPP_
 
+#include <platform/MappedFile.hpp>
 #include <rw/filesystem.hpp>
 
 #include <cstddef>
@@ -86,6 +87,7 @@ public:
 private:
     Version m_version{GTAIIIVC};      ///< Version of this SDT archive
     std::string m_archive;  ///< Path to the archive being used (no extension)
+    MappedFile m_mapping;   ///< Mapping of the raw audio archive
     std::vector<LoaderSDTFile> m_assets;  ///< Asset info of the archive
 };
 
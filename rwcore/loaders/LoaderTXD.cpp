@@ -22,38 +22,45 @@ constexpr GLuint gTextureBlue[] = {0xFFFF0000};
 
 static
 std::unique_ptr<TextureData> getErrorTexture() {
-    GLuint errTexName = 0;
-    std::unique_ptr<TextureData> tex = nullptr;
-    if (errTexName == 0) {
-        glGenTextures(1, &errTexName);
-        glBindTexture(GL_TEXTURE_2D, errTexName);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 2, 2, 0, GL_RGBA,
-                     GL_UNSIGNED_BYTE, gErrorTextureData);
-        glGenerateMipmap(GL_TEXTURE_2D);
-
-        tex = TextureData::create(errTexName, {2, 2}, false);
-    }
-    return tex;
+    TextureImage image;
+    image.size = {2, 2};
+    image.minFilter = GL_NEAREST_MIPMAP_LINEAR;
+    auto bytes = reinterpret_cast<const uint8_t*>(gErrorTextureData);
+    image.pixels.assign(bytes, bytes + sizeof(gErrorTextureData));
+    return TextureData::create(std::move(image), false);
 }
 
 const size_t paletteSize = 1024;
 
 static
 void processPalette(uint32_t* fullColor, RW::BinaryStreamSection& rootSection) {
-    uint8_t* dataBase = reinterpret_cast<uint8_t*>(
+    auto dataBase = reinterpret_cast<const uint8_t*>(
         rootSection.raw() + sizeof(RW::BSSectionHeader) +
         sizeof(RW::BSTextureNative) - 4);
 
-    uint8_t* coldata = (dataBase + paletteSize + sizeof(uint32_t));
-    uint32_t raster_size = *reinterpret_cast<uint32_t*>(dataBase + paletteSize);
-    uint32_t* palette = reinterpret_cast<uint32_t*>(dataBase);
+    const uint8_t* coldata = (dataBase + paletteSize + sizeof(uint32_t));
+    uint32_t raster_size =
+        *reinterpret_cast<const uint32_t*>(dataBase + paletteSize);
+    auto palette = reinterpret_cast<const uint32_t*>(dataBase);
 
     for (size_t j = 0; j < raster_size; ++j) {
         *(fullColor++) = palette[coldata[j]];
     }
 }
 
-static std::unique_ptr<TextureData> createTexture(
+static GLint getWrapMode(uint8_t wrap) {
+    switch (wrap) {
+        default:
+        case RW::BSTextureNative::WRAP_WRAP:
+            return GL_REPEAT;
+        case RW::BSTextureNative::WRAP_CLAMP:
+            return GL_CLAMP_TO_EDGE;
+        case RW::BSTextureNative::WRAP_MIRROR:
+            return GL_MIRRORED_REPEAT;
+    }
+}
+
+static std::unique_ptr<TextureData> decodeTexture(
     RW::BSTextureNative& texNative, RW::BinaryStreamSection& rootSection) {
     // TODO: Exception handling.
     if (texNative.platform != 8) {
@@ -79,103 +86,66 @@ static std::unique_ptr<TextureData> createTexture(
         return getErrorTexture();
     }
 
-    GLuint textureName = 0;
+    TextureImage image;
+    image.size = {texNative.width, texNative.height};
+    const size_t pixelCount = size_t{texNative.width} * texNative.height;
 
     if (isPal8) {
-        std::vector<uint32_t> fullColor(texNative.width * texNative.height);
+        image.pixels.resize(pixelCount * sizeof(uint32_t));
 
-        processPalette(fullColor.data(), rootSection);
-
-        glGenTextures(1, &textureName);
-        glBindTexture(GL_TEXTURE_2D, textureName);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texNative.width,
-                     texNative.height, 0, GL_RGBA, GL_UNSIGNED_BYTE,
-                     fullColor.data());
+        processPalette(reinterpret_cast<uint32_t*>(image.pixels.data()),
+                       rootSection);
     } else if (isFulc) {
         auto coldata = rootSection.raw() + sizeof(RW::BSTextureNative);
         coldata += sizeof(uint32_t);
 
-        GLenum type = GL_UNSIGNED_BYTE, format = GL_RGBA;
+        size_t bytesPerPixel = 4;
         switch (texNative.rasterformat) {
             case RW::BSTextureNative::FORMAT_1555:
-                format = GL_RGBA;
-                type = GL_UNSIGNED_SHORT_1_5_5_5_REV;
+                image.format = GL_RGBA;
+                image.type = GL_UNSIGNED_SHORT_1_5_5_5_REV;
+                bytesPerPixel = 2;
                 break;
             case RW::BSTextureNative::FORMAT_8888:
-                format = GL_BGRA;
+                image.format = GL_BGRA;
                 // type = GL_UNSIGNED_INT_8_8_8_8_REV;
                 coldata += 8;
-                type = GL_UNSIGNED_BYTE;
+                image.type = GL_UNSIGNED_BYTE;
                 break;
             case RW::BSTextureNative::FORMAT_888:
-                format = GL_BGRA;
-                type = GL_UNSIGNED_BYTE;
+                image.format = GL_BGRA;
+                image.type = GL_UNSIGNED_BYTE;
                 break;
             default:
                 break;
         }
 
-        glGenTextures(1, &textureName);
-        glBindTexture(GL_TEXTURE_2D, textureName);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texNative.width,
-                     texNative.height, 0, format, type, coldata);
+        auto bytes = reinterpret_cast<const uint8_t*>(coldata);
+        image.pixels.assign(bytes, bytes + pixelCount * bytesPerPixel);
     } else {
         return getErrorTexture();
     }
 
-    GLenum texFilter = GL_LINEAR;
     switch (texNative.filterflags & 0xFF) {
         default:
         case RW::BSTextureNative::FILTER_LINEAR:
-            texFilter = GL_LINEAR;
+            image.magFilter = GL_LINEAR;
             break;
         case RW::BSTextureNative::FILTER_NEAREST:
-            texFilter = GL_NEAREST;
-            break;
-    }
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
-                    GL_LINEAR_MIPMAP_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, texFilter);
-
-    GLenum texwrap = GL_REPEAT;
-    switch (texNative.wrapU) {
-        default:
-        case RW::BSTextureNative::WRAP_WRAP:
-            texwrap = GL_REPEAT;
-            break;
-        case RW::BSTextureNative::WRAP_CLAMP:
-            texwrap = GL_CLAMP_TO_EDGE;
-            break;
-        case RW::BSTextureNative::WRAP_MIRROR:
-            texwrap = GL_MIRRORED_REPEAT;
+            image.magFilter = GL_NEAREST;
             break;
     }
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, texwrap);
 
-    switch (texNative.wrapV) {
-        default:
-        case RW::BSTextureNative::WRAP_WRAP:
-            texwrap = GL_REPEAT;
-            break;
-        case RW::BSTextureNative::WRAP_CLAMP:
-            texwrap = GL_CLAMP_TO_EDGE;
-            break;
-        case RW::BSTextureNative::WRAP_MIRROR:
-            texwrap = GL_MIRRORED_REPEAT;
-            break;
-    }
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, texwrap);
+    image.minFilter = GL_LINEAR_MIPMAP_LINEAR;
+    image.wrapS = getWrapMode(texNative.wrapU);
+    image.wrapT = getWrapMode(texNative.wrapV);
 
-    glGenerateMipmap(GL_TEXTURE_2D);
-
-    return TextureData::create(textureName, {texNative.width, texNative.height},
-                               transparent);
+    return TextureData::create(std::move(image), transparent);
 }
 
-bool TextureLoader::loadFromMemory(const FileContentsInfo& file,
-                                   TextureArchive& inTextures) {
-    auto data = file.data.get();
+bool TextureLoader::decodeFromMemory(const FileContentsView& file,
+                                     TextureArchive& inTextures) {
+    auto data = file.data;
     RW::BinaryStreamSection root(data);
     /*auto texDict =*/root.readStructure<RW::BSTextureDictionary>();
 
@@ -192,8 +162,25 @@ bool TextureLoader::loadFromMemory(const FileContentsInfo& file,
         std::transform(name.begin(), name.end(), name.begin(), ::tolower);
         std::transform(alpha.begin(), alpha.end(), alpha.begin(), ::tolower);
 
-        inTextures[name] = createTexture(texNative, rootSection);
+        inTextures[name] = decodeTexture(texNative, rootSection);
     }
 
     return true;
 }
+
+void TextureLoader::upload(TextureArchive& textures) {
+    for (auto& texture : textures) {
+        if (texture.second) {
+            texture.second->upload();
+        }
+    }
+}
+
+bool TextureLoader::loadFromMemory(const FileContentsView& file,
+                                   TextureArchive& inTextures) {
+    if (!decodeFromMemory(file, inTextures)) {
+        return false;
+    }
+    upload(inTextures);
+    return true;
+}
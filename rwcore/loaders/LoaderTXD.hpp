@@ -6,7 +6,22 @@
 
 class TextureLoader {
 public:
-    bool loadFromMemory(const FileContentsInfo& file, TextureArchive& inTextures);
+    /**
+     * Decodes the textures in a TXD into inTextures, without creating any
+     * GL objects. This does not need a GL context and may run on any thread.
+     */
+    bool decodeFromMemory(const FileContentsView& file,
+                          TextureArchive& inTextures);
+
+    /**
+     * Uploads every decoded texture in textures to the GPU.
+     */
+    static void upload(TextureArchive& textures);
+
+    /**
+     * Decodes and uploads the textures in a TXD.
+     */
+    bool loadFromMemory(const FileContentsView& file, TextureArchive& inTextures);
 };
 
 #endif
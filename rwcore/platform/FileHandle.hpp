@@ -26,4 +26,24 @@ struct FileContentsInfo {
     ~FileContentsInfo() = default;
 };
 
+/**
+ * @brief Non-owning view of a file's contents.
+ *
+ * Views returned by FileIndex::openFileView point into memory mapped by the
+ * FileIndex and remain valid for its lifetime.
+ */
+struct FileContentsView {
+    const char* data = nullptr;
+    size_t length = 0;
+
+    FileContentsView() = default;
+
+    FileContentsView(const char* mem, size_t len) : data(mem), length(len) {
+    }
+
+    FileContentsView(const FileContentsInfo& info)
+        : data(info.data.get()), length(info.length) {
+    }
+};
+
 #endif
@@ -34,10 +34,10 @@ void FileIndex::indexTree(const rwfs::path &path) {
         }
         auto relPath = path.lexically_relative(basePath);
         std::string relPathName = normalizeFilePath(relPath.string());
-        indexedData_[relPathName] = {IndexedDataType::FILE, path.string(), ""};
+        indexedData_[relPathName] = {IndexedDataType::FILE, path.string()};
 
         auto filename = normalizeFilePath(path.filename().string());
-        indexedData_[filename] = {IndexedDataType::FILE, path.string(), ""};
+        indexedData_[filename] = {IndexedDataType::FILE, path.string()};
     }
 }
 
@@ -80,6 +80,22 @@ void FileIndex::indexArchive(const std::string &archive) {
         throw std::runtime_error("Failed to load IMG archive: " + path.string());
     }
 
+    auto imgPath = img.getArchivePath().string();
+    auto archiveIt = std::find_if(
+        archives_.begin(), archives_.end(),
+        [&](const auto &open) { return open->path == imgPath; });
+    auto archiveIndex = static_cast<size_t>(archiveIt - archives_.begin());
+
+    if (archiveIt == archives_.end()) {
+        auto open = std::make_unique<OpenArchive>();
+        open->path = imgPath;
+        open->stream.open(imgPath, std::ios::binary);
+        if (!open->stream.is_open()) {
+            throw std::runtime_error("Failed to open IMG archive: " + imgPath);
+        }
+        archives_.push_back(std::move(open));
+    }
+
     for (size_t i = 0; i < img.getAssetCount(); ++i) {
         auto &asset = img.getAssetInfoByIndex(i);
 
@@ -87,7 +103,11 @@ void FileIndex::indexArchive(const std::string &archive) {
 
         std::string assetName = normalizeFilePath(asset.name);
 
-        indexedData_[assetName] = {IndexedDataType::ARCHIVE, path.string(), asset.name};
+        IndexedData data{IndexedDataType::ARCHIVE, path.string()};
+        data.archive = archiveIndex;
+        data.offset = std::uint64_t{asset.offset} * kIMGSectorSize;
+        data.size = asset.size * kIMGSectorSize;
+        indexedData_[assetName] = std::move(data);
     }
 }
 
@@ -105,17 +125,16 @@ FileContentsInfo FileIndex::openFile(const std::string &filePath) {
     size_t length = 0;
 
     if (indexedData.type == IndexedDataType::ARCHIVE) {
-        LoaderIMG img;
+        auto &archive = *archives_[indexedData.archive];
 
-        if (!img.load(indexedData.path)) {
-            throw std::runtime_error("Failed to load IMG archive: " + indexedData.path);
-        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        length = indexedData.size;
+        data = std::make_unique<char[]>(length);
 
-        LoaderIMGFile file;
-        auto filename = rwfs::path(indexedData.assetData).filename().string();
-        if (img.findAssetInfo(filename, file)) {
-            length = file.size * 2048;
-            data = img.loadToMemory(filename);
+        archive.stream.clear();
+        archive.stream.seekg(static_cast<std::streamoff>(indexedData.offset));
+        if (!archive.stream.read(data.get(), static_cast<std::streamsize>(length))) {
+            RW_ERROR("Error reading " << filePath << " from " << archive.path);
         }
     } else {
         std::ifstream dfile(indexedData.path, std::ios::binary);
@@ -132,3 +151,46 @@ FileContentsInfo FileIndex::openFile(const std::string &filePath) {
 
     return {std::move(data), length};
 }
+
+FileContentsView FileIndex::openFileView(const std::string &filePath) {
+    auto cleanFilePath = normalizeFilePath(filePath);
+    auto indexedDataPos = indexedData_.find(cleanFilePath);
+
+    if (indexedDataPos == indexedData_.end()) {
+        return {};
+    }
+
+    const auto &indexedData = indexedDataPos->second;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (indexedData.type == IndexedDataType::ARCHIVE) {
+        auto &archive = *archives_[indexedData.archive];
+        if (!archive.mapping.isOpen() && !archive.mapping.open(archive.path)) {
+            return {};
+        }
+
+        // The final entry may be shorter than its sector count implies.
+        if (indexedData.offset >= archive.mapping.size()) {
+            RW_ERROR(filePath << " lies outside of " << archive.path);
+            return {};
+        }
+        auto available = archive.mapping.size() - indexedData.offset;
+        auto length =
+            std::min(indexedData.size, static_cast<size_t>(available));
+        return {archive.mapping.data() + indexedData.offset, length};
+    }
+
+    auto mappingPos = mappedFiles_.find(indexedData.path);
+    if (mappingPos == mappedFiles_.end()) {
+        MappedFile mapping;
+        if (!mapping.open(indexedData.path)) {
+            RW_ERROR("Unable to map file: " << indexedData.path);
+            return {};
+        }
+        mappingPos =
+            mappedFiles_.emplace(indexedData.path, std::move(mapping)).first;
+    }
+
+    const auto &mapping = mappingPos->second;
+    return {mapping.data(), mapping.size()};
+}
@@ -1,11 +1,24 @@
 #ifndef _LIBRW_FILEINDEX_HPP_
 #define _LIBRW_FILEINDEX_HPP_
 
+#include "platform/MappedFile.hpp"
 #include "rw/filesystem.hpp"
 #include "rw/forward.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
+/**
+ * Maps game data paths to files on disk and within archives.
+ *
+ * Once indexing is complete, openFile and openFileView may be called from
+ * several threads at once.
+ */
 class FileIndex {
 public:
     /**
@@ -43,6 +56,10 @@ public:
     /**
      * Adds the files contained within the given Archive file to the
      * file index.
+     *
+     * The archive is kept open for the lifetime of the FileIndex, and the
+     * location of each file is stored in the index, so opening an archived
+     * file does not need to re-read the archive directory.
      * @param filePath path to the archive
      * @throws if this FileIndex has not indexed the archive itself
      */
@@ -56,6 +73,19 @@ public:
      */
     FileContentsInfo openFile(const std::string &filePath);
 
+    /**
+     * Returns a view of the file's contents without copying them, by
+     * memory mapping the archive or file it is stored in. The mapping is
+     * kept for the lifetime of the FileIndex.
+     *
+     * Files that can't be mapped, whether on disk or in an archive, give
+     * an empty view rather than throwing.
+     * @param filePath name of the file to open
+     * @return View of the file, with nullptr data if this FileIndex has not
+     * indexed the path or it could not be mapped
+     */
+    FileContentsView openFileView(const std::string &filePath);
+
 private:
     /**
      * @brief Type of the indexed data.
@@ -75,10 +105,41 @@ private:
         IndexedDataType type;
         /// Path of indexed data.
         std::string path;
-        /// Extra data of assets (FIXME: use c++17 std::variant or std::option)
-        std::string assetData;
+        /// Index into archives_ of the archive containing the data.
+        std::size_t archive = 0;
+        /// Offset of the data within the archive, in bytes.
+        std::uint64_t offset = 0;
+        /// Size of the data within the archive, in bytes.
+        std::size_t size = 0;
+    };
+
+    /**
+     * @brief An archive held open by indexArchive.
+     */
+    struct OpenArchive {
+        /// Path of the archive image.
+        std::string path;
+        /// Stream reading from the archive image.
+        std::ifstream stream;
+        /// Mapping of the archive image, opened by openFileView.
+        MappedFile mapping;
     };
 
+    /**
+     * @brief archives_ Archives that files have been indexed from.
+     */
+    std::vector<std::unique_ptr<OpenArchive>> archives_;
+
+    /**
+     * @brief mutex_ Guards the archive streams and the file mappings.
+     */
+    std::mutex mutex_;
+
+    /**
+     * @brief mappedFiles_ Mappings of files on disk opened by openFileView.
+     */
+    std::unordered_map<std::string, MappedFile> mappedFiles_;
+
     /**
      * @brief indexedData_ A mapping from filepath (relative to game data path) to an IndexedData item.
      */
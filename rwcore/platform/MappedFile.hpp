@@ -0,0 +1,57 @@
+#ifndef _LIBRW_MAPPEDFILE_HPP_
+#define _LIBRW_MAPPEDFILE_HPP_
+
+#include "rw/filesystem.hpp"
+
+#include <cstddef>
+
+/**
+ * @brief Read-only memory mapping of a file on disk.
+ *
+ * The mapping is released when the MappedFile is destroyed.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief open Map the whole of the file at path
+     * @param path the file to map
+     * @return true if the file was mapped
+     */
+    bool open(const rwfs::path& path);
+
+    /**
+     * @brief close Release the mapping, invalidating pointers into it
+     */
+    void close();
+
+    bool isOpen() const {
+        return open_;
+    }
+
+    const char* data() const {
+        return data_;
+    }
+
+    std::size_t size() const {
+        return size_;
+    }
+
+private:
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool open_ = false;
+#ifdef RW_WINDOWS
+    void* mapping_ = nullptr;
+#endif
+};
+
+#endif
@@ -9,6 +9,7 @@
 struct Animation;
 class Clump;
 struct FileContentsInfo;
+struct FileContentsView;
 class ModelFrame;
 struct Geometry;
 class Atomic;
@@ -1,7 +1,11 @@
 #include "ai/AIGraph.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <functional>
+#include <queue>
+#include <tuple>
 
 #include <glm/gtx/norm.hpp>
 
@@ -13,6 +17,28 @@
 
 namespace ai {
 
+namespace {
+/// @return The cell in the node grids containing position, with positions
+/// outside of the grid placed in the closest cell
+glm::ivec2 gridCell(const glm::vec3& position) {
+    float lowerCoord = -(WORLD_GRID_SIZE) / 2.f;
+    auto gridrel =
+        glm::vec2(position) - glm::vec2(lowerCoord, lowerCoord);
+    auto gridcoord = glm::floor(gridrel / glm::vec2(WORLD_CELL_SIZE));
+    if (gridcoord.x < 0 || gridcoord.y < 0 ||
+        gridcoord.x >= WORLD_GRID_WIDTH || gridcoord.y >= WORLD_GRID_WIDTH) {
+        RW_MESSAGE("Warning: Node outside of grid at coord "
+                   << gridcoord.x << " " << gridcoord.y);
+    }
+    return glm::clamp(glm::ivec2(gridcoord), glm::ivec2(0),
+                      glm::ivec2(WORLD_GRID_WIDTH - 1));
+}
+
+std::size_t gridIndex(const glm::ivec2& cell) {
+    return static_cast<std::size_t>((cell.x * WORLD_GRID_WIDTH) + cell.y);
+}
+}  // namespace
+
 void AIGraph::createPathNodes(const glm::vec3& position,
                               const glm::quat& rotation, PathData& path) {
     auto startIndex = static_cast<std::uint32_t>(nodes.size());
@@ -50,27 +76,17 @@ void AIGraph::createPathNodes(const glm::vec3& position,
             ainode->position = nodePosition;
             ainode->external = node.type == PathNode::EXTERNAL;
             ainode->disabled = false;
+            ainode->index = nodes.size();
 
             pathNodes.push_back(ptr);
             nodes.push_back(std::move(ainode));
 
+            // Determine which grid cell this node falls into
+            auto index = gridIndex(gridCell(ptr->position));
+            gridAllNodes[index].push_back(ptr);
+
             if (ptr->external) {
                 externalNodes.push_back(ptr);
-
-                // Determine which grid cell this node falls into
-                float lowerCoord = -(WORLD_GRID_SIZE) / 2.f;
-                auto gridrel = glm::vec2(ptr->position) -
-                               glm::vec2(lowerCoord, lowerCoord);
-                auto gridcoord =
-                    glm::floor(gridrel / glm::vec2(WORLD_CELL_SIZE));
-                if (gridcoord.x < 0 || gridcoord.y < 0 ||
-                    gridcoord.x >= WORLD_GRID_WIDTH ||
-                    gridcoord.y >= WORLD_GRID_WIDTH) {
-                    RW_MESSAGE("Warning: Node outside of grid at coord "
-                               << gridcoord.x << " " << gridcoord.y);
-                }
-                auto index = static_cast<std::size_t>(
-                    (gridcoord.x * WORLD_GRID_WIDTH) + gridcoord.y);
                 gridNodes[index].push_back(ptr);
             }
         }
@@ -86,6 +102,8 @@ void AIGraph::createPathNodes(const glm::vec3& position,
             next->connections.push_back(node);
         }
     }
+
+    clearRouteCache();
 }
 
 glm::ivec2 worldToGrid(const glm::vec2& world) {
@@ -122,4 +140,163 @@ void AIGraph::gatherExternalNodesNear(const glm::vec3& center,
     }
 }
 
+AIGraphNode* AIGraph::findNearestNode(
+    const glm::vec3& position, NodeType type, float maxDistance,
+    const std::function<bool(const AIGraphNode&)>& filter) const {
+    const auto origin =
+        glm::clamp(worldToGrid(glm::vec2(position)), glm::ivec2(0),
+                   glm::ivec2(WORLD_GRID_WIDTH - 1));
+
+    AIGraphNode* nearest = nullptr;
+    float nearestDistance2 = maxDistance * maxDistance;
+
+    // Search rings of cells around the origin, nodes outside of ring r are
+    // at least r cells away from position.
+    for (int r = 0; r < WORLD_GRID_WIDTH; ++r) {
+        for (int x = origin.x - r; x <= origin.x + r; ++x) {
+            if (x < 0 || x >= WORLD_GRID_WIDTH) {
+                continue;
+            }
+            const bool edge = x == origin.x - r || x == origin.x + r;
+            const int step = edge ? 1 : 2 * r;
+            for (int y = origin.y - r; y <= origin.y + r; y += step) {
+                if (y < 0 || y >= WORLD_GRID_WIDTH) {
+                    continue;
+                }
+                for (const auto node : gridAllNodes[gridIndex({x, y})]) {
+                    if (node->type != type) {
+                        continue;
+                    }
+                    const float d2 = glm::distance2(position, node->position);
+                    if (d2 < nearestDistance2 && (!filter || filter(*node))) {
+                        nearest = node;
+                        nearestDistance2 = d2;
+                    }
+                }
+            }
+        }
+
+        const auto searched = static_cast<float>(r * WORLD_CELL_SIZE);
+        if (searched * searched >= nearestDistance2) {
+            break;
+        }
+    }
+
+    return nearest;
+}
+
+std::size_t AIGraph::RouteKeyHash::operator()(const RouteKey& key) const {
+    auto hash = std::hash<std::size_t>{}(key.start);
+    hash ^= std::hash<std::size_t>{}(key.goal) + 0x9e3779b9 + (hash << 6) +
+            (hash >> 2);
+    return hash * 2 + static_cast<std::size_t>(key.type);
+}
+
+bool AIGraph::findRoute(AIGraphNode* start, AIGraphNode* goal, NodeType type,
+                        std::vector<AIGraphNode*>& route) {
+    route.clear();
+    RW_CHECK(start != nullptr && goal != nullptr, "Route missing an end");
+    if (start == nullptr || goal == nullptr) {
+        return false;
+    }
+
+    const RouteKey key{start->index, goal->index, type};
+    auto cached = routeIndex.find(key);
+    if (cached != routeIndex.end()) {
+        routeCache.splice(routeCache.begin(), routeCache, cached->second);
+        route = cached->second->second;
+        return !route.empty();
+    }
+
+    searchRoute(start, goal, type, route);
+
+    if (routeCache.size() >= kRouteCacheSize) {
+        routeIndex.erase(routeCache.back().first);
+        routeCache.pop_back();
+    }
+    routeCache.emplace_front(key, route);
+    routeIndex.emplace(key, routeCache.begin());
+
+    return !route.empty();
+}
+
+void AIGraph::clearRouteCache() {
+    routeCache.clear();
+    routeIndex.clear();
+}
+
+bool AIGraph::searchRoute(AIGraphNode* start, AIGraphNode* goal,
+                          NodeType type, std::vector<AIGraphNode*>& route) {
+    if (start->type != type || goal->type != type) {
+        return false;
+    }
+
+    if (routeVisits.size() != nodes.size()) {
+        routeCosts.resize(nodes.size());
+        routeParents.resize(nodes.size());
+        routeVisits.assign(nodes.size(), 0);
+        routeSearch = 0;
+    }
+    // Nodes are only valid in this search if they were visited by it
+    if (++routeSearch == 0) {
+        std::fill(routeVisits.begin(), routeVisits.end(), 0);
+        routeSearch = 1;
+    }
+
+    // Straight line distance never overestimates the distance along the
+    // connections, so the first time the goal is taken it is on the
+    // shortest route.
+    using OpenNode = std::tuple<float, float, std::size_t>;
+    std::priority_queue<OpenNode, std::vector<OpenNode>, std::greater<>> open;
+
+    routeCosts[start->index] = 0.f;
+    routeParents[start->index] = start->index;
+    routeVisits[start->index] = routeSearch;
+    open.emplace(glm::distance(start->position, goal->position), 0.f,
+                 start->index);
+
+    while (!open.empty()) {
+        const auto [estimate, cost, index] = open.top();
+        RW_UNUSED(estimate);
+        open.pop();
+
+        // Skip entries for nodes that have since been reached more cheaply
+        if (cost > routeCosts[index]) {
+            continue;
+        }
+
+        const auto& node = nodes[index];
+        if (node.get() == goal) {
+            for (auto i = index; ; i = routeParents[i]) {
+                route.push_back(nodes[i].get());
+                if (i == start->index) {
+                    break;
+                }
+            }
+            std::reverse(route.begin(), route.end());
+            return true;
+        }
+
+        for (const auto next : node->connections) {
+            if (next->type != type || (next->disabled && next != goal)) {
+                continue;
+            }
+            const float nextCost =
+                cost + glm::distance(node->position, next->position);
+            if (routeVisits[next->index] == routeSearch &&
+                nextCost >= routeCosts[next->index]) {
+                continue;
+            }
+            routeCosts[next->index] = nextCost;
+            routeParents[next->index] = index;
+            routeVisits[next->index] = routeSearch;
+            open.emplace(
+                nextCost + glm::distance(next->position, goal->position),
+                nextCost, next->index);
+        }
+    }
+
+    return false;
+}
+
 }  // namespace ai
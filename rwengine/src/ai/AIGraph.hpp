@@ -6,6 +6,13 @@
 #include <rw/types.hpp>
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 struct PathData;
@@ -17,6 +24,9 @@ struct AIGraphNode;
 
 class AIGraph {
 public:
+    /// Number of routes remembered by findRoute()
+    static constexpr std::size_t kRouteCacheSize = 256;
+
     ~AIGraph() = default;
 
     std::vector<std::unique_ptr<AIGraphNode>> nodes;
@@ -33,11 +43,84 @@ public:
      */
     std::array<std::vector<AIGraphNode*>, WORLD_GRID_CELLS> gridNodes;
 
+    /**
+     * Stores every node, in the same cells as gridNodes
+     */
+    std::array<std::vector<AIGraphNode*>, WORLD_GRID_CELLS> gridAllNodes;
+
     void createPathNodes(const glm::vec3& position, const glm::quat& rotation,
                          PathData& path);
 
     void gatherExternalNodesNear(const glm::vec3& center, const float radius,
                                  std::vector<AIGraphNode*>& nodes, NodeType type);
+
+    /**
+     * Finds the closest node of the given type, searching outwards from the
+     * grid cell containing position.
+     *
+     * @param filter If set, nodes it returns false for are ignored
+     * @return The node, or nullptr if there is none within maxDistance
+     */
+    AIGraphNode* findNearestNode(
+        const glm::vec3& position, NodeType type,
+        float maxDistance = std::numeric_limits<float>::max(),
+        const std::function<bool(const AIGraphNode&)>& filter = {}) const;
+
+    /**
+     * Finds the shortest route from start to goal along the connections
+     * between nodes of the given type, skipping disabled nodes.
+     *
+     * Routes are searched with A*, and the most recently used ones are
+     * kept until the graph changes.
+     *
+     * @param route Set to the nodes from start to goal, inclusive
+     * @return false if there is no route
+     */
+    bool findRoute(AIGraphNode* start, AIGraphNode* goal, NodeType type,
+                   std::vector<AIGraphNode*>& route);
+
+    /**
+     * Forgets every route found so far. Must be called when nodes are
+     * enabled or disabled.
+     */
+    void clearRouteCache();
+
+    std::size_t getCachedRouteCount() const {
+        return routeCache.size();
+    }
+
+private:
+    struct RouteKey {
+        std::size_t start;
+        std::size_t goal;
+        NodeType type;
+
+        bool operator==(const RouteKey& other) const {
+            return start == other.start && goal == other.goal &&
+                   type == other.type;
+        }
+    };
+
+    struct RouteKeyHash {
+        std::size_t operator()(const RouteKey& key) const;
+    };
+
+    using CachedRoute = std::pair<RouteKey, std::vector<AIGraphNode*>>;
+
+    bool searchRoute(AIGraphNode* start, AIGraphNode* goal, NodeType type,
+                     std::vector<AIGraphNode*>& route);
+
+    /// Most recently used route first, an empty route has no solution
+    std::list<CachedRoute> routeCache;
+    std::unordered_map<RouteKey, std::list<CachedRoute>::iterator,
+                       RouteKeyHash>
+        routeIndex;
+
+    // Search state, indexed by node
+    std::vector<float> routeCosts;
+    std::vector<std::size_t> routeParents;
+    std::vector<std::uint32_t> routeVisits;
+    std::uint32_t routeSearch = 0;
 };
 
 } // ai
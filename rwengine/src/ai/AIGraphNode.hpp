@@ -3,6 +3,7 @@
 
 #include <glm/vec3.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -27,6 +28,9 @@ struct AIGraphNode {
 
     int32_t nextIndex;
 
+    /// Position in AIGraph::nodes
+    std::size_t index{};
+
     bool disabled;
 
     std::vector<AIGraphNode*> connections;
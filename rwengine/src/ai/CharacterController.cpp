@@ -22,6 +22,7 @@
 #include <dynamics/HitTest.hpp>
 
 #include "ai/CharacterController.hpp"
+#include "ai/AIGraph.hpp"
 #include "ai/AIGraphNode.hpp"
 #include "data/WeaponData.hpp"
 #include "engine/Animator.hpp"
@@ -132,10 +133,57 @@ void CharacterController::setRunning(bool run) {
     character->setRunning(run);
 }
 
+void Activities::GoTo::planRoute(CharacterObject *character) {
+    planned = true;
+
+    const auto cpos = character->getPosition();
+    if (glm::distance(glm::vec2(cpos), glm::vec2(target)) < kPathDistance) {
+        return;
+    }
+
+    auto& graph = character->engine->aigraph;
+    auto start = graph.findNearestNode(cpos, NodeType::Pedestrian, kPathReach);
+    auto end = graph.findNearestNode(target, NodeType::Pedestrian, kPathReach);
+    if (start == nullptr || end == nullptr || start == end) {
+        return;
+    }
+
+    std::vector<AIGraphNode*> route;
+    if (!graph.findRoute(start, end, NodeType::Pedestrian, route)) {
+        return;
+    }
+
+    waypoints.reserve(route.size());
+    for (const auto node : route) {
+        waypoints.push_back(node->position);
+    }
+}
+
 bool Activities::GoTo::update(CharacterObject *character,
                               CharacterController *controller) {
-    /* TODO: Use the ai nodes to navigate to the position */
+    if (followPaths && !planned) {
+        planRoute(character);
+    }
+
     auto cpos = character->getPosition();
+
+    // Walk through the route, waypoints only need to be passed near
+    while (nextWaypoint < waypoints.size() &&
+           glm::distance(glm::vec2(cpos),
+                         glm::vec2(waypoints[nextWaypoint])) < 1.f) {
+        nextWaypoint++;
+    }
+    if (nextWaypoint < waypoints.size()) {
+        glm::vec3 waypointDirection = waypoints[nextWaypoint] - cpos;
+        float hdg = std::atan2(waypointDirection.y, waypointDirection.x) -
+                    glm::half_pi<float>();
+        character->setHeading(glm::degrees(hdg));
+
+        controller->setMoveDirection({1.f, 0.f, 0.f});
+        controller->setRunning(sprint);
+        return false;
+    }
+
     glm::vec3 targetDirection = target - cpos;
 
     // Ignore vertical axis for the sake of simplicity.
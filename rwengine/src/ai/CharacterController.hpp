@@ -4,8 +4,10 @@
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 class CharacterObject;
 class VehicleObject;
@@ -207,11 +209,18 @@ namespace Activities {
 struct GoTo : public CharacterController::Activity {
     DECL_ACTIVITY(GoTo)
 
+    /// Targets further than this are reached along the pedestrian paths
+    static constexpr float kPathDistance = 30.f;
+    /// Largest distance to walk to or from the paths
+    static constexpr float kPathReach = 20.f;
+
     glm::vec3 target;
     bool sprint;
+    bool followPaths;
 
-    GoTo(const glm::vec3& target, bool _sprint = false)
-        : target(target), sprint(_sprint) {
+    GoTo(const glm::vec3& target, bool _sprint = false,
+         bool _followPaths = false)
+        : target(target), sprint(_sprint), followPaths(_followPaths) {
     }
 
     bool update(CharacterObject* character, CharacterController* controller) override;
@@ -219,6 +228,14 @@ struct GoTo : public CharacterController::Activity {
     bool canSkip(CharacterObject*, CharacterController*) const override {
         return true;
     }
+
+private:
+    void planRoute(CharacterObject* character);
+
+    bool planned = false;
+    /// Positions to walk through before the target
+    std::vector<glm::vec3> waypoints;
+    std::size_t nextWaypoint = 0;
 };
 
 struct DriveTo : public CharacterController::Activity {
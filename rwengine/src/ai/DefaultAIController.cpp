@@ -78,21 +78,8 @@ void DefaultAIController::update(float dt) {
             } else {
                 // We need to pick an initial node
                 auto& graph = getCharacter()->engine->aigraph;
-                AIGraphNode* node = nullptr;
-                float mindist = std::numeric_limits<float>::max();
-                for (const auto& n : graph.nodes) {
-                    if (n->type != ai::NodeType::Pedestrian) {
-                        continue;
-		    }
-
-                    float d = glm::distance(n->position,
-                                            getCharacter()->getPosition());
-                    if (d < mindist) {
-                        node = n.get();
-                        mindist = d;
-                    }
-                }
-                targetNode = node;
+                targetNode = graph.findNearestNode(
+                    getCharacter()->getPosition(), ai::NodeType::Pedestrian);
             }
         } break;
         case TrafficDriver: {
@@ -179,31 +166,15 @@ void DefaultAIController::update(float dt) {
             else {
                 // We need to pick an initial node
                 auto& graph = getCharacter()->engine->aigraph;
-                AIGraphNode* node = nullptr;
-                float mindist = std::numeric_limits<float>::max();
-
-                for (const auto& n : graph.nodes) {
-                    // No vehicle node, continue
-                    if (n->type != ai::NodeType::Vehicle) {
-                        continue;
-                    }
-
-                    // The node must be ahead of the vehicle
-                    if (getCharacter()->getCurrentVehicle()->isInFront(n->position) < 0.f) {
-                        continue;
-                    }
-
-                    const float d = glm::distance(
-                        n->position,
-                        getCharacter()->getCurrentVehicle()->getPosition());
-
-                    if (d < mindist) {
-                        node = n.get();
-                        mindist = d;
-                    }
-                }
-
-                targetNode = node;
+                auto vehicle = getCharacter()->getCurrentVehicle();
+
+                // The node must be ahead of the vehicle
+                targetNode = graph.findNearestNode(
+                    vehicle->getPosition(), ai::NodeType::Vehicle,
+                    std::numeric_limits<float>::max(),
+                    [vehicle](const AIGraphNode& n) {
+                        return vehicle->isInFront(n.position) >= 0.f;
+                    });
 		
                 // Set the next activity
                 if (targetNode) {
@@ -45,20 +45,19 @@ std::vector<ai::AIGraphNode*> TrafficDirector::findAvailableNodes(
     // Check if any of the nearby nodes are blocked by a pedestrian or vehicle standing on
     // it
     // or because it's inside the view frustum
+    std::vector<GameObject*> nearby;
     for (auto it = available.begin(); it != available.end();) {
         bool blocked = false;
         float dist2 = glm::distance2(camera.position, (*it)->position);
 
-        for (const auto& obj : world->pedestrianPool.objects) {
-            if (glm::distance2((*it)->position, obj.second->getPosition()) <=
-                minDist) {
-                blocked = true;
-                break;
+        nearby.clear();
+        world->objectGrid.query((*it)->position, std::sqrt(minDist), nearby);
+        for (const auto& obj : nearby) {
+            if (obj->type() != GameObject::Character &&
+                obj->type() != GameObject::Vehicle) {
+                continue;
             }
-        }
-
-        for (const auto& obj : world->vehiclePool.objects) {
-            if (glm::distance2((*it)->position, obj.second->getPosition()) <=
+            if (glm::distance2((*it)->position, obj->getPosition()) <=
                 minDist) {
                 blocked = true;
                 break;
@@ -148,6 +147,19 @@ std::vector<GameObject*> TrafficDirector::populateNearby(
         111, 112, 116, 119, 128, 129, 130, 134, 135, 136, 138, 139, 144, 146
     }};
 
+    // Spawn the models chosen on an earlier pass first, as they've had time
+    // to stream in
+    auto takeModel = [&](std::vector<uint16_t>& chosen,
+                         const auto& candidates) -> uint16_t {
+        if (chosen.empty()) {
+            return candidates.at(
+                world->getRandomNumber(0u, candidates.size() - 1));
+        }
+        const auto id = chosen.back();
+        chosen.pop_back();
+        return id;
+    };
+
     auto availablePedsNodes = findAvailableNodes(ai::NodeType::Pedestrian, camera, radius);
 
     // We have not reached the limit of spawned pedestrians
@@ -170,8 +182,7 @@ std::vector<GameObject*> TrafficDirector::populateNearby(
             counter--;
 
             // Spawn a pedestrian from the available pool
-            const auto pedId =
-                peds.at(world->getRandomNumber(0u, peds.size() - 1));
+            const auto pedId = takeModel(nextPeds, peds);
             auto ped = world->createPedestrian(pedId, spawn->position);
             ped->applyOffset();
             ped->setLifetime(GameObject::TrafficLifetime);
@@ -236,16 +247,14 @@ std::vector<GameObject*> TrafficDirector::populateNearby(
                 strafe * (2.5f + 5.f * static_cast<float>(lane - 1));
 
             // Spawn a vehicle from the available pool
-            const auto carId =
-                cars.at(world->getRandomNumber(0u, cars.size() - 1));
+            const auto carId = takeModel(nextCars, cars);
             auto vehicle = world->createVehicle(carId, next->position + diff + laneOffset, orientation);
             vehicle->applyOffset();
             vehicle->setLifetime(GameObject::TrafficLifetime);
             vehicle->setHandbraking(false);
 
             // Spawn a pedestrian and put it into the vehicle
-            const auto pedId =
-                peds.at(world->getRandomNumber(0u, peds.size() - 1));
+            const auto pedId = takeModel(nextPeds, peds);
             CharacterObject* character = world->createPedestrian(pedId, vehicle->getPosition());
             character->setLifetime(GameObject::TrafficLifetime);
             character->setCurrentVehicle(vehicle, 0);
@@ -258,6 +267,29 @@ std::vector<GameObject*> TrafficDirector::populateNearby(
         }
     }
 
+    // Choose the models for the traffic that can still be spawned, and stream
+    // only those in ahead of time, so that spawning doesn't have to load them
+    const auto pedCount = world->pedestrianPool.objects.size();
+    const auto carCount = world->vehiclePool.objects.size();
+    const auto freeCars =
+        maximumCars > carCount ? maximumCars - carCount : size_t(0);
+    const auto freePeds =
+        (maximumPedestrians > pedCount ? maximumPedestrians - pedCount
+                                       : size_t(0)) +
+        freeCars;
+    while (nextPeds.size() < freePeds) {
+        nextPeds.push_back(peds.at(world->getRandomNumber(0u, peds.size() - 1)));
+    }
+    while (nextCars.size() < freeCars) {
+        nextCars.push_back(cars.at(world->getRandomNumber(0u, cars.size() - 1)));
+    }
+    for (const auto id : nextPeds) {
+        world->data->streamer.request(id, camera.position);
+    }
+    for (const auto id : nextCars) {
+        world->data->streamer.request(id, camera.position);
+    }
+
     // Find places it's legal to spawn things
 
     return created;
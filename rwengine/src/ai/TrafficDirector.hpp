@@ -1,6 +1,8 @@
 #ifndef _RWENGINE_TRAFFICDIRECTOR_HPP_
 #define _RWENGINE_TRAFFICDIRECTOR_HPP_
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 class GameWorld;
@@ -44,6 +46,11 @@ private:
     float carDensity = 1.f;
     size_t maximumPedestrians = 20;
     size_t maximumCars = 10;
+
+    /// Models chosen for the next pedestrians and drivers, and vehicles, so
+    /// that they can be streamed in before they're spawned
+    std::vector<uint16_t> nextPeds;
+    std::vector<uint16_t> nextCars;
 };
 
 }  // namespace ai
@@ -0,0 +1,77 @@
+#include "core/JobPool.hpp"
+
+JobPool::JobPool(unsigned int threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    for (auto i = 1u; i < threads; ++i) {
+        workers_.emplace_back(&JobPool::workerMain, this);
+    }
+}
+
+JobPool::~JobPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void JobPool::run(std::size_t count,
+                  const std::function<void(std::size_t)>& job) {
+    if (workers_.empty() || count <= 1) {
+        for (std::size_t i = 0; i < count; ++i) {
+            job(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &job;
+        count_ = count;
+        next_ = 0;
+        active_ = static_cast<unsigned int>(workers_.size());
+        batch_++;
+    }
+    wake_.notify_all();
+
+    work();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [&] { return active_ == 0; });
+    job_ = nullptr;
+}
+
+void JobPool::work() {
+    while (true) {
+        auto i = next_.fetch_add(1);
+        if (i >= count_) {
+            return;
+        }
+        (*job_)(i);
+    }
+}
+
+void JobPool::workerMain() {
+    std::uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [&] { return stopping_ || batch_ != seen; });
+        if (stopping_) {
+            return;
+        }
+        seen = batch_;
+
+        lock.unlock();
+        work();
+        lock.lock();
+
+        if (--active_ == 0) {
+            done_.notify_one();
+        }
+    }
+}
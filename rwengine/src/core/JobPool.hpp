@@ -0,0 +1,67 @@
+#ifndef _RWENGINE_JOBPOOL_HPP_
+#define _RWENGINE_JOBPOOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Pool of worker threads for splitting work within a frame.
+ *
+ * The calling thread takes part in the work and blocks until all of it is
+ * done, so jobs may read state owned by the caller without locking as long
+ * as each job only writes to its own outputs.
+ */
+class JobPool {
+public:
+    /**
+     * @param threads Number of threads to run jobs on, including the
+     * calling thread. 0 uses one per hardware thread.
+     */
+    explicit JobPool(unsigned int threads = 0);
+
+    ~JobPool();
+
+    JobPool(const JobPool&) = delete;
+    JobPool& operator=(const JobPool&) = delete;
+
+    /**
+     * Runs job(i) for every i in [0, count), spread over the pool
+     */
+    void run(std::size_t count, const std::function<void(std::size_t)>& job);
+
+    /**
+     * @return The number of threads running jobs, including the caller
+     */
+    unsigned int getThreadCount() const {
+        return static_cast<unsigned int>(workers_.size()) + 1;
+    }
+
+private:
+    void workerMain();
+
+    /// Takes jobs of the current batch until there are none left
+    void work();
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    /// Incremented for every batch, so that workers can tell them apart
+    std::uint64_t batch_ = 0;
+    /// Workers still inside the current batch
+    unsigned int active_ = 0;
+    bool stopping_ = false;
+
+    const std::function<void(std::size_t)>* job_ = nullptr;
+    std::size_t count_ = 0;
+    std::atomic<std::size_t> next_{0};
+
+    std::vector<std::thread> workers_;
+};
+
+#endif
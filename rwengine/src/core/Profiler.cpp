@@ -1 +1,36 @@
 #include <core/Profiler.hpp>
+
+#include <map>
+
+void ScopeTimings::install() {
+    active_ = this;
+}
+
+void ScopeTimings::uninstall() {
+    if (active_ == this) {
+        active_ = nullptr;
+    }
+}
+
+void ScopeTimings::add(const char* label, std::chrono::nanoseconds time) {
+    auto& total = totals_[label];
+    total.calls++;
+    total.time += time;
+}
+
+std::vector<ScopeTimings::Scope> ScopeTimings::getScopes() const {
+    // The same label may be at different addresses in different files
+    std::map<std::string, Total> merged;
+    for (const auto& [label, total] : totals_) {
+        auto& scope = merged[label];
+        scope.calls += total.calls;
+        scope.time += total.time;
+    }
+
+    std::vector<Scope> scopes;
+    scopes.reserve(merged.size());
+    for (const auto& [label, total] : merged) {
+        scopes.push_back({label, total.calls, total.time});
+    }
+    return scopes;
+}
@@ -1,12 +1,133 @@
 #ifndef _RWENGINE_PROFILER_HPP_
 #define _RWENGINE_PROFILER_HPP_
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Totals the time spent in RW_PROFILE_SCOPE sites.
+ *
+ * Nothing is collected until a ScopeTimings is installed on a thread, and
+ * then only for the scopes entered on that thread. Scopes are timed
+ * inclusively, so nested scopes are also counted in their parents.
+ */
+class ScopeTimings {
+public:
+    struct Scope {
+        std::string label;
+        std::uint64_t calls = 0;
+        std::chrono::nanoseconds time{};
+    };
+
+    ScopeTimings() = default;
+
+    ~ScopeTimings() {
+        uninstall();
+    }
+
+    ScopeTimings(const ScopeTimings&) = delete;
+    ScopeTimings& operator=(const ScopeTimings&) = delete;
+
+    /**
+     * Collects the scopes entered on the calling thread from now on
+     */
+    void install();
+
+    /**
+     * Stops collecting on the calling thread
+     */
+    void uninstall();
+
+    void add(const char* label, std::chrono::nanoseconds time);
+
+    void clear() {
+        totals_.clear();
+    }
+
+    /**
+     * @return The totals of each label, sorted by label
+     */
+    std::vector<Scope> getScopes() const;
+
+    /**
+     * @return The timings installed on the calling thread, if any
+     */
+    static ScopeTimings* current() {
+        return active_;
+    }
+
+private:
+    struct Total {
+        std::uint64_t calls = 0;
+        std::chrono::nanoseconds time{};
+    };
+
+    /// Labels are string literals or __func__, so their address is enough
+    /// to tell them apart
+    std::unordered_map<const char*, Total> totals_;
+
+    static inline thread_local ScopeTimings* active_ = nullptr;
+};
+
+/**
+ * Nearest-rank percentile of a sorted list, the value at or below which p
+ * percent of the list lies. Every tool reporting percentiles uses it, so
+ * that their numbers can be compared.
+ */
+template <class T>
+T percentile(const std::vector<T>& sorted, float p) {
+    if (sorted.empty()) {
+        return T{};
+    }
+    auto rank = static_cast<std::size_t>(std::ceil(p / 100.f * sorted.size()));
+    return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+}
+
+/**
+ * @brief Adds the time until it is destroyed to the thread's ScopeTimings
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* label)
+        : timings_(ScopeTimings::current()), label_(label) {
+        if (timings_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ProfileScope() {
+        // The timings may have been uninstalled while inside the scope
+        if (timings_ && timings_ == ScopeTimings::current()) {
+            timings_->add(label_, std::chrono::steady_clock::now() - start_);
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    ScopeTimings* timings_;
+    const char* label_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#define RW_PROFILE_CONCAT_(a, b) a##b
+#define RW_PROFILE_CONCAT(a, b) RW_PROFILE_CONCAT_(a, b)
+#define RW_PROFILE_TIME_SCOPE(label) \
+    ProfileScope RW_PROFILE_CONCAT(rwProfileScope, __LINE__)(label)
+
 #ifdef RW_PROFILER
 #include <microprofile.h>
 #define RW_PROFILE_THREAD(name) MicroProfileOnThreadCreate(name)
 #define RW_PROFILE_FRAME_BOUNDARY() MicroProfileFlip(nullptr)
-#define RW_PROFILE_SCOPE(label) MICROPROFILE_SCOPEI("Default", label, MP_YELLOW)
-#define RW_PROFILE_SCOPEC(label, colour) MICROPROFILE_SCOPEI("Default", label, colour)
+#define RW_PROFILE_SCOPE(label) RW_PROFILE_TIME_SCOPE(label); MICROPROFILE_SCOPEI("Default", label, MP_YELLOW)
+#define RW_PROFILE_SCOPEC(label, colour) RW_PROFILE_TIME_SCOPE(label); MICROPROFILE_SCOPEI("Default", label, colour)
 #define RW_PROFILE_COUNTER_ADD(name, qty) MICROPROFILE_COUNTER_ADD(name, qty)
 #define RW_PROFILE_COUNTER_SET(name, qty) MICROPROFILE_COUNTER_SET(name, qty)
 #define RW_TIMELINE_ENTER(name, color) MICROPROFILE_TIMELINE_ENTER_STATIC(color, name)
@@ -14,8 +135,8 @@
 #else
 #define RW_PROFILE_THREAD(name) do {} while (0)
 #define RW_PROFILE_FRAME_BOUNDARY() do {} while (0)
-#define RW_PROFILE_SCOPE(label) do {} while (0)
-#define RW_PROFILE_SCOPEC(label, colour)  do {} while (0)
+#define RW_PROFILE_SCOPE(label) RW_PROFILE_TIME_SCOPE(label)
+#define RW_PROFILE_SCOPEC(label, colour) RW_PROFILE_TIME_SCOPE(label)
 #define RW_PROFILE_COUNTER_ADD(name, qty) do {} while (0)
 #define RW_PROFILE_COUNTER_SET(name, qty) do {} while (0)
 #define RW_TIMELINE_ENTER(name, color) do {} while (0)
@@ -75,6 +75,18 @@ public:
         return refcount_;
     }
 
+    /**
+     * Records the frame the model was last used to render, so the least
+     * recently used models can be evicted
+     */
+    void setLastUse(std::uint64_t frame) {
+        lastuse_ = frame;
+    }
+
+    std::uint64_t getLastUse() const {
+        return lastuse_;
+    }
+
     void setCollisionModel(std::unique_ptr<CollisionModel>& col);
 
     CollisionModel* getCollision() const {
@@ -106,6 +118,7 @@ private:
     ModelID modelid_ = 0;
     ModelDataType type_;
     int refcount_ = 0;
+    std::uint64_t lastuse_ = 0;
     std::unique_ptr<CollisionModel> collision;
 };
 
@@ -196,6 +209,7 @@ public:
 
     void unload() override {
         model_ = nullptr;
+        atomics_ = {};
     }
 
     enum {
@@ -10,58 +10,105 @@
 
 #include <algorithm>
 #include <cmath>
+#include <utility>
 
 Animator::Animator(const ClumpPtr& _model) : model(_model) {
 }
 
+const Animator::BoneBindings& Animator::bind(const AnimationPtr& animation) {
+    auto it = bindings.find(animation);
+    if (it != bindings.end()) {
+        return it->second;
+    }
+
+    BoneBindings bound;
+    const auto& bones = animation->bones;
+    bound.reserve(bones.size());
+    for (auto b = 0u; b < bones.size(); ++b) {
+        auto frame = model->findPoseIndex(animation->getFrameName(b));
+        if (frame < 0 || bones[b].getFrameCount() == 0) {
+            continue;
+        }
+        bound.push_back({&bones[b], static_cast<std::size_t>(frame)});
+    }
+
+    return bindings.emplace(animation, std::move(bound)).first->second;
+}
+
+void Animator::prepare(float dt) {
+    if (model == nullptr || animations.empty()) {
+        return;
+    }
+
+    sample(dt);
+    prepared = true;
+    preparedStep = dt;
+}
+
 void Animator::tick(float dt) {
     if (model == nullptr || animations.empty()) {
         return;
     }
 
-    struct BoneTransform {
-        glm::vec3 translation{};
-        glm::quat rotation{1.0f,0.0f,0.0f,0.0f};
-    };
+    if (!prepared || preparedStep != dt) {
+        sample(dt);
+    }
+    prepared = false;
+    applyPose();
 
     for (AnimationState& state : animations) {
         if (state.animation == nullptr) continue;
+        state.time = state.time + dt;
+    }
+}
 
-        if (state.boneInstances.empty()) {
-            for (auto& [name, bone] : state.animation->bones) {
-                auto frame = model->findFrame(name);
-                if (!frame) {
-                    continue;
-                }
-                state.boneInstances.emplace(&bone, frame);
-            }
-        }
+void Animator::sample(float dt) {
+    const auto& frames = model->getPoseFrames();
+    pose.clear();
 
-        state.time = state.time + dt;
+    for (AnimationState& state : animations) {
+        if (state.animation == nullptr) continue;
+
+        if (state.bindings == nullptr) {
+            state.bindings = &bind(state.animation);
+            state.cursors.assign(state.bindings->size(), 0);
+        }
 
-        float animTime = state.time;
+        float animTime = state.time + dt;
         if (!state.repeat) {
             animTime = std::min(animTime, state.animation->duration);
         } else {
             animTime = std::fmod(animTime, state.animation->duration);
         }
 
-        for (auto& [bonePtr, frame] : state.boneInstances) {
-            if (bonePtr->frames.empty()) continue;
-            auto kf = bonePtr->getInterpolatedKeyframe(animTime);
+        const auto& bound = *state.bindings;
+        for (auto b = 0u; b < bound.size(); ++b) {
+            const auto& [bone, frame] = bound[b];
+            auto kf = bone->getInterpolatedKeyframe(animTime, state.cursors[b]);
 
-            BoneTransform xform;
-            xform.rotation = kf.rotation;
-            if (bonePtr->type != AnimationBone::R00) {
-                xform.translation = kf.position;
+            glm::vec3 translation = frames[frame]->getDefaultTranslation();
+            if (bone->type != AnimationBone::R00) {
+                translation += kf.position;
             }
-            frame->setTranslation(frame->getDefaultTranslation() +
-                                     xform.translation);
-            frame->setRotation(glm::mat3_cast(xform.rotation));
+
+            glm::mat4 transform{glm::mat3_cast(kf.rotation)};
+            transform[3] = glm::vec4(translation, 1.f);
+            pose.emplace_back(frame, transform);
         }
     }
 }
 
+void Animator::applyPose() {
+    if (pose.empty()) {
+        return;
+    }
+
+    for (const auto& [frame, transform] : pose) {
+        model->setPoseTransform(frame, transform);
+    }
+    model->updatePose();
+}
+
 bool Animator::isCompleted(unsigned int slot) const {
     if (slot < animations.size()) {
         return animations[slot].animation
@@ -82,5 +129,6 @@ float Animator::getAnimationTime(unsigned int slot) const {
 void Animator::setAnimationTime(unsigned int slot, float time) {
     if (slot < animations.size()) {
         animations[slot].time = time;
+        prepared = false;
     }
 }
@@ -4,11 +4,15 @@
 #include <rw/debug.hpp>
 #include <rw/forward.hpp>
 
-#include <map>
+#include <glm/mat4x4.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 struct AnimationBone;
-class ModelFrame;
 
 /**
  * @brief calculates animation frame matrices, as well as procedural frame
@@ -21,6 +25,17 @@ class ModelFrame;
  * The Animator will blend all active animations together.
  */
 class Animator {
+    /**
+     * @brief A bone of an animation and the model frame it moves
+     */
+    struct BoneBinding {
+        const AnimationBone* bone;
+        /// Index of the frame in the model's pose
+        std::size_t frame;
+    };
+
+    using BoneBindings = std::vector<BoneBinding>;
+
     /**
      * @brief The AnimationState struct stores information about playing
      * animations
@@ -33,7 +48,9 @@ class Animator {
         float speed;
         /// Automatically restart
         bool repeat;
-        std::map<AnimationBone*, ModelFrame*> boneInstances;
+        const BoneBindings* bindings;
+        /// Keyframe each bone was last sampled at
+        std::vector<std::uint32_t> cursors;
     };
 
     /**
@@ -46,6 +63,31 @@ class Animator {
      */
     std::vector<AnimationState> animations;
 
+    /**
+     * @brief Bones of each animation played so far, bound to the model
+     */
+    std::unordered_map<AnimationPtr, BoneBindings> bindings;
+
+    const BoneBindings& bind(const AnimationPtr& animation);
+
+    /// Whether the pose was sampled by prepare() and is still current
+    bool prepared = false;
+    float preparedStep = 0.f;
+
+    /// Transform of each posed frame, sampled ahead of being applied
+    std::vector<std::pair<std::size_t, glm::mat4>> pose;
+
+    /**
+     * @brief Samples every animation advanced by dt into pose, without
+     * advancing them or changing the model
+     */
+    void sample(float dt);
+
+    /**
+     * @brief Applies the sampled pose to the model
+     */
+    void applyPose();
+
 public:
     Animator(const ClumpPtr& _model);
 
@@ -61,7 +103,8 @@ public:
         if (slot >= animations.size()) {
             animations.resize(slot + 1);
         }
-        animations[slot] = {anim, 0.f, speed, repeat, {}};
+        animations[slot] = {anim, 0.f, speed, repeat, nullptr, {}};
+        prepared = false;
     }
 
     void setAnimationSpeed(unsigned int slot, float speed) {
@@ -71,6 +114,16 @@ public:
         }
     }
 
+    /**
+     * @brief Samples the pose for the next tick(dt) ahead of time.
+     *
+     * Only touches this animator, so the animators of different objects can
+     * be prepared at the same time. The model keeps its current pose until
+     * the next tick(dt), which applies the prepared pose instead of sampling
+     * again, unless the animations were changed in between.
+     */
+    void prepare(float dt);
+
     /**
      * @brief tick Update animation paramters for server-side data.
      * @param dt
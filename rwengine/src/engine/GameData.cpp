@@ -34,7 +34,10 @@
 #include "platform/FileIndex.hpp"
 
 GameData::GameData(Logger* log, const rwfs::path& path)
-    : datpath(path), logger(log) {
+    : datpath(path)
+    , logger(log)
+    , residency(this, log)
+    , streamer(this, log) {
     dffLoader.setTextureLookupCallback(
         [&](const std::string& texture, const std::string&) {
             return findSlotTexture(currenttextureslot, texture);
@@ -172,9 +175,9 @@ void GameData::loadCOL(const size_t zone, const std::string& name) {
 
     LoaderCOL col;
 
-    auto systempath = index.findFilePath(name).string();
+    auto file = index.openFileView(name);
 
-    if (col.load(systempath)) {
+    if (col.load(file, name)) {
         // Associate loaded collisions with models
         for (auto& c : col.collisions) {
             // Find by name
@@ -372,7 +375,7 @@ void GameData::loadTXD(const std::string& name) {
 TextureArchive GameData::loadTextureArchive(const std::string& name) {
     RW_PROFILE_COUNTER_ADD("loadTextureArchive", 1);
     /// @todo refactor loadTXD to use correct file locations
-    auto file = index.openFile(name);
+    auto file = index.openFileView(name);
     if (!file.data) {
         logger->error("Data", "Failed to open txd: " + name);
         return {};
@@ -393,9 +396,10 @@ void GameData::loadToTextureArchive(const std::string& name,
                                   TextureArchive& archive) {
     RW_PROFILE_COUNTER_ADD("loadTextureArchive", 1);
     /// @todo refactor loadTXD to use correct file locations
-    auto file = index.openFile(name);
+    auto file = index.openFileView(name);
     if (!file.data) {
         logger->error("Data", "Failed to open txd: " + name);
+        return;
     }
 
     TextureLoader l;
@@ -413,7 +417,7 @@ void GameData::getNameAndLod(std::string& name, int& lod) {
 }
 
 ClumpPtr GameData::loadClump(const std::string& name) {
-    auto file = index.openFile(name);
+    auto file = index.openFileView(name);
     if (!file.data) {
         logger->error("Data", "Failed to load model " + name);
         return nullptr;
@@ -471,8 +475,37 @@ void GameData::loadModelFile(const std::string& name) {
 bool GameData::loadModel(ModelID model) {
     auto info = modelinfo[model].get();
     /// @todo replace openFile with API for loading from CDIMAGE archives
-    auto name = info->name;
-    auto slotname = info->textureslot;
+    std::string name, slotname;
+    getModelFiles(info, name, slotname);
+
+    /// @todo remove this from here
+    auto slotLoaded = textureSlots.find(slotname) != textureSlots.end();
+    loadTXD(slotname + ".txd");
+    if (!slotLoaded) {
+        residency.addTextureSlot(slotname);
+    }
+
+    auto file = index.openFileView(name + ".dff");
+    if (!file.data) {
+        logger->error("Data", "Failed to load model for " +
+                                  std::to_string(model) + " [" + name + "]");
+        return false;
+    }
+    auto m = dffLoader.loadFromMemory(file);
+    if (!m) {
+        logger->error("Data",
+                      "Error loading model file for " + std::to_string(model));
+        return false;
+    }
+
+    associateModel(info, m, slotname);
+    return true;
+}
+
+void GameData::getModelFiles(BaseModelInfo* info, std::string& name,
+                             std::string& slotname) const {
+    name = info->name;
+    slotname = info->textureslot;
 
     // Re-direct special models
     switch (info->type()) {
@@ -498,43 +531,31 @@ bool GameData::loadModel(ModelID model) {
     std::transform(name.begin(), name.end(), name.begin(), ::tolower);
     std::transform(slotname.begin(), slotname.end(), slotname.begin(),
                    ::tolower);
+}
 
-    /// @todo remove this from here
-    loadTXD(slotname + ".txd");
-
-    auto file = index.openFile(name + ".dff");
-    if (!file.data) {
-        logger->error("Data", "Failed to load model for " +
-                                  std::to_string(model) + " [" + name + "]");
-        return false;
-    }
-    auto m = dffLoader.loadFromMemory(file);
-    if (!m) {
-        logger->error("Data",
-                      "Error loading model file for " + std::to_string(model));
-        return false;
-    }
+void GameData::associateModel(BaseModelInfo* info, const ClumpPtr& model,
+                              const std::string& slotname) {
     /// @todo handle timeinfo models correctly.
     auto isSimple = info->type() == ModelDataType::SimpleInfo;
     if (isSimple) {
         auto simple = static_cast<SimpleModelInfo*>(info);
         // Associate atomics
-        for (auto& atomic : m->getAtomics()) {
+        for (auto& atomic : model->getAtomics()) {
             auto name = atomic->getFrame()->getName();
             int lod = 0;
             getNameAndLod(name, lod);
-            simple->setAtomic(m, lod, atomic);
+            simple->setAtomic(model, lod, atomic);
             auto identity = std::make_shared<ModelFrame>();
             atomic->setFrame(identity);
         }
     } else {
         // Associate clumps
         auto clump = static_cast<ClumpModelInfo*>(info);
-        clump->setModel(m);
+        clump->setModel(model);
         /// @todo how is LOD handled for clump objects?
     }
 
-    return true;
+    residency.addModel(info, model, slotname);
 }
 
 void GameData::loadIFP(const std::string& name, bool cutsceneAnimation) {
@@ -559,6 +580,13 @@ void GameData::loadWeaponDAT(const std::string& path) {
     auto syspath = index.findFilePath(path).string();
 
     l.loadWeapons(syspath, weaponData);
+
+    // Weapons are drawn and thrown without an object holding their model
+    for (const auto& weapon : weaponData) {
+        if (weapon.modelID != -1) {
+            residency.pinModel(weapon.modelID);
+        }
+    }
 }
 
 void GameData::loadPedStats(const std::string& path) {
@@ -21,6 +21,8 @@
 #include <data/WeaponData.hpp>
 #include <data/Weather.hpp>
 #include <data/ZoneData.hpp>
+#include <engine/ModelStreamer.hpp>
+#include <engine/ResidencyManager.hpp>
 #include <fonts/GameTexts.hpp>
 #include <loaders/LoaderDFF.hpp>
 #include <loaders/LoaderIMG.hpp>
@@ -160,6 +162,23 @@ public:
      */
     bool loadModel(ModelID model);
 
+    /**
+     * Determines the DFF and TXD names to load for a model, following the
+     * redirects used by special characters and cutscene objects.
+     * @param info The model to find the files of
+     * @param name Set to the lower case DFF name, without extension
+     * @param slotname Set to the lower case texture slot name
+     */
+    void getModelFiles(BaseModelInfo* info, std::string& name,
+                       std::string& slotname) const;
+
+    /**
+     * Associates a loaded model with the model info it was loaded for, and
+     * registers it with the residency manager
+     */
+    void associateModel(BaseModelInfo* info, const ClumpPtr& model,
+                        const std::string& slotname);
+
     /**
      * Loads an IFP file containing animations
      */
@@ -363,6 +382,16 @@ public:
      * Determines whether the given path is a valid game directory.
      */
     static bool isValidGameDirectory(const rwfs::path& path);
+
+    /**
+     * Tracks and evicts loaded models, see ResidencyManager
+     */
+    ResidencyManager residency;
+
+    /**
+     * Streams models in the background, see ModelStreamer
+     */
+    ModelStreamer streamer;
 };
 
 #endif
@@ -13,9 +13,11 @@
 
 #include <data/Clump.hpp>
 
+#include "core/JobPool.hpp"
 #include "core/Profiler.hpp"
 #include "core/Logger.hpp"
 
+#include "engine/Animator.hpp"
 #include "engine/GameData.hpp"
 #include "engine/GameState.hpp"
 #include "engine/Payphone.hpp"
@@ -54,18 +56,6 @@
 constexpr float kMaxTrafficSpawnRadius = 100.f;
 constexpr float kMaxTrafficCleanupRadius = kMaxTrafficSpawnRadius * 1.25f;
 
-namespace {
-template <typename T>
-bool shouldEffectBeRemoved(const T& effect, float gameTime) {
-    if (effect->getType() != Particle) {
-        return false;
-    }
-    auto particle = static_cast<ParticleFX*>(effect.get());
-    return particle->lifetime >= 0.f &&
-           gameTime >= particle->starttime + particle->lifetime;
-}
-}  // namespace
-
 class WorldCollisionDispatcher : public btCollisionDispatcher {
 public:
     WorldCollisionDispatcher(btCollisionConfiguration* collisionConfiguration)
@@ -101,6 +91,9 @@ GameWorld::GameWorld(Logger* log, GameData* dat)
 }
 
 GameWorld::~GameWorld() {
+    objectGrid.clear();
+    staticObjects.clear();
+
     // Bullet requires to remove each object before all physic world
     pedestrianPool.clear();
     instancePool.clear();
@@ -111,15 +104,42 @@ GameWorld::~GameWorld() {
 }
 
 bool GameWorld::placeItems(const std::string& name) {
+    return placeItems(std::vector<std::string>{name});
+}
+
+bool GameWorld::placeItems(const std::vector<std::string>& names) {
+    std::vector<GameObject*> statics;
+    staticObjects.getObjects(statics);
+
+    bool placed = true;
+    for (const auto& name : names) {
+        placed = placeInstances(name, statics) && placed;
+    }
+
+    // Indexing is done once, as it has to look at every static instance
+    staticObjects.build(statics);
+
+    return placed;
+}
+
+bool GameWorld::placeInstances(const std::string& name,
+                               std::vector<GameObject*>& statics) {
     LoaderIPL ipll;
 
     if (ipll.load(name)) {
         // Find the object.
         for (const auto& inst : ipll.m_instances) {
-            if (!createInstance(inst.id, inst.pos, inst.rot)) {
+            auto instance = createInstance(inst.id, inst.pos, inst.rot);
+            if (!instance) {
                 logger->error("World", "No object data for instance " +
                                            std::to_string(inst.id) + " in " +
                                            name);
+                continue;
+            }
+            // Dynamic objects can be moved by physics
+            if (!instance->dynamics) {
+                objectGrid.remove(instance);
+                statics.push_back(instance);
             }
         }
 
@@ -137,11 +157,8 @@ InstanceObject* GameWorld::createInstance(const uint16_t id,
                                           const glm::quat& rot) {
     auto oi = data->findModelInfo<SimpleModelInfo>(id);
     if (oi) {
-        // Request loading of the model if it isn't loaded already.
-        /// @todo implment streaming properly
-        if (!oi->isLoaded()) {
-            data->loadModel(oi->id());
-        }
+        // The model is streamed in by ObjectRenderer once the instance is
+        // within drawing distance, and rendered once it becomes resident.
 
         // Check for dynamic data.
         const auto dyIt = data->dynamicObjectData.find(oi->name);
@@ -162,8 +179,9 @@ InstanceObject* GameWorld::createInstance(const uint16_t id,
 
         auto ptr = instance.get();
 
-        instancePool.insert(std::move(instance));
-        allObjects.push_back(ptr);
+        if (!insertObject(std::move(instance))) {
+            return nullptr;
+        }
 
         modelInstances.emplace(oi->name, ptr);
 
@@ -234,8 +252,9 @@ CutsceneObject* GameWorld::createCutsceneObject(const uint16_t id,
     auto instance = std::make_unique<CutsceneObject>(this, pos, rot, model, modelinfo);
     auto ptr = instance.get();
 
-    cutscenePool.insert(std::move(instance));
-    allObjects.push_back(ptr);
+    if (!insertObject(std::move(instance))) {
+        return nullptr;
+    }
 
     return ptr;
 }
@@ -318,8 +337,9 @@ VehicleObject* GameWorld::createVehicle(const uint16_t id, const glm::vec3& pos,
     auto ptr = vehicle.get();
     vehicle->setGameObjectID(gid);
 
-    vehiclePool.insert(std::move(vehicle));
-    allObjects.push_back(ptr);
+    if (!insertObject(std::move(vehicle))) {
+        return nullptr;
+    }
 
     return ptr;
 }
@@ -342,8 +362,9 @@ CharacterObject* GameWorld::createPedestrian(const uint16_t id,
     auto ped = std::make_unique<CharacterObject>(this, pos, rot, pt, controller);
     auto ptr = ped.get();
     ped->setGameObjectID(gid);
-    pedestrianPool.insert(std::move(ped));
-    allObjects.push_back(ptr);
+    if (!insertObject(std::move(ped))) {
+        return nullptr;
+    }
     return ptr;
 }
 
@@ -371,9 +392,10 @@ CharacterObject* GameWorld::createPlayer(const glm::vec3& pos,
     auto ptr = ped.get();
     ped->setGameObjectID(gid);
     ped->setLifetime(GameObject::PlayerLifetime);
+    if (!insertObject(std::move(ped))) {
+        return nullptr;
+    }
     players.push_back(controller);
-    pedestrianPool.insert(std::move(ped));
-    allObjects.push_back(ptr);
     return ptr;
 }
 
@@ -424,8 +446,9 @@ PickupObject* GameWorld::createPickup(const glm::vec3& pos, int id, int type) {
 
     auto ptr = pickup.get();
 
-    pickupPool.insert(std::move(pickup));
-    allObjects.push_back(ptr);
+    if (!insertObject(std::move(pickup))) {
+        return nullptr;
+    }
 
     return ptr;
 }
@@ -443,35 +466,101 @@ Payphone* GameWorld::createPayphone(const glm::vec2 coord) {
     return payphones.back().get();
 }
 
-void GameWorld::ObjectPool::insert(std::unique_ptr<GameObject> object) {
-    if (object->getGameObjectID() == 0) {
-        // Find the lowest free GameObjectID.
-        GameObjectID availID = 1;
-        for (auto& [id, objectPtr] : objects) {
-            if (id == availID) availID++;
+bool GameWorld::ObjectPool::insert(std::unique_ptr<GameObject> object) {
+    auto id = object->getGameObjectID();
+    GameObjectID index;
+
+    if (id == 0) {
+        if (freeSlots.empty()) {
+            // Any more and the index would run into the generation
+            if (slots.size() > kIndexMask) {
+                RW_ERROR("Object pool exhausted");
+                return false;
+            }
+            index = static_cast<GameObjectID>(slots.size());
+            slots.emplace_back();
+        } else {
+            index = freeSlots.front();
+            freeSlots.pop_front();
+        }
+        id = (slots[index].generation << kIndexBits) | index;
+        object->setGameObjectID(id);
+    } else {
+        index = id & kIndexMask;
+        while (slots.size() <= index) {
+            if (slots.size() != index) {
+                freeSlots.push_back(static_cast<GameObjectID>(slots.size()));
+            }
+            slots.emplace_back();
         }
 
-        object->setGameObjectID(availID);
+        auto& slot = slots[index];
+        slot.generation = id >> kIndexBits;
+        if (slot.used) {
+            objects[slot.object] = {id, std::move(object)};
+            return true;
+        }
+        auto it = std::find(freeSlots.begin(), freeSlots.end(), index);
+        if (it != freeSlots.end()) {
+            freeSlots.erase(it);
+        }
     }
-    objects[object->getGameObjectID()] = std::move(object);
+
+    auto& slot = slots[index];
+    slot.used = true;
+    slot.object = objects.size();
+    objects.emplace_back(id, std::move(object));
+    return true;
 }
 
 GameObject* GameWorld::ObjectPool::find(GameObjectID id) const {
-    auto it = objects.find(id);
-    return (it == objects.end()) ? nullptr : it->second.get();
+    auto index = id & kIndexMask;
+    if (index >= slots.size()) {
+        return nullptr;
+    }
+    const auto& slot = slots[index];
+    if (!slot.used || slot.generation != id >> kIndexBits) {
+        return nullptr;
+    }
+    return objects[slot.object].second.get();
 }
 
 void GameWorld::ObjectPool::remove(GameObject* object) {
-    if (object) {
-        auto it = objects.find(object->getGameObjectID());
-        if (it != objects.end()) {
-            it = objects.erase(it);
-        }
+    if (!object || find(object->getGameObjectID()) != object) {
+        return;
+    }
+
+    auto index = object->getGameObjectID() & kIndexMask;
+    auto& slot = slots[index];
+
+    // Move the last object into the gap, the object is only destroyed once
+    // the pool is consistent again.
+    auto removed = std::move(objects[slot.object].second);
+    if (slot.object + 1 != objects.size()) {
+        objects[slot.object] = std::move(objects.back());
+        slots[objects[slot.object].first & kIndexMask].object = slot.object;
     }
+    objects.pop_back();
+
+    slot.used = false;
+    slot.generation = slot.generation < kMaxGeneration ? slot.generation + 1 : 1;
+    freeSlots.push_back(index);
 }
 
 void GameWorld::ObjectPool::clear() {
+    auto removed = std::move(objects);
     objects.clear();
+
+    // IDs of the removed objects have to stay stale
+    for (auto index = 0u; index < slots.size(); ++index) {
+        auto& slot = slots[index];
+        if (slot.used) {
+            slot.used = false;
+            slot.generation =
+                slot.generation < kMaxGeneration ? slot.generation + 1 : 1;
+            freeSlots.push_back(index);
+        }
+    }
 }
 
 GameWorld::ObjectPool& GameWorld::getTypeObjectPool(GameObject* object) {
@@ -509,9 +598,37 @@ GameObject* GameWorld::getBlipTarget(const BlipData& blip) const {
     }
 }
 
+GameObject* GameWorld::insertObject(std::unique_ptr<GameObject> object) {
+    auto ptr = object.get();
+    if (!getTypeObjectPool(ptr).insert(std::move(object))) {
+        return nullptr;
+    }
+
+    ptr->setWorldIndex(allObjects.size());
+    allObjects.push_back(ptr);
+
+    if (ptr->type() != GameObject::Cutscene) {
+        objectGrid.insert(ptr);
+    }
+
+    return ptr;
+}
+
+void GameWorld::updateObjectBounds(GameObject* object) {
+    if (staticObjects.contains(object)) {
+        if (staticObjects.update(object)) {
+            return;
+        }
+        staticObjects.remove(object);
+        objectGrid.insert(object);
+        return;
+    }
+    objectGrid.update(object);
+}
+
 void GameWorld::destroyObject(GameObject* object) {
-    auto& pool = getTypeObjectPool(object);
-    pool.remove(object);
+    objectGrid.remove(object);
+    staticObjects.remove(object);
 
     // Remove from mission objects
     if (state) {
@@ -519,11 +636,21 @@ void GameWorld::destroyObject(GameObject* object) {
         mO.erase(std::remove(mO.begin(), mO.end(), object), mO.end());
     }
 
-    auto it = std::find(allObjects.begin(), allObjects.end(), object);
-    RW_CHECK(it != allObjects.end(), "destroying object not in allObjects");
-    if (it != allObjects.end()) {
-        allObjects.erase(it);
+    // Objects added to allObjects directly don't know their index
+    auto index = object->getWorldIndex();
+    if (index >= allObjects.size() || allObjects[index] != object) {
+        auto it = std::find(allObjects.begin(), allObjects.end(), object);
+        RW_CHECK(it != allObjects.end(), "destroying object not in allObjects");
+        index = static_cast<std::size_t>(it - allObjects.begin());
     }
+    if (index < allObjects.size()) {
+        allObjects[index] = allObjects.back();
+        allObjects[index]->setWorldIndex(index);
+        allObjects.pop_back();
+    }
+
+    auto& pool = getTypeObjectPool(object);
+    pool.remove(object);
 }
 
 void GameWorld::destroyObjectQueued(GameObject* object) {
@@ -545,11 +672,8 @@ LightFX& GameWorld::createLightEffect() {
     return ref;
 }
 
-ParticleFX& GameWorld::createParticleEffect() {
-    auto effect = std::make_unique<ParticleFX>();
-    auto& ref = *effect;
-    effects.push_back(std::move(effect));
-    return ref;
+ParticleHandle GameWorld::createParticleEffect(const ParticleFX& particle) {
+    return particles.create(particle);
 }
 
 TrailFX& GameWorld::createTrailEffect() {
@@ -569,6 +693,10 @@ void GameWorld::destroyEffect(VisualFX& effect) {
     }
 }
 
+void GameWorld::destroyEffect(ParticleHandle particle) {
+    particles.destroy(particle);
+}
+
 void GameWorld::doWeaponScan(const WeaponScan& scan) {
     if (scan.type == ScanType::Radius) {
         HitTest test {*dynamicsWorld};
@@ -886,6 +1014,7 @@ void GameWorld::disableAIPaths(ai::NodeType type, const glm::vec3& min,
             }
         }
     }
+    aigraph.clearRouteCache();
 }
 
 void GameWorld::enableAIPaths(ai::NodeType type, const glm::vec3& min,
@@ -899,6 +1028,7 @@ void GameWorld::enableAIPaths(ai::NodeType type, const glm::vec3& min,
             }
         }
     }
+    aigraph.clearRouteCache();
 }
 
 void GameWorld::drawAreaIndicator(AreaIndicatorInfo::AreaIndicatorType type,
@@ -925,12 +1055,43 @@ bool GameWorld::isPaused() const {
 }
 
 void GameWorld::updateEffects() {
-    effects.erase(std::remove_if(effects.begin(), effects.end(),
-                                 [gameTime = getGameTime()](auto& effect) {
-                                     return shouldEffectBeRemoved(effect,
-                                                                  gameTime);
-                                 }),
-                  effects.end());
+    particles.removeExpired(getGameTime());
+}
+
+namespace {
+/// Animators prepared by each job, to keep the jobs larger than the cost
+/// of handing them out
+constexpr std::size_t kAnimationChunkSize = 16;
+}  // namespace
+
+void GameWorld::prepareAnimations(float dt, JobPool* jobs) {
+    RW_PROFILE_SCOPE(__func__);
+
+    std::vector<Animator*> animators;
+    animators.reserve(allObjects.size());
+    for (auto object : allObjects) {
+        if (object->animator) {
+            animators.push_back(object->animator.get());
+        }
+    }
+
+    const auto chunks =
+        (animators.size() + kAnimationChunkSize - 1) / kAnimationChunkSize;
+    auto prepareChunk = [&](std::size_t chunk) {
+        auto begin = chunk * kAnimationChunkSize;
+        auto end = std::min(begin + kAnimationChunkSize, animators.size());
+        for (auto i = begin; i < end; ++i) {
+            animators[i]->prepare(dt);
+        }
+    };
+
+    if (jobs) {
+        jobs->run(chunks, prepareChunk);
+    } else {
+        for (auto c = 0u; c < chunks; ++c) {
+            prepareChunk(c);
+        }
+    }
 }
 
 VehicleObject* GameWorld::tryToSpawnVehicle(VehicleGenerator& gen) {
@@ -1006,25 +1167,24 @@ bool GameWorld::isRaining() const {
 void GameWorld::clearObjectsWithinArea(const glm::vec3 center,
                                        const float radius,
                                        const bool clearParticles) {
-    // Vehicles
-    for (auto& obj : vehiclePool.objects) {
-        if (!obj.second->canBeRemoved()) {
-            continue;
-        }
-
-        if (glm::distance(center, obj.second->getPosition()) < radius) {
-            destroyObjectQueued(obj.second.get());
+    std::vector<GameObject*> nearby;
+    objectGrid.query(center, radius, nearby);
+
+    for (auto object : nearby) {
+        switch (object->type()) {
+            case GameObject::Vehicle:
+            case GameObject::Character:
+                break;
+            default:
+                continue;
         }
-    }
 
-    // Peds
-    for (auto& obj : pedestrianPool.objects) {
-        if (!obj.second->canBeRemoved()) {
+        if (!object->canBeRemoved()) {
             continue;
         }
 
-        if (glm::distance(center, obj.second->getPosition()) < radius) {
-            destroyObjectQueued(obj.second.get());
+        if (glm::distance(center, object->getPosition()) < radius) {
+            destroyObjectQueued(object);
         }
     }
 
@@ -1047,19 +1207,24 @@ GameWorld::findOverlappingObjects(const glm::vec3 &center,
                                   float radius) const {
     std::vector<GameObject*> overlapping;
 
-    auto checkObjects = [&](const auto& objects) {
-        for (auto& p : objects) {
-            const auto& object = p.second.get();
-            auto objectBounds = object->getClump()->getBoundingRadius();
-            if (glm::distance(center, object->getPosition()) <
-                radius + objectBounds) {
-                overlapping.push_back(object);
-            }
+    std::vector<GameObject*> nearby;
+    objectGrid.query(center, radius, nearby);
+
+    for (auto object : nearby) {
+        switch (object->type()) {
+            case GameObject::Vehicle:
+            case GameObject::Character:
+                break;
+            default:
+                continue;
         }
-    };
 
-    checkObjects(vehiclePool.objects);
-    checkObjects(pedestrianPool.objects);
+        auto objectBounds = object->getClump()->getBoundingRadius();
+        if (glm::distance(center, object->getPosition()) <
+            radius + objectBounds) {
+            overlapping.push_back(object);
+        }
+    }
 
     return overlapping;
 }
@@ -2,11 +2,13 @@
 #define _RWENGINE_GAMEWORLD_HPP_
 
 #include <cstdint>
+#include <deque>
 #include <map>
 #include <memory>
 #include <random>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #ifdef _MSC_VER
@@ -21,8 +23,12 @@
 #include <audio/SoundManager.hpp>
 #include <data/Chase.hpp>
 #include <engine/Garage.hpp>
+#include <engine/ObjectBVH.hpp>
+#include <engine/SpatialGrid.hpp>
 #include <objects/ObjectTypes.hpp>
+#include <render/VisualFX.hpp>
 
+class JobPool;
 class btCollisionDispatcher;
 class btDefaultCollisionConfiguration;
 class btDiscreteDynamicsWorld;
@@ -57,10 +63,6 @@ struct BlipData;
 struct WeaponScan;
 struct VehicleGenerator;
 
-struct LightFX;
-struct ParticleFX;
-struct TrailFX;
-struct VisualFX;
 
 /**
  * Information about "Goal" locations so they can be rendered
@@ -92,6 +94,12 @@ public:
      */
     bool placeItems(const std::string& name);
 
+    /**
+     * Loads several IPLs into the game, faster than loading them one by one
+     * @return false if any of them failed to load
+     */
+    bool placeItems(const std::vector<std::string>& names);
+
     /**
      * @brief createTraffic spawn transitory peds and vehicles
      * @param viewCamera The camera to create traffic near
@@ -164,6 +172,13 @@ public:
      */
     Payphone* createPayphone(const glm::vec2 coord);
 
+    /**
+     * Inserts a new object into its type's pool and the world's object
+     * lists, allocating it a GameObjectID if it doesn't have one.
+     * @return The inserted object, or nullptr if its pool is full
+     */
+    GameObject* insertObject(std::unique_ptr<GameObject> object);
+
     /**
      * Destroys an existing Object
      */
@@ -190,9 +205,9 @@ public:
     LightFX& createLightEffect();
 
     /**
-     * Allocates a new Particle Effect
+     * Adds a particle to the world's particle pool
      */
-    ParticleFX& createParticleEffect();
+    ParticleHandle createParticleEffect(const ParticleFX& particle);
 
     /**
      * Allocates a new Trail Effect
@@ -203,6 +218,7 @@ public:
      * Immediately destoys the given effect
      */
     void destroyEffect(VisualFX& effect);
+    void destroyEffect(ParticleHandle particle);
 
     /**
      * Returns the current hour
@@ -250,15 +266,25 @@ public:
     /**
      * Each object type is allocated from a pool. This object helps manage
      * the individual pools.
+     *
+     * Objects are kept in a generational slot map: a GameObjectID holds the
+     * index of the object's slot and the slot's generation, which changes
+     * every time the slot is freed. Insertion, lookup and removal are
+     * constant time, and an ID held onto after its object was destroyed
+     * never finds the object that reuses the slot.
      */
     struct ObjectPool {
-        std::map<GameObjectID, std::unique_ptr<GameObject>> objects;
+        /// Live objects, stored contiguously in no particular order
+        std::vector<std::pair<GameObjectID, std::unique_ptr<GameObject>>>
+            objects;
 
         /**
          * Allocates the game object a GameObjectID and inserts it into
-         * the pool
+         * the pool. An object that already has an ID replaces any object
+         * using its slot.
+         * @return false if every slot is in use, the object is destroyed
          */
-        void insert(std::unique_ptr<GameObject> object);
+        bool insert(std::unique_ptr<GameObject> object);
 
         /**
          * Removes a game object from this pool
@@ -267,6 +293,7 @@ public:
 
         /**
          * Finds a game object if it exists in this pool
+         * @return The object, or nullptr if the ID is stale
          */
         GameObject* find(GameObjectID id) const;
 
@@ -274,10 +301,27 @@ public:
          * Removes all stored objects
          */
         void clear();
+
+    private:
+        static constexpr int kIndexBits = 20;
+        static constexpr GameObjectID kIndexMask = (1u << kIndexBits) - 1;
+        /// Keeps IDs positive when used as script integers
+        static constexpr GameObjectID kMaxGeneration = (1u << 11) - 1;
+
+        struct Slot {
+            GameObjectID generation = 1;
+            /// Index of the slot's object in objects
+            std::size_t object = 0;
+            bool used = false;
+        };
+
+        std::vector<Slot> slots;
+        /// Freed slots are reused oldest first, delaying generation reuse
+        std::deque<GameObjectID> freeSlots;
     };
 
     /**
-     * Stores all game objects
+     * Stores all game objects, in no particular order
      */
     std::vector<GameObject*> allObjects;
 
@@ -290,6 +334,25 @@ public:
 
     ObjectPool& getTypeObjectPool(GameObject* object);
 
+    /**
+     * Spatial index of every object with a meaningful world position, for
+     * finding objects in an area. Cutscene objects aren't indexed, and
+     * neither are the static objects in staticObjects.
+     */
+    SpatialGrid objectGrid;
+
+    /**
+     * Instances placed by placeItems that aren't expected to move, which
+     * are removed from objectGrid. Any that do move are moved back to it.
+     */
+    ObjectBVH staticObjects;
+
+    /**
+     * Updates the object's entry in the spatial indices after it has moved
+     * or its bounds have changed
+     */
+    void updateObjectBounds(GameObject* object);
+
     std::vector<ai::PlayerController*> players;
 
     std::vector<std::unique_ptr<Garage>> garages;
@@ -319,6 +382,11 @@ public:
      */
     std::vector<std::unique_ptr<VisualFX>> effects;
 
+    /**
+     * Particles, which are removed once their lifetime is over
+     */
+    ParticlePool particles;
+
     /**
      * Bullet
      */
@@ -385,10 +453,19 @@ public:
     bool isPaused() const;
 
     /**
-     * Clean up old VisualFX
+     * Clean up expired particles
      */
     void updateEffects();
 
+    /**
+     * Poses every animated object for its next tick ahead of time, spread
+     * over jobs if there are any.
+     *
+     * Each object only touches its own animator and model, so the result
+     * is the same for any number of threads.
+     */
+    void prepareAnimations(float dt, JobPool* jobs = nullptr);
+
     /**
      * Attempt to spawn a vehicle at a vehicle generator
      */
@@ -444,6 +521,13 @@ private:
      * Randomness Engine
      */
     std::default_random_engine randomNumberGen{std::random_device()()};
+
+    /**
+     * Creates the instances in an IPL, adding those that are static to
+     * statics instead of indexing them
+     */
+    bool placeInstances(const std::string& name,
+                        std::vector<GameObject*>& statics);
 };
 
 #endif
@@ -38,12 +38,9 @@ Garage::Garage(GameWorld* engine_, size_t id_, const glm::vec3& coord0,
     for (const auto& p : engine->instancePool.objects) {
         const auto inst = static_cast<InstanceObject*>(p.second.get());
 
-        if (!inst->getClump()) {
-            continue;
-        }
-
-        if (!SimpleModelInfo::isDoorModel(
-                inst->getModelInfo<BaseModelInfo>()->name)) {
+        // The door's model may not have been streamed in yet
+        const auto modelinfo = inst->getModelInfo<BaseModelInfo>();
+        if (!modelinfo || !SimpleModelInfo::isDoorModel(modelinfo->name)) {
             continue;
         }
 
@@ -0,0 +1,276 @@
+#include "engine/ModelStreamer.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include <glm/glm.hpp>
+
+#include <data/Clump.hpp>
+#include <loaders/LoaderDFF.hpp>
+#include <loaders/LoaderTXD.hpp>
+#include <platform/FileHandle.hpp>
+
+#include "core/Logger.hpp"
+#include "core/Profiler.hpp"
+#include "engine/GameData.hpp"
+
+namespace {
+constexpr unsigned int kMaxStreamingWorkers = 4;
+/// Distance the camera has to move before the queue is re-prioritised
+constexpr float kReprioritiseDistance = 20.f;
+/// Most results uploaded per update, to spread the GL work over frames
+constexpr std::size_t kMaxUploadsPerUpdate = 16;
+
+/// Heap order placing the nearest request at the front
+const auto kNearestFirst = [](const auto& a, const auto& b) {
+    return a.priority > b.priority;
+};
+}  // namespace
+
+ModelStreamer::ModelStreamer(GameData* data, Logger* logger)
+    : data(data), logger(logger) {
+}
+
+ModelStreamer::~ModelStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void ModelStreamer::startWorkers() {
+    auto count = std::thread::hardware_concurrency();
+    // Leave a core for the main thread
+    count = std::clamp(count > 1 ? count - 1 : 1u, 1u, kMaxStreamingWorkers);
+    for (auto i = 0u; i < count; ++i) {
+        workers_.emplace_back(&ModelStreamer::workerMain, this);
+    }
+}
+
+void ModelStreamer::request(ModelID model, const glm::vec3& position) {
+    auto it = pending_.find(model);
+    if (it != pending_.end()) {
+        if (glm::distance(position, cameraPosition_) <
+            glm::distance(it->second, cameraPosition_)) {
+            it->second = position;
+            needsPrioritise_ = true;
+        }
+        return;
+    }
+
+    auto info = data->modelinfo.find(model);
+    if (info == data->modelinfo.end() || info->second->isLoaded()) {
+        return;
+    }
+
+    Request req;
+    req.id = model;
+    req.priority = glm::distance(position, cameraPosition_);
+    data->getModelFiles(info->second.get(), req.modelName, req.textureSlot);
+    req.loadSlot = data->textureSlots.find(req.textureSlot) ==
+                       data->textureSlots.end() &&
+                   pendingSlots_.find(req.textureSlot) == pendingSlots_.end();
+    if (req.loadSlot) {
+        pendingSlots_.insert(req.textureSlot);
+    }
+
+    pending_[model] = position;
+    enqueue(std::move(req));
+}
+
+void ModelStreamer::enqueue(Request request) {
+    if (workers_.empty()) {
+        startWorkers();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.push_back(std::move(request));
+        std::push_heap(queue_.begin(), queue_.end(), kNearestFirst);
+    }
+    wake_.notify_one();
+}
+
+void ModelStreamer::workerMain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [&] { return stopping_ || !queue_.empty(); });
+        if (stopping_) {
+            return;
+        }
+
+        std::pop_heap(queue_.begin(), queue_.end(), kNearestFirst);
+        auto req = std::move(queue_.back());
+        queue_.pop_back();
+        busy_++;
+
+        lock.unlock();
+        auto result = decode(req);
+        lock.lock();
+
+        results_.push_back(std::move(result));
+        busy_--;
+        done_.notify_all();
+    }
+}
+
+ModelStreamer::Result ModelStreamer::decode(const Request& request) {
+    Result result{request.id, request.modelName, request.textureSlot,
+                  request.loadSlot, nullptr, {}};
+
+    if (request.loadSlot) {
+        auto file = data->index.openFileView(request.textureSlot + ".txd");
+        if (file.data) {
+            TextureLoader loader;
+            if (!loader.decodeFromMemory(file, result.textures)) {
+                result.textures.clear();
+            }
+        }
+    }
+
+    auto file = data->index.openFileView(request.modelName + ".dff");
+    if (!file.data) {
+        return result;
+    }
+
+    // Textures are resolved when the result is completed, as the texture
+    // slots may only be accessed from the main thread.
+    LoaderDFF loader;
+    try {
+        result.model = loader.decodeFromMemory(file);
+    } catch (DFFLoaderException& e) {
+        RW_ERROR("Error decoding " << request.modelName << ": " << e.which());
+    }
+
+    return result;
+}
+
+void ModelStreamer::update(const glm::vec3& cameraPosition) {
+    RW_PROFILE_SCOPE(__func__);
+    cameraPosition_ = cameraPosition;
+    auto moved = glm::distance(cameraPosition_, prioritisedPosition_);
+    if (needsPrioritise_ || moved > kReprioritiseDistance) {
+        reprioritise();
+    }
+
+    std::vector<Result> results;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        results.swap(results_);
+    }
+    RW_PROFILE_COUNTER_SET("streaming/results", results.size());
+
+    // Results that load a texture slot go first, so that the models sharing
+    // it can resolve their textures in the same update.
+    std::stable_partition(results.begin(), results.end(),
+                          [](const Result& r) { return r.loadSlot; });
+    std::move(results.begin(), results.end(), std::back_inserter(deferred_));
+
+    std::size_t uploads = 0;
+    std::vector<Result> waiting;
+    for (auto& result : deferred_) {
+        if (uploads >= kMaxUploadsPerUpdate || !complete(result)) {
+            waiting.push_back(std::move(result));
+            continue;
+        }
+        uploads++;
+    }
+    deferred_.swap(waiting);
+}
+
+void ModelStreamer::finish() {
+    while (!pending_.empty()) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_.wait(lock, [&] {
+                return !results_.empty() || (queue_.empty() && busy_ == 0);
+            });
+        }
+        auto remaining = pending_.size();
+        update(cameraPosition_);
+        if (pending_.size() == remaining && deferred_.empty()) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (queue_.empty() && busy_ == 0 && results_.empty()) {
+                // Nothing left in flight can complete the rest
+                break;
+            }
+        }
+    }
+}
+
+bool ModelStreamer::complete(Result& result) {
+    if (result.loadSlot) {
+        auto& slots = data->textureSlots;
+        if (slots.find(result.textureSlot) == slots.end()) {
+            TextureLoader::upload(result.textures);
+            slots[result.textureSlot] = std::move(result.textures);
+            data->residency.addTextureSlot(result.textureSlot);
+        }
+        pendingSlots_.erase(result.textureSlot);
+        result.loadSlot = false;
+    } else if (pendingSlots_.find(result.textureSlot) != pendingSlots_.end()) {
+        return false;
+    } else if (data->textureSlots.find(result.textureSlot) ==
+               data->textureSlots.end()) {
+        // The slot was evicted while the model was streaming, so stream the
+        // model again along with the slot rather than loading it here
+        Request req{result.id,
+                    glm::distance(pending_[result.id], cameraPosition_),
+                    result.modelName, result.textureSlot, true};
+        pendingSlots_.insert(req.textureSlot);
+        enqueue(std::move(req));
+        return true;
+    }
+
+    pending_.erase(result.id);
+
+    auto it = data->modelinfo.find(result.id);
+    if (it == data->modelinfo.end() || it->second->isLoaded()) {
+        // Loaded synchronously while streaming
+        return true;
+    }
+    auto info = it->second.get();
+
+    // The model may have been redirected to another special model since it
+    // was requested, in which case the result is stale.
+    std::string modelName, textureSlot;
+    data->getModelFiles(info, modelName, textureSlot);
+    if (modelName != result.modelName) {
+        return true;
+    }
+
+    if (!result.model) {
+        logger->error("Data", "Failed to stream model for " +
+                                  std::to_string(result.id) + " [" +
+                                  result.modelName + "]");
+        return true;
+    }
+
+    for (const auto& atomic : result.model->getAtomics()) {
+        for (auto& material : atomic->getGeometry()->materials) {
+            for (auto& texture : material.textures) {
+                texture.texture =
+                    data->findSlotTexture(result.textureSlot, texture.name);
+            }
+        }
+    }
+
+    result.model->upload();
+    data->associateModel(info, result.model, result.textureSlot);
+    return true;
+}
+
+void ModelStreamer::reprioritise() {
+    prioritisedPosition_ = cameraPosition_;
+    needsPrioritise_ = false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& req : queue_) {
+        req.priority = glm::distance(pending_[req.id], cameraPosition_);
+    }
+    std::make_heap(queue_.begin(), queue_.end(), kNearestFirst);
+}
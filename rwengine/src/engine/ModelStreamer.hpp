@@ -0,0 +1,140 @@
+#ifndef _RWENGINE_MODELSTREAMER_HPP_
+#define _RWENGINE_MODELSTREAMER_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+#include <gl/TextureData.hpp>
+#include <rw/forward.hpp>
+
+#include <data/ModelData.hpp>
+
+class GameData;
+class Logger;
+
+/**
+ * @brief Loads models in the background, nearest to the camera first.
+ *
+ * Requests are queued on the main thread and picked up by a pool of worker
+ * threads, which read and decode the model's DFF, and its TXD if the
+ * texture slot isn't loaded yet. Decoding doesn't touch GL, so the results
+ * are handed back to the main thread, which uploads them and associates
+ * them with the model info in update().
+ *
+ * Objects using a model that is still streaming should check isLoaded() on
+ * the model info and only render once it is resident.
+ */
+class ModelStreamer {
+public:
+    ModelStreamer(GameData* data, Logger* logger);
+
+    ~ModelStreamer();
+
+    ModelStreamer(const ModelStreamer&) = delete;
+    ModelStreamer& operator=(const ModelStreamer&) = delete;
+
+    /**
+     * Queues the model for loading if it isn't loaded or queued already.
+     * Requesting a queued model again may raise its priority.
+     * @param model The model to load
+     * @param position Where the model is needed, used to prioritise it
+     */
+    void request(ModelID model, const glm::vec3& position);
+
+    /**
+     * Uploads and associates models the workers have finished decoding,
+     * and re-prioritises the queue if the camera has moved.
+     * Must be called on the thread owning the GL context.
+     * @param cameraPosition Position the queue is prioritised around
+     */
+    void update(const glm::vec3& cameraPosition);
+
+    /**
+     * Blocks until every queued model has been loaded.
+     */
+    void finish();
+
+    /**
+     * @return true if the model has been requested but isn't resident yet
+     */
+    bool isPending(ModelID model) const {
+        return pending_.find(model) != pending_.end();
+    }
+
+    /**
+     * @return The number of requested models that aren't resident yet
+     */
+    std::size_t getPendingCount() const {
+        return pending_.size();
+    }
+
+private:
+    struct Request {
+        ModelID id;
+        /// Lower values are loaded first
+        float priority;
+        std::string modelName;
+        std::string textureSlot;
+        /// The texture slot has to be decoded along with the model
+        bool loadSlot;
+    };
+
+    struct Result {
+        ModelID id;
+        std::string modelName;
+        std::string textureSlot;
+        bool loadSlot;
+        ClumpPtr model;
+        TextureArchive textures;
+    };
+
+    void startWorkers();
+
+    /// Hands the request to the workers
+    void enqueue(Request request);
+
+    void workerMain();
+
+    Result decode(const Request& request);
+
+    /// @return false if the result has to wait for its texture slot, true
+    /// once it's been used or queued again
+    bool complete(Result& result);
+
+    void reprioritise();
+
+    GameData* data;
+    Logger* logger;
+
+    /// Protects the queue, results and stopping flag
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    /// Heap of waiting requests, nearest first
+    std::vector<Request> queue_;
+    std::vector<Result> results_;
+    std::size_t busy_ = 0;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+
+    /// Main thread only: requested models that aren't resident yet, with
+    /// the position nearest to the camera each was requested at
+    std::unordered_map<ModelID, glm::vec3> pending_;
+    /// Main thread only: texture slots being decoded by a request
+    std::unordered_set<std::string> pendingSlots_;
+    /// Results waiting for another request to load their texture slot
+    std::vector<Result> deferred_;
+    glm::vec3 cameraPosition_{};
+    glm::vec3 prioritisedPosition_{};
+    bool needsPrioritise_ = false;
+};
+
+#endif
@@ -0,0 +1,220 @@
+#include "engine/ObjectBVH.hpp"
+
+#include <algorithm>
+
+#include <glm/glm.hpp>
+
+#include "core/Profiler.hpp"
+#include "engine/SpatialGrid.hpp"
+#include "objects/GameObject.hpp"
+#include "render/ViewFrustum.hpp"
+
+namespace {
+enum class Containment { Outside, Intersecting, Inside };
+
+Containment classify(const ViewFrustum& frustum, const glm::vec3& min,
+                     const glm::vec3& max) {
+    auto result = Containment::Inside;
+    for (const auto& plane : frustum.planes) {
+        // The corners furthest along and against the plane's normal
+        glm::vec3 positive(plane.normal.x >= 0.f ? max.x : min.x,
+                           plane.normal.y >= 0.f ? max.y : min.y,
+                           plane.normal.z >= 0.f ? max.z : min.z);
+        glm::vec3 negative(plane.normal.x >= 0.f ? min.x : max.x,
+                           plane.normal.y >= 0.f ? min.y : max.y,
+                           plane.normal.z >= 0.f ? min.z : max.z);
+        if (glm::dot(plane.normal, positive) + plane.distance < 0.f) {
+            return Containment::Outside;
+        }
+        if (glm::dot(plane.normal, negative) + plane.distance < 0.f) {
+            result = Containment::Intersecting;
+        }
+    }
+    return result;
+}
+
+bool sphereIntersectsBox(const glm::vec3& center, float radius,
+                         const glm::vec3& min, const glm::vec3& max) {
+    auto nearest = glm::clamp(center, min, max);
+    auto d = nearest - center;
+    return glm::dot(d, d) <= radius * radius;
+}
+}  // namespace
+
+void ObjectBVH::build(const std::vector<GameObject*>& objects) {
+    RW_PROFILE_SCOPE(__func__);
+    clear();
+
+    objects_.reserve(objects.size());
+    for (auto object : objects) {
+        objects_.push_back({object, object->getPosition(),
+                            SpatialGrid::getBoundingRadius(object), false});
+    }
+    if (objects_.empty()) {
+        return;
+    }
+
+    nodes_.reserve(2 * objects_.size() / kMaxLeafObjects + 1);
+    buildNode(0, 0, static_cast<std::uint32_t>(objects_.size()));
+
+    for (auto leaf = 0u; leaf < nodes_.size(); ++leaf) {
+        const auto& node = nodes_[leaf];
+        if (node.next != leaf + 1) {
+            continue;
+        }
+        for (auto i = node.first; i < node.end; ++i) {
+            items_[objects_[i].object] = {i, leaf};
+        }
+    }
+}
+
+void ObjectBVH::buildNode(std::uint32_t parent, std::uint32_t first,
+                          std::uint32_t count) {
+    auto index = static_cast<std::uint32_t>(nodes_.size());
+    nodes_.emplace_back();
+
+    auto begin = objects_.begin() + first;
+    auto end = begin + count;
+
+    // Bounds of the object spheres, and of their centers to split along
+    glm::vec3 min = begin->position - begin->radius;
+    glm::vec3 max = begin->position + begin->radius;
+    glm::vec3 centerMin = begin->position;
+    glm::vec3 centerMax = begin->position;
+    for (auto it = begin; it != end; ++it) {
+        min = glm::min(min, it->position - it->radius);
+        max = glm::max(max, it->position + it->radius);
+        centerMin = glm::min(centerMin, it->position);
+        centerMax = glm::max(centerMax, it->position);
+    }
+
+    nodes_[index].min = min;
+    nodes_[index].max = max;
+    nodes_[index].parent = parent;
+    nodes_[index].first = first;
+    nodes_[index].end = first + count;
+
+    if (count > kMaxLeafObjects) {
+        // Split at the median along the widest axis
+        auto extent = centerMax - centerMin;
+        int axis = 0;
+        if (extent.y > extent[axis]) axis = 1;
+        if (extent.z > extent[axis]) axis = 2;
+
+        auto half = count / 2;
+        std::nth_element(begin, begin + half, end,
+                         [axis](const Item& a, const Item& b) {
+                             return a.position[axis] < b.position[axis];
+                         });
+
+        buildNode(index, first, half);
+        buildNode(index, first + half, count - half);
+    }
+
+    nodes_[index].next = static_cast<std::uint32_t>(nodes_.size());
+}
+
+void ObjectBVH::clear() {
+    nodes_.clear();
+    objects_.clear();
+    items_.clear();
+}
+
+bool ObjectBVH::remove(GameObject* object) {
+    auto it = items_.find(object);
+    if (it == items_.end()) {
+        return false;
+    }
+    objects_[it->second.item].removed = true;
+    items_.erase(it);
+    return true;
+}
+
+bool ObjectBVH::update(GameObject* object) {
+    auto it = items_.find(object);
+    if (it == items_.end()) {
+        return false;
+    }
+    auto& item = objects_[it->second.item];
+    if (object->getPosition() != item.position) {
+        return false;
+    }
+
+    item.radius = SpatialGrid::getBoundingRadius(object);
+    auto min = item.position - item.radius;
+    auto max = item.position + item.radius;
+    for (auto index = it->second.leaf;; index = nodes_[index].parent) {
+        auto& node = nodes_[index];
+        node.min = glm::min(node.min, min);
+        node.max = glm::max(node.max, max);
+        if (index == 0) {
+            break;
+        }
+    }
+    return true;
+}
+
+void ObjectBVH::getObjects(std::vector<GameObject*>& out) const {
+    for (const auto& item : objects_) {
+        if (!item.removed) {
+            out.push_back(item.object);
+        }
+    }
+}
+
+void ObjectBVH::query(const glm::vec3& center, float radius,
+                      std::vector<GameObject*>& out) const {
+    std::uint32_t index = 0;
+    while (index < nodes_.size()) {
+        const auto& node = nodes_[index];
+        if (!sphereIntersectsBox(center, radius, node.min, node.max)) {
+            index = node.next;
+            continue;
+        }
+        if (node.next == index + 1) {
+            for (auto i = node.first; i < node.end; ++i) {
+                const auto& item = objects_[i];
+                auto d = item.position - center;
+                auto r = radius + item.radius;
+                if (!item.removed && glm::dot(d, d) <= r * r) {
+                    out.push_back(item.object);
+                }
+            }
+        }
+        index++;
+    }
+}
+
+void ObjectBVH::query(const ViewFrustum& frustum,
+                      std::vector<GameObject*>& out) const {
+    std::uint32_t index = 0;
+    while (index < nodes_.size()) {
+        const auto& node = nodes_[index];
+        auto containment = classify(frustum, node.min, node.max);
+        if (containment == Containment::Outside) {
+            index = node.next;
+            continue;
+        }
+
+        if (containment == Containment::Inside) {
+            for (auto i = node.first; i < node.end; ++i) {
+                if (!objects_[i].removed) {
+                    out.push_back(objects_[i].object);
+                }
+            }
+            index = node.next;
+            continue;
+        }
+
+        if (node.next == index + 1) {
+            for (auto i = node.first; i < node.end; ++i) {
+                const auto& item = objects_[i];
+                if (!item.removed &&
+                    frustum.intersects(item.position, item.radius)) {
+                    out.push_back(item.object);
+                }
+            }
+        }
+        index++;
+    }
+}
@@ -0,0 +1,118 @@
+#ifndef _RWENGINE_OBJECTBVH_HPP_
+#define _RWENGINE_OBJECTBVH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+class GameObject;
+class ViewFrustum;
+
+/**
+ * @brief Bounding volume hierarchy over objects that don't move.
+ *
+ * The tree is built once from a list of objects, storing each with the
+ * bounding sphere it had at the time. Queries cull whole subtrees against
+ * their bounding boxes, and subtrees entirely inside a frustum are taken
+ * without testing their objects.
+ *
+ * The tree isn't refitted: objects that are destroyed are only marked as
+ * removed, and objects that outgrow their sphere have to be removed and
+ * tracked elsewhere.
+ */
+class ObjectBVH {
+public:
+    /// Most objects stored in a leaf
+    static constexpr std::size_t kMaxLeafObjects = 8;
+
+    /**
+     * Replaces the tree with one holding the given objects
+     */
+    void build(const std::vector<GameObject*>& objects);
+
+    void clear();
+
+    /**
+     * Marks the object as removed
+     * @return false if the object isn't in the tree
+     */
+    bool remove(GameObject* object);
+
+    bool contains(GameObject* object) const {
+        return items_.find(object) != items_.end();
+    }
+
+    /**
+     * Grows the object's sphere to its current bounds, refitting the
+     * nodes above it. Objects are expected to stay where they were.
+     * @return false if the object has moved or isn't in the tree
+     */
+    bool update(GameObject* object);
+
+    /**
+     * Appends the objects that haven't been removed to the list
+     */
+    void getObjects(std::vector<GameObject*>& out) const;
+
+    /**
+     * Finds objects whose bounding sphere intersects the given sphere
+     * @param out Receives the objects, it is not cleared beforehand
+     */
+    void query(const glm::vec3& center, float radius,
+               std::vector<GameObject*>& out) const;
+
+    /**
+     * Finds objects whose bounding sphere intersects the frustum
+     * @param out Receives the objects, it is not cleared beforehand
+     */
+    void query(const ViewFrustum& frustum,
+               std::vector<GameObject*>& out) const;
+
+    std::size_t size() const {
+        return items_.size();
+    }
+
+    std::size_t getNodeCount() const {
+        return nodes_.size();
+    }
+
+private:
+    struct Item {
+        GameObject* object;
+        glm::vec3 position;
+        float radius;
+        bool removed;
+    };
+
+    /// Nodes are stored depth first, so a node's first child follows it
+    /// and a subtree's objects are contiguous
+    struct Node {
+        glm::vec3 min;
+        glm::vec3 max;
+        std::uint32_t parent;
+        /// Index of the node following this subtree
+        std::uint32_t next;
+        /// Range of the subtree's objects in objects_
+        std::uint32_t first;
+        std::uint32_t end;
+    };
+
+    struct Location {
+        /// Index in objects_
+        std::uint32_t item;
+        /// Index of the leaf in nodes_
+        std::uint32_t leaf;
+    };
+
+    void buildNode(std::uint32_t parent, std::uint32_t first,
+                   std::uint32_t count);
+
+    std::vector<Node> nodes_;
+    std::vector<Item> objects_;
+    std::unordered_map<GameObject*, Location> items_;
+};
+
+#endif
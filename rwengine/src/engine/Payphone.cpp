@@ -16,10 +16,8 @@ Payphone::Payphone(GameWorld* engine_, size_t id_, const glm::vec2& coord)
     // Find payphone object, original game does this differently
     for (const auto& p : engine->instancePool.objects) {
         auto o = p.second.get();
-        if (!o->getClump()) {
-            continue;
-        }
-        if (o->getModelInfo<BaseModelInfo>()->name != "phonebooth1") {
+        const auto modelinfo = o->getModelInfo<BaseModelInfo>();
+        if (!modelinfo || modelinfo->name != "phonebooth1") {
             continue;
         }
         if (glm::distance(coord, glm::vec2(o->getPosition())) < 2.f) {
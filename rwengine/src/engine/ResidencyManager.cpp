@@ -0,0 +1,203 @@
+#include "engine/ResidencyManager.hpp"
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include <data/Clump.hpp>
+
+#include "core/Logger.hpp"
+#include "core/Profiler.hpp"
+#include "engine/GameData.hpp"
+#include "engine/GameWorld.hpp"
+#include "objects/GameObject.hpp"
+
+namespace {
+/// Models used within this many frames are never evicted
+constexpr std::uint64_t kMinIdleFrames = 120;
+/// Frames to wait between evictions, while over budget
+constexpr std::uint64_t kEvictionInterval = 30;
+}  // namespace
+
+ResidencyManager::ResidencyManager(GameData* data, Logger* logger)
+    : data(data), logger(logger) {
+}
+
+void ResidencyManager::addModel(BaseModelInfo* info, const ClumpPtr& model,
+                                const std::string& slot) {
+    auto existing = models_.find(info->id());
+    if (existing != models_.end()) {
+        // The model was loaded again, so its entry is replaced. Its old
+        // textures went with it, so the slot doesn't have to be pinned.
+        const auto& old = existing->second;
+        modelMemory_.cpu -= old.memory.cpu;
+        modelMemory_.gpu -= old.memory.gpu;
+        auto slotIt = slots_.find(old.slot);
+        if (slotIt != slots_.end()) {
+            slotIt->second.users--;
+        }
+        models_.erase(existing);
+    }
+
+    ModelEntry entry{info, model, slot, {model->getCPUSize(),
+                                         model->getGPUSize()}};
+    modelMemory_.cpu += entry.memory.cpu;
+    modelMemory_.gpu += entry.memory.gpu;
+
+    auto slotIt = slots_.find(slot);
+    if (slotIt != slots_.end()) {
+        slotIt->second.users++;
+    }
+
+    info->setLastUse(frame_);
+    models_.emplace(info->id(), std::move(entry));
+}
+
+void ResidencyManager::addTextureSlot(const std::string& slot) {
+    auto archiveIt = data->textureSlots.find(slot);
+    if (archiveIt == data->textureSlots.end() ||
+        slots_.find(slot) != slots_.end()) {
+        return;
+    }
+
+    SlotEntry entry;
+    for (const auto& texture : archiveIt->second) {
+        entry.memory.cpu += texture.second->getCPUSize();
+        entry.memory.gpu += texture.second->getGPUSize();
+    }
+    entry.lastUse = frame_;
+
+    textureMemory_.cpu += entry.memory.cpu;
+    textureMemory_.gpu += entry.memory.gpu;
+    slots_.emplace(slot, entry);
+}
+
+void ResidencyManager::removeModel(ModelID id, bool evicted) {
+    auto it = models_.find(id);
+    if (it == models_.end()) {
+        return;
+    }
+    auto& entry = it->second;
+
+    modelMemory_.cpu -= entry.memory.cpu;
+    modelMemory_.gpu -= entry.memory.gpu;
+
+    auto slotIt = slots_.find(entry.slot);
+    if (slotIt != slots_.end()) {
+        auto& slot = slotIt->second;
+        slot.users--;
+        slot.lastUse = std::max(slot.lastUse, entry.info->getLastUse());
+        // Objects may still use the textures of a model unloaded elsewhere
+        if (!evicted) {
+            slot.pinned = true;
+        }
+    }
+
+    if (evicted) {
+        entry.info->unload();
+    }
+
+    models_.erase(it);
+}
+
+void ResidencyManager::update() {
+    frame_++;
+
+    if (budget_ == 0 ||
+        modelMemory_.total() + textureMemory_.total() <= budget_) {
+        return;
+    }
+
+    if (frame_ - lastEviction_ < kEvictionInterval) {
+        return;
+    }
+    lastEviction_ = frame_;
+
+    evict();
+}
+
+void ResidencyManager::evict() {
+    RW_PROFILE_SCOPE(__func__);
+
+    // Forget models that were unloaded or replaced outside of the manager
+    std::vector<ModelID> stale;
+    for (const auto& [id, entry] : models_) {
+        if (!entry.info->isLoaded() || entry.model.expired()) {
+            stale.push_back(id);
+        }
+    }
+    for (auto id : stale) {
+        removeModel(id, false);
+    }
+
+    // Instances let go of an evicted model by themselves, anything else
+    // referencing the model keeps it resident.
+    std::unordered_map<ModelID, int> instanceReferences;
+    if (data->engine) {
+        for (const auto& p : data->engine->instancePool.objects) {
+            auto info = p.second->getModelInfo<BaseModelInfo>();
+            if (info) {
+                instanceReferences[info->id()]++;
+            }
+        }
+    }
+
+    std::vector<std::tuple<std::uint64_t, ModelID>> candidates;
+    for (const auto& [id, entry] : models_) {
+        auto lastUse = entry.info->getLastUse();
+        if (lastUse + kMinIdleFrames > frame_ || isPinned(id)) {
+            continue;
+        }
+        auto refs = entry.info->getReferenceCount() - instanceReferences[id];
+        if (refs > 0) {
+            continue;
+        }
+        candidates.emplace_back(lastUse, id);
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    const auto total = [&] {
+        return modelMemory_.total() + textureMemory_.total();
+    };
+    const auto before = total();
+
+    std::size_t evictedModels = 0;
+    for (const auto& candidate : candidates) {
+        if (total() <= budget_) {
+            break;
+        }
+        removeModel(std::get<1>(candidate), true);
+        evictedModels++;
+    }
+
+    std::vector<std::tuple<std::uint64_t, std::string>> slotCandidates;
+    for (const auto& [name, slot] : slots_) {
+        if (slot.users <= 0 && !slot.pinned) {
+            slotCandidates.emplace_back(slot.lastUse, name);
+        }
+    }
+    std::sort(slotCandidates.begin(), slotCandidates.end());
+
+    std::size_t evictedSlots = 0;
+    for (const auto& candidate : slotCandidates) {
+        if (total() <= budget_) {
+            break;
+        }
+        const auto& name = std::get<1>(candidate);
+        auto& slot = slots_[name];
+        textureMemory_.cpu -= slot.memory.cpu;
+        textureMemory_.gpu -= slot.memory.gpu;
+        data->textureSlots.erase(name);
+        slots_.erase(name);
+        evictedSlots++;
+    }
+
+    if (evictedModels || evictedSlots) {
+        logger->info("Data", "Evicted " + std::to_string(evictedModels) +
+                                 " models and " +
+                                 std::to_string(evictedSlots) +
+                                 " texture slots, freeing " +
+                                 std::to_string((before - total()) / 1024) +
+                                 " KiB");
+    }
+}
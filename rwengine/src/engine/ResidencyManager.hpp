@@ -0,0 +1,162 @@
+#ifndef _RWENGINE_RESIDENCYMANAGER_HPP_
+#define _RWENGINE_RESIDENCYMANAGER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <rw/forward.hpp>
+
+#include <data/ModelData.hpp>
+
+class GameData;
+class Logger;
+
+/**
+ * @brief Keeps the memory used by streamed models and textures in a budget.
+ *
+ * Models loaded through GameData::loadModel or the ModelStreamer, and the
+ * texture slots loaded alongside them, are registered here with their CPU
+ * and GPU memory use. ObjectRenderer marks every model it draws, and once
+ * the total is over budget the least recently used models are unloaded,
+ * followed by texture slots none of the remaining models need.
+ *
+ * Models used by anything other than instances are never evicted, as
+ * vehicles, peds and pickups keep referencing their model's data. Instances
+ * release their atomic when their model is evicted and stream it back in
+ * when they are next drawn. Models that are used without an object
+ * referencing them, such as weapons held by characters, must be pinned.
+ */
+class ResidencyManager {
+public:
+    struct MemoryUsage {
+        std::size_t cpu = 0;
+        std::size_t gpu = 0;
+
+        std::size_t total() const {
+            return cpu + gpu;
+        }
+    };
+
+    ResidencyManager(GameData* data, Logger* logger);
+
+    /**
+     * Sets the combined CPU and GPU memory budget, in bytes
+     * @param bytes The budget, or 0 to never evict anything
+     */
+    void setBudget(std::size_t bytes) {
+        budget_ = bytes;
+    }
+
+    std::size_t getBudget() const {
+        return budget_;
+    }
+
+    /**
+     * Records that the model is used to render the current frame
+     */
+    void markUsed(BaseModelInfo* info) const {
+        info->setLastUse(frame_);
+    }
+
+    /**
+     * Registers a model that has just been loaded and associated
+     * @param info The model info the model was associated with
+     * @param model The loaded model
+     * @param slot The texture slot the model's textures were found in
+     */
+    void addModel(BaseModelInfo* info, const ClumpPtr& model,
+                  const std::string& slot);
+
+    /**
+     * Prevents the model from ever being evicted
+     */
+    void pinModel(ModelID id) {
+        pinned_.insert(id);
+    }
+
+    bool isPinned(ModelID id) const {
+        return pinned_.count(id) != 0;
+    }
+
+    /**
+     * Registers a texture slot that was loaded for a model, allowing it to
+     * be evicted once no resident model uses it
+     */
+    void addTextureSlot(const std::string& slot);
+
+    /**
+     * Advances the frame and evicts the least recently used models and
+     * texture slots if the budget is exceeded.
+     */
+    void update();
+
+    /**
+     * @return The memory used by resident models
+     */
+    MemoryUsage getModelMemory() const {
+        return modelMemory_;
+    }
+
+    /**
+     * @return The memory used by resident texture slots
+     */
+    MemoryUsage getTextureMemory() const {
+        return textureMemory_;
+    }
+
+    std::size_t getResidentModelCount() const {
+        return models_.size();
+    }
+
+    std::size_t getResidentSlotCount() const {
+        return slots_.size();
+    }
+
+    std::uint64_t getFrame() const {
+        return frame_;
+    }
+
+private:
+    struct ModelEntry {
+        BaseModelInfo* info;
+        /// Expires if the model is unloaded outside of the manager
+        std::weak_ptr<Clump> model;
+        std::string slot;
+        MemoryUsage memory;
+    };
+
+    struct SlotEntry {
+        MemoryUsage memory;
+        /// Number of resident models using the slot
+        int users = 0;
+        /// Most recent use of any model using the slot
+        std::uint64_t lastUse = 0;
+        /// Set when the slot may still be referenced by a model that was
+        /// unloaded outside of the manager
+        bool pinned = false;
+    };
+
+    void removeModel(ModelID id, bool evicted);
+
+    void evict();
+
+    GameData* data;
+    Logger* logger;
+
+    std::size_t budget_ = 0;
+    std::uint64_t frame_ = 0;
+    std::uint64_t lastEviction_ = 0;
+
+    std::unordered_map<ModelID, ModelEntry> models_;
+    std::unordered_map<std::string, SlotEntry> slots_;
+    std::unordered_set<ModelID> pinned_;
+
+    MemoryUsage modelMemory_;
+    MemoryUsage textureMemory_;
+};
+
+#endif
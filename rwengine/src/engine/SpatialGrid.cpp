@@ -0,0 +1,268 @@
+#include "engine/SpatialGrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <glm/glm.hpp>
+
+#include <data/Clump.hpp>
+
+#include "data/CollisionModel.hpp"
+#include "data/ModelData.hpp"
+#include "objects/GameObject.hpp"
+#include "render/ViewFrustum.hpp"
+
+namespace {
+/// Radius used for objects without collision or geometry to measure
+constexpr float kDefaultObjectRadius = 5.f;
+/// Cell coordinates are clamped to this, to keep them in range of an int
+constexpr float kMaxCellCoord = 1 << 30;
+
+bool sphereIntersectsBox(const glm::vec3& center, float radius,
+                         const glm::vec3& min, const glm::vec3& max) {
+    auto nearest = glm::clamp(center, min, max);
+    auto d = nearest - center;
+    return glm::dot(d, d) <= radius * radius;
+}
+}  // namespace
+
+SpatialGrid::SpatialGrid(float cellSize) : cellSize_(cellSize) {
+}
+
+float SpatialGrid::getBoundingRadius(GameObject* object) {
+    float radius = 0.f;
+    auto info = object->getModelInfo<BaseModelInfo>();
+    if (info && info->getCollision()) {
+        const auto& sphere = info->getCollision()->boundingSphere;
+        radius = glm::length(sphere.center) + sphere.radius;
+    }
+    const auto& clump = object->getClump();
+    if (clump) {
+        radius = std::max(radius, clump->getBoundingRadius());
+    }
+    const auto& atomic = object->getAtomic();
+    if (atomic && atomic->getGeometry()) {
+        const auto& bounds = atomic->getGeometry()->geometryBounds;
+        radius = std::max(radius, glm::length(bounds.center) + bounds.radius);
+    }
+    return radius > 0.f ? radius : kDefaultObjectRadius;
+}
+
+SpatialGrid::CellKey SpatialGrid::cellKey(int x, int y) const {
+    return (CellKey(static_cast<std::uint32_t>(x)) << 32) |
+           static_cast<std::uint32_t>(y);
+}
+
+int SpatialGrid::cellCoord(float v) const {
+    auto c = std::floor(v / cellSize_);
+    if (!(c > -kMaxCellCoord)) {
+        return static_cast<int>(-kMaxCellCoord);
+    }
+    return static_cast<int>(std::min(c, kMaxCellCoord));
+}
+
+void SpatialGrid::insert(GameObject* object) {
+    if (contains(object)) {
+        update(object);
+        return;
+    }
+    add({object, object->getPosition(), getBoundingRadius(object)});
+}
+
+void SpatialGrid::remove(GameObject* object) {
+    auto it = entries_.find(object);
+    if (it == entries_.end()) {
+        return;
+    }
+    erase(it->second);
+    entries_.erase(object);
+}
+
+void SpatialGrid::update(GameObject* object) {
+    auto it = entries_.find(object);
+    if (it == entries_.end()) {
+        return;
+    }
+    Item item{object, object->getPosition(), getBoundingRadius(object)};
+    auto& entry = it->second;
+
+    const bool large = item.radius > cellSize_;
+    const auto key = large ? kLargeObjects
+                           : cellKey(cellCoord(item.position.x),
+                                     cellCoord(item.position.y));
+    if (key != entry.cell) {
+        erase(entry);
+        add(item);
+        return;
+    }
+
+    if (large) {
+        large_[entry.index] = item;
+        return;
+    }
+
+    // Staying in the same cell only ever grows its bounds, they are
+    // tightened again when an object leaves.
+    auto& cell = cells_[key];
+    cell.items[entry.index] = item;
+    cell.min = glm::min(cell.min, item.position - item.radius);
+    cell.max = glm::max(cell.max, item.position + item.radius);
+}
+
+void SpatialGrid::clear() {
+    cells_.clear();
+    large_.clear();
+    entries_.clear();
+}
+
+void SpatialGrid::add(const Item& item) {
+    if (item.radius > cellSize_) {
+        entries_[item.object] = {kLargeObjects, large_.size()};
+        large_.push_back(item);
+        return;
+    }
+
+    auto key = cellKey(cellCoord(item.position.x), cellCoord(item.position.y));
+    auto& cell = cells_[key];
+    auto min = item.position - item.radius;
+    auto max = item.position + item.radius;
+    if (cell.items.empty()) {
+        cell.min = min;
+        cell.max = max;
+    } else {
+        cell.min = glm::min(cell.min, min);
+        cell.max = glm::max(cell.max, max);
+    }
+    entries_[item.object] = {key, cell.items.size()};
+    cell.items.push_back(item);
+}
+
+void SpatialGrid::erase(const Entry& entry) {
+    auto cellIt = cells_.end();
+    std::vector<Item>* items = &large_;
+    if (entry.cell != kLargeObjects) {
+        cellIt = cells_.find(entry.cell);
+        items = &cellIt->second.items;
+    }
+
+    // Fill the gap with the last item, fixing up its entry
+    if (entry.index + 1 != items->size()) {
+        (*items)[entry.index] = items->back();
+        entries_[(*items)[entry.index].object].index = entry.index;
+    }
+    items->pop_back();
+
+    if (cellIt == cells_.end()) {
+        return;
+    }
+    auto& cell = cellIt->second;
+    if (cell.items.empty()) {
+        cells_.erase(cellIt);
+        return;
+    }
+    cell.min = cell.items[0].position - cell.items[0].radius;
+    cell.max = cell.items[0].position + cell.items[0].radius;
+    for (const auto& item : cell.items) {
+        cell.min = glm::min(cell.min, item.position - item.radius);
+        cell.max = glm::max(cell.max, item.position + item.radius);
+    }
+}
+
+template <class Visit>
+void SpatialGrid::visitCells(const glm::vec3& min, const glm::vec3& max,
+                             Visit visit) const {
+    // Objects may extend up to a cell beyond the cell they are stored in
+    auto x0 = cellCoord(min.x - cellSize_);
+    auto y0 = cellCoord(min.y - cellSize_);
+    auto x1 = cellCoord(max.x + cellSize_);
+    auto y1 = cellCoord(max.y + cellSize_);
+
+    auto area = (std::int64_t(x1) - x0 + 1) * (std::int64_t(y1) - y0 + 1);
+    if (area > static_cast<std::int64_t>(cells_.size())) {
+        for (const auto& p : cells_) {
+            visit(p.second);
+        }
+        return;
+    }
+
+    for (auto x = x0; x <= x1; ++x) {
+        for (auto y = y0; y <= y1; ++y) {
+            auto it = cells_.find(cellKey(x, y));
+            if (it != cells_.end()) {
+                visit(it->second);
+            }
+        }
+    }
+}
+
+void SpatialGrid::query(const glm::vec3& center, float radius,
+                        std::vector<GameObject*>& out) const {
+    const auto intersects = [&](const Item& item) {
+        auto d = item.position - center;
+        auto r = radius + item.radius;
+        return glm::dot(d, d) <= r * r;
+    };
+
+    visitCells(center - radius, center + radius, [&](const Cell& cell) {
+        if (!sphereIntersectsBox(center, radius, cell.min, cell.max)) {
+            return;
+        }
+        for (const auto& item : cell.items) {
+            if (intersects(item)) {
+                out.push_back(item.object);
+            }
+        }
+    });
+
+    for (const auto& item : large_) {
+        if (intersects(item)) {
+            out.push_back(item.object);
+        }
+    }
+}
+
+void SpatialGrid::query(const glm::vec3& min, const glm::vec3& max,
+                        std::vector<GameObject*>& out) const {
+    const auto intersects = [&](const glm::vec3& cmin, const glm::vec3& cmax) {
+        return glm::all(glm::lessThanEqual(min, cmax)) &&
+               glm::all(glm::lessThanEqual(cmin, max));
+    };
+
+    visitCells(min, max, [&](const Cell& cell) {
+        if (!intersects(cell.min, cell.max)) {
+            return;
+        }
+        for (const auto& item : cell.items) {
+            if (sphereIntersectsBox(item.position, item.radius, min, max)) {
+                out.push_back(item.object);
+            }
+        }
+    });
+
+    for (const auto& item : large_) {
+        if (sphereIntersectsBox(item.position, item.radius, min, max)) {
+            out.push_back(item.object);
+        }
+    }
+}
+
+void SpatialGrid::query(const ViewFrustum& frustum,
+                        std::vector<GameObject*>& out) const {
+    for (const auto& p : cells_) {
+        const auto& cell = p.second;
+        if (!frustum.intersects(cell.min, cell.max)) {
+            continue;
+        }
+        for (const auto& item : cell.items) {
+            if (frustum.intersects(item.position, item.radius)) {
+                out.push_back(item.object);
+            }
+        }
+    }
+
+    for (const auto& item : large_) {
+        if (frustum.intersects(item.position, item.radius)) {
+            out.push_back(item.object);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+#ifndef _RWENGINE_SPATIALGRID_HPP_
+#define _RWENGINE_SPATIALGRID_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+class GameObject;
+class ViewFrustum;
+
+/**
+ * @brief Uniform grid over the XY plane for finding nearby objects.
+ *
+ * Each object is stored with a bounding sphere in the cell containing its
+ * position. A cell's bounds are loose, enclosing the spheres of all of its
+ * objects, so queries only have to look at the cells around them. Objects
+ * too large to fit a single cell are kept aside and always tested.
+ *
+ * GameWorld inserts the objects it creates, and objects update their entry
+ * whenever their position changes. Objects that were never inserted are
+ * ignored by update().
+ */
+class SpatialGrid {
+public:
+    /// Default edge length of a cell, in world units
+    static constexpr float kDefaultCellSize = 64.f;
+
+    explicit SpatialGrid(float cellSize = kDefaultCellSize);
+
+    /**
+     * @return The largest of the object's known bounding radii, from its
+     * collision model or its geometry
+     */
+    static float getBoundingRadius(GameObject* object);
+
+    void insert(GameObject* object);
+
+    void remove(GameObject* object);
+
+    /**
+     * Moves the object's entry to its current position and bounds.
+     * Does nothing if the object hasn't been inserted.
+     */
+    void update(GameObject* object);
+
+    void clear();
+
+    /**
+     * Finds objects whose bounding sphere intersects the given sphere
+     * @param out Receives the objects, it is not cleared beforehand
+     */
+    void query(const glm::vec3& center, float radius,
+               std::vector<GameObject*>& out) const;
+
+    /**
+     * Finds objects whose bounding sphere intersects the given box
+     * @param out Receives the objects, it is not cleared beforehand
+     */
+    void query(const glm::vec3& min, const glm::vec3& max,
+               std::vector<GameObject*>& out) const;
+
+    /**
+     * Finds objects whose bounding sphere intersects the frustum
+     * @param out Receives the objects, it is not cleared beforehand
+     */
+    void query(const ViewFrustum& frustum,
+               std::vector<GameObject*>& out) const;
+
+    bool contains(GameObject* object) const {
+        return entries_.find(object) != entries_.end();
+    }
+
+    std::size_t size() const {
+        return entries_.size();
+    }
+
+    std::size_t getCellCount() const {
+        return cells_.size();
+    }
+
+private:
+    using CellKey = std::uint64_t;
+    /// Stands in for a cell key for objects too large for the grid
+    static constexpr CellKey kLargeObjects = ~CellKey(0);
+
+    struct Item {
+        GameObject* object;
+        glm::vec3 position;
+        float radius;
+    };
+
+    struct Cell {
+        std::vector<Item> items;
+        /// Encloses the bounding spheres of every item
+        glm::vec3 min{};
+        glm::vec3 max{};
+    };
+
+    struct Entry {
+        CellKey cell;
+        std::size_t index;
+    };
+
+    CellKey cellKey(int x, int y) const;
+
+    int cellCoord(float v) const;
+
+    void add(const Item& item);
+
+    void erase(const Entry& entry);
+
+    template <class Visit>
+    void visitCells(const glm::vec3& min, const glm::vec3& max,
+                    Visit visit) const;
+
+    float cellSize_;
+    std::unordered_map<CellKey, Cell> cells_;
+    std::vector<Item> large_;
+    std::unordered_map<GameObject*, Entry> entries_;
+};
+
+#endif
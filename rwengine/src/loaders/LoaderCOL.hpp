@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 
+#include <rw/forward.hpp>
+
 struct CollisionModel;
 
 /**
@@ -17,6 +19,10 @@ public:
     /// Load the COL data into memory
     bool load(const std::string& file);
 
+    /// Load the COL data from file contents already in memory, path is
+    /// only used to report errors
+    bool load(const FileContentsView& file, const std::string& path);
+
     std::vector<std::unique_ptr<CollisionModel>> collisions;
 };
 
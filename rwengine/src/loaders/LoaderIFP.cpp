@@ -6,56 +6,124 @@
 #include <cctype>
 #include <memory>
 
-bool findKeyframes(float t, AnimationBone* bone, AnimationKeyframe& f1,
-                   AnimationKeyframe& f2, float& alpha) {
-    for (size_t f = 0; f < bone->frames.size(); ++f) {
-        if (t <= bone->frames[f].starttime) {
-            f2 = bone->frames[f];
-
-            if (f == 0) {
-                if (bone->frames.size() != 1) {
-                    f1 = bone->frames.back();
-                } else {
-                    f1 = f2;
-                }
-            } else {
-                f1 = bone->frames[f - 1];
-            }
+namespace {
+constexpr float kRotationScale = 32767.f;
 
-            float tdiff = (f2.starttime - f1.starttime);
-            if (tdiff == 0.f) {
-                alpha = 1.f;
-            } else {
-                alpha = glm::clamp((t - f1.starttime) / tdiff, 0.f, 1.f);
-            }
+glm::i16vec4 quantizeRotation(const glm::quat& q) {
+    auto c = glm::clamp(glm::vec4(q.x, q.y, q.z, q.w), -1.f, 1.f);
+    return glm::i16vec4(glm::round(c * kRotationScale));
+}
 
-            return true;
-        }
+glm::quat dequantizeRotation(const glm::i16vec4& q) {
+    auto c = glm::vec4(q) / kRotationScale;
+    return glm::quat(c.w, c.x, c.y, c.z);
+}
+}  // namespace
+
+void AnimationBone::reserve(std::size_t frames) {
+    times.reserve(frames);
+    rotations.reserve(frames);
+    if (type != R00) {
+        positions.reserve(frames);
     }
-    return false;
+    if (type == RTS) {
+        scales.reserve(frames);
+    }
+}
+
+void AnimationBone::addKeyframe(const glm::quat& rotation,
+                                const glm::vec3& position,
+                                const glm::vec3& scale, float time) {
+    times.push_back(time);
+    rotations.push_back(quantizeRotation(rotation));
+    if (type != R00) {
+        positions.push_back(position);
+    }
+    if (type == RTS) {
+        scales.push_back(scale);
+    }
+}
+
+AnimationKeyframe AnimationBone::getFrame(std::size_t index) const {
+    return {dequantizeRotation(rotations[index]),
+            positions.empty() ? glm::vec3(0.f) : positions[index],
+            scales.empty() ? glm::vec3(1.f) : scales[index], times[index],
+            static_cast<int>(index)};
 }
 
-AnimationKeyframe AnimationBone::getInterpolatedKeyframe(float time) {
-    AnimationKeyframe f1, f2;
-    float alpha;
+AnimationKeyframe AnimationBone::interpolate(std::size_t index,
+                                             float time) const {
+    // Past the last keyframe
+    if (index >= times.size()) {
+        return getFrame(times.size() - 1);
+    }
+
+    // Before the first keyframe, interpolate from the last one
+    auto previous = index;
+    if (index > 0) {
+        previous = index - 1;
+    } else if (times.size() != 1) {
+        previous = times.size() - 1;
+    }
 
-    if (findKeyframes(time, this, f1, f2, alpha)) {
-        return {glm::normalize(glm::slerp(f1.rotation, f2.rotation, alpha)),
-                glm::mix(f1.position, f2.position, alpha),
-                glm::mix(f1.scale, f2.scale, alpha), time,
-                std::max(f1.id, f2.id)};
+    float alpha = 1.f;
+    float tdiff = times[index] - times[previous];
+    if (tdiff != 0.f) {
+        alpha = glm::clamp((time - times[previous]) / tdiff, 0.f, 1.f);
     }
 
-    return frames.back();
+    auto f1 = getFrame(previous);
+    auto f2 = getFrame(index);
+    return {glm::normalize(glm::slerp(f1.rotation, f2.rotation, alpha)),
+            glm::mix(f1.position, f2.position, alpha),
+            glm::mix(f1.scale, f2.scale, alpha), time,
+            std::max(f1.id, f2.id)};
+}
+
+AnimationKeyframe AnimationBone::getInterpolatedKeyframe(float time) const {
+    auto index = std::lower_bound(times.begin(), times.end(), time) -
+                 times.begin();
+    return interpolate(static_cast<std::size_t>(index), time);
+}
+
+AnimationKeyframe AnimationBone::getInterpolatedKeyframe(
+    float time, std::uint32_t& cursor) const {
+    std::size_t index = cursor;
+    if (index > times.size() || (index > 0 && times[index - 1] >= time)) {
+        // Time went backwards, most likely the animation looped
+        index = static_cast<std::size_t>(
+            std::lower_bound(times.begin(), times.end(), time) -
+            times.begin());
+    } else {
+        while (index < times.size() && times[index] < time) {
+            ++index;
+        }
+    }
+    cursor = static_cast<std::uint32_t>(index);
+    return interpolate(index, time);
 }
 
-AnimationKeyframe AnimationBone::getKeyframe(float time) {
-    for (auto &frame : frames) {
-        if (time >= frame.starttime) {
-            return frame;
+AnimationKeyframe AnimationBone::getKeyframe(float time) const {
+    for (std::size_t f = 0; f < times.size(); ++f) {
+        if (time >= times[f]) {
+            return getFrame(f);
         }
     }
-    return frames.back();
+    return getFrame(times.size() - 1);
+}
+
+void Animation::addBone(const std::string& frameName, AnimationBone bone) {
+    // Only the first bone of each frame is used
+    if (!boneIndices.emplace(frameName, bones.size()).second) {
+        return;
+    }
+    frameNames.push_back(frameName);
+    bones.push_back(std::move(bone));
+}
+
+const AnimationBone* Animation::findBone(const std::string& frameName) const {
+    auto it = boneIndices.find(frameName);
+    return it != boneIndices.end() ? &bones[it->second] : nullptr;
 }
 
 bool LoaderIFP::loadFromMemory(char* data) {
@@ -89,7 +157,6 @@ bool LoaderIFP::loadFromMemory(char* data) {
 
             AnimationBone boneData{};
             boneData.name = frames->name;
-            boneData.frames.reserve(frames->frames);
 
             data_offs += ((8 + frames->base.size) - sizeof(ANIM));
 
@@ -100,30 +167,31 @@ bool LoaderIFP::loadFromMemory(char* data) {
 
             if (type == "KR00") {
                 boneData.type = AnimationBone::R00;
+                boneData.reserve(frames->frames);
                 for (auto d = 0u; d < frames->frames; ++d) {
                     glm::quat q = glm::conjugate(*read<glm::quat>(data, dataI));
                     time = *read<float>(data, dataI);
-                    boneData.frames.emplace_back(q, glm::vec3(0.f, 0.f, 0.f),
-                                                glm::vec3(1.f, 1.f, 1.f), time,
-                                                d);
+                    boneData.addKeyframe(q, glm::vec3(0.f, 0.f, 0.f),
+                                         glm::vec3(1.f, 1.f, 1.f), time);
                 }
             } else if (type == "KRT0") {
                 boneData.type = AnimationBone::RT0;
+                boneData.reserve(frames->frames);
                 for (auto d = 0u; d < frames->frames; ++d) {
                     glm::quat q = glm::conjugate(*read<glm::quat>(data, dataI));
                     glm::vec3 p = *read<glm::vec3>(data, dataI);
                     time = *read<float>(data, dataI);
-                    boneData.frames.emplace_back(
-                        q, p, glm::vec3(1.f, 1.f, 1.f), time, d);
+                    boneData.addKeyframe(q, p, glm::vec3(1.f, 1.f, 1.f), time);
                 }
             } else if (type == "KRTS") {
                 boneData.type = AnimationBone::RTS;
+                boneData.reserve(frames->frames);
                 for (auto d = 0u; d < frames->frames; ++d) {
                     glm::quat q = glm::conjugate(*read<glm::quat>(data, dataI));
                     glm::vec3 p = *read<glm::vec3>(data, dataI);
                     glm::vec3 s = *read<glm::vec3>(data, dataI);
                     time = *read<float>(data, dataI);
-                    boneData.frames.emplace_back(q, p, s, time, d);
+                    boneData.addKeyframe(q, p, s, time);
                 }
             }
 
@@ -137,7 +205,7 @@ bool LoaderIFP::loadFromMemory(char* data) {
             std::transform(framename.begin(), framename.end(),
                            framename.begin(), ::tolower);
 
-            animation->bones.emplace(framename, std::move(boneData));
+            animation->addBone(framename, std::move(boneData));
         }
 
         data_offs = animstart + animroot->base.size;
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_precision.hpp>
 #include <glm/vec3.hpp>
 
 #include <rw/forward.hpp>
@@ -30,6 +31,12 @@ struct AnimationKeyframe {
     AnimationKeyframe() = default;
 };
 
+/**
+ * @brief Keyframes of one bone, stored as separate tracks.
+ *
+ * Rotations are quantized to 16 bits per component. Positions are only
+ * stored for RT0 and RTS bones, and scales only for RTS bones.
+ */
 struct AnimationBone {
     std::string name;
     int32_t previous;
@@ -39,7 +46,12 @@ struct AnimationBone {
     enum Data { R00, RT0, RTS };
 
     Data type;
-    std::vector<AnimationKeyframe> frames;
+
+    /// Start time of each keyframe, ascending
+    std::vector<float> times;
+    std::vector<glm::i16vec4> rotations;
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> scales;
 
     AnimationBone() = default;
 
@@ -50,14 +62,46 @@ struct AnimationBone {
         , previous(p_previous)
         , next(p_next)
         , duration(p_duration)
-        , type(p_type)
-        , frames(p_frames) {
+        , type(p_type) {
+        reserve(p_frames.size());
+        for (const auto& frame : p_frames) {
+            addKeyframe(frame.rotation, frame.position, frame.scale,
+                        frame.starttime);
+        }
     }
 
     ~AnimationBone() = default;
 
-    AnimationKeyframe getInterpolatedKeyframe(float time);
-    AnimationKeyframe getKeyframe(float time);
+    void reserve(std::size_t frames);
+
+    /**
+     * Appends a keyframe, keeping only the tracks used by the bone's type
+     */
+    void addKeyframe(const glm::quat& rotation, const glm::vec3& position,
+                     const glm::vec3& scale, float time);
+
+    std::size_t getFrameCount() const {
+        return times.size();
+    }
+
+    AnimationKeyframe getFrame(std::size_t index) const;
+
+    AnimationKeyframe getInterpolatedKeyframe(float time) const;
+
+    /**
+     * Interpolates the keyframes at time, starting the search from cursor.
+     *
+     * The cursor is left at the keyframe that was used, so that sampling
+     * an animation as it plays only looks at the next few keyframes.
+     */
+    AnimationKeyframe getInterpolatedKeyframe(float time,
+                                              std::uint32_t& cursor) const;
+
+    AnimationKeyframe getKeyframe(float time) const;
+
+private:
+    /// Interpolates towards the keyframe at index
+    AnimationKeyframe interpolate(std::size_t index, float time) const;
 };
 
 /**
@@ -67,11 +111,34 @@ struct AnimationBone {
  */
 struct Animation {
     std::string name;
-    std::unordered_map<std::string, AnimationBone> bones;
+    /// Bones in the order they were added
+    std::vector<AnimationBone> bones;
 
     ~Animation() = default;
 
     float duration;
+
+    /**
+     * Adds a bone to animate the frame with the given name, unless the
+     * frame already has one
+     */
+    void addBone(const std::string& frameName, AnimationBone bone);
+
+    /**
+     * @return The bone animating the frame, or nullptr if there is none
+     */
+    const AnimationBone* findBone(const std::string& frameName) const;
+
+    /**
+     * @return The name of the frame the bone at index animates
+     */
+    const std::string& getFrameName(std::size_t index) const {
+        return frameNames[index];
+    }
+
+private:
+    std::vector<std::string> frameNames;
+    std::unordered_map<std::string, std::size_t> boneIndices;
 };
 
 class LoaderIFP {
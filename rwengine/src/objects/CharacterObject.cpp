@@ -243,9 +243,9 @@ glm::vec3 CharacterObject::updateMovementAnimation(float dt) {
     if (movementAnimation != animations->animation(AnimCycle::Idle) &&
         !modelroot->getChildren().empty()) {
         const auto& root = modelroot->getChildren()[0];
-        auto it = movementAnimation->bones.find(root->getName());
-        if (it != movementAnimation->bones.end()) {
-            auto& rootBone = it->second;
+        auto rootBonePtr = movementAnimation->findBone(root->getName());
+        if (rootBonePtr) {
+            auto& rootBone = *rootBonePtr;
             float step = dt;
             RW_CHECK(
                 animator->getAnimation(AnimIndexMovement),
@@ -383,6 +383,7 @@ void CharacterObject::updateCharacter(float dt) {
             physCharacter->getGhostObject()->getWorldTransform().getOrigin();
         position = glm::vec3(Pos.x(), Pos.y(), Pos.z());
         getClump()->getFrame()->setTranslation(position);
+        engine->updateObjectBounds(this);
 
         // Handle above waist height water.
         auto wi = engine->data->getWaterIndexAt(getPosition());
@@ -438,6 +439,7 @@ void CharacterObject::setPosition(const glm::vec3& pos) {
     }
     position = realPos;
     getClump()->getFrame()->setTranslation(pos);
+    engine->updateObjectBounds(this);
 }
 
 glm::vec3 CharacterObject::getCenterOffset() {
@@ -601,23 +603,10 @@ void CharacterObject::setJumpSpeed(float speed) {
 }
 
 void CharacterObject::resetToAINode() {
-    auto& nodes = engine->aigraph.nodes;
     bool vehicleNode = !!getCurrentVehicle();
-    ai::AIGraphNode* nearest = nullptr;
-    float d = std::numeric_limits<float>::max();
-    for (const auto& node : nodes) {
-        if (vehicleNode) {
-            if (node->type == ai::NodeType::Pedestrian) continue;
-        } else {
-            if (node->type == ai::NodeType::Vehicle) continue;
-        }
-
-        float dist = glm::length(node->position - getPosition());
-        if (dist < d) {
-            nearest = node.get();
-            d = dist;
-        }
-    }
+    ai::AIGraphNode* nearest = engine->aigraph.findNearestNode(
+        getPosition(),
+        vehicleNode ? ai::NodeType::Vehicle : ai::NodeType::Pedestrian);
 
     if (nearest) {
         if (vehicleNode) {
@@ -7,6 +7,7 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 #include "engine/Animator.hpp"
+#include "engine/GameWorld.hpp"
 
 const AtomicPtr GameObject::NullAtomic;
 const ClumpPtr GameObject::NullClump;
@@ -19,6 +20,9 @@ GameObject::~GameObject() {
 
 void GameObject::setPosition(const glm::vec3& pos) {
     position = pos;
+    if (engine) {
+        engine->updateObjectBounds(this);
+    }
 }
 
 void GameObject::setRotation(const glm::quat& orientation) {
@@ -39,6 +43,9 @@ void GameObject::setHeading(float heading) {
 void GameObject::updateTransform(const glm::vec3& pos, const glm::quat& rot) {
     position = pos;
     rotation = rot;
+    if (engine) {
+        engine->updateObjectBounds(this);
+    }
 
     const auto& clump = getClump();
     const auto& atomic = getAtomic();
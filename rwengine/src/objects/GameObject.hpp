@@ -1,6 +1,7 @@
 #ifndef _RWENGINE_GAMEOBJECT_HPP_
 #define _RWENGINE_GAMEOBJECT_HPP_
 
+#include <cstddef>
 #include <limits>
 #include <variant>
 
@@ -24,6 +25,7 @@ class GameWorld;
  */
 class GameObject {
     GameObjectID objectID = 0;
+    std::size_t worldIndex = 0;
 
     BaseModelInfo* modelinfo_;
 
@@ -78,6 +80,19 @@ public:
         objectID = id;
     }
 
+    /**
+     * Position of the object in GameWorld::allObjects
+     */
+    std::size_t getWorldIndex() const {
+        return worldIndex;
+    }
+    /**
+     * Do not call this, use GameWorld::insertObject
+     */
+    void setWorldIndex(std::size_t index) {
+        worldIndex = index;
+    }
+
     int getScriptObjectID() const {
         return getGameObjectID();
     }
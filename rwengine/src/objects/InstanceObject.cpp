@@ -67,6 +67,28 @@ InstanceObject::~InstanceObject() = default;
 void InstanceObject::tick(float dt) {
     RW_UNUSED(dt);
     // Moved to tickPhysics
+
+    auto modelinfo = getModelInfo<SimpleModelInfo>();
+    if (!modelinfo) {
+        return;
+    }
+
+    if (modelinfo->isLoaded()) {
+        // Pick up the model once it has finished streaming
+        if (!isAtomicCurrent()) {
+            updateAtomic();
+        }
+    } else if (atomic_) {
+        // Let go of an evicted model, so its memory can be freed
+        atomic_.reset();
+        setModel(ClumpPtr());
+    }
+}
+
+bool InstanceObject::isAtomicCurrent() const {
+    const auto model = std::get_if<ClumpPtr>(&getModel());
+    return atomic_ && model &&
+           *model == getModelInfo<SimpleModelInfo>()->getModel();
 }
 
 void InstanceObject::tickPhysics(float dt) {
@@ -152,23 +174,19 @@ void InstanceObject::changeModel(BaseModelInfo* incoming, int atomicNumber) {
     }
 
     if (incoming) {
-        if (!incoming->isLoaded()) {
-            engine->data->loadModel(incoming->id());
-        }
-
         changeModelInfo(incoming);
-        /// @todo this should only be temporary
-        setModel(getModelInfo<SimpleModelInfo>()->getModel());
-        auto collision = getModelInfo<SimpleModelInfo>()->getCollision();
-
-        RW_ASSERT(getModelInfo<SimpleModelInfo>()->getNumAtomics() >
-                  atomicNumber);
-        auto atomic = getModelInfo<SimpleModelInfo>()->getAtomic(atomicNumber);
-        if (atomic) {
-            const auto frame = atomic_ ? atomic_->getFrame() : std::make_shared<ModelFrame>();
-            atomic_ = atomic->clone(frame);
+        modelAtomic = atomicNumber;
+
+        if (incoming->isLoaded()) {
+            updateAtomic();
+        } else {
+            // ObjectRenderer streams the model in once it's in range, and
+            // nothing is rendered until then
+            atomic_.reset();
+            setModel(ClumpPtr());
         }
 
+        auto collision = getModelInfo<SimpleModelInfo>()->getCollision();
         if (collision) {
             body = std::make_unique<CollisionInstance>();
             body->createPhysicsBody(this, collision, dynamics);
@@ -176,6 +194,27 @@ void InstanceObject::changeModel(BaseModelInfo* incoming, int atomicNumber) {
     }
 }
 
+void InstanceObject::updateAtomic() {
+    /// @todo this should only be temporary
+    setModel(getModelInfo<SimpleModelInfo>()->getModel());
+
+    RW_ASSERT(getModelInfo<SimpleModelInfo>()->getNumAtomics() > modelAtomic);
+    auto atomic = getModelInfo<SimpleModelInfo>()->getAtomic(modelAtomic);
+    if (atomic) {
+        if (atomic_) {
+            atomic_ = atomic->clone(atomic_->getFrame());
+        } else {
+            auto frame = std::make_shared<ModelFrame>();
+            frame->setTranslation(getPosition());
+            frame->setRotation(glm::mat3_cast(getRotation()));
+            atomic_ = atomic->clone(frame);
+        }
+    }
+
+    // The model's bounds are only known once it has been loaded
+    engine->updateObjectBounds(this);
+}
+
 void InstanceObject::setPosition(const glm::vec3& pos) {
     if (body) {
         auto& wtr = body->getBulletBody()->getWorldTransform();
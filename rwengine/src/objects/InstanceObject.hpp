@@ -22,12 +22,19 @@ class InstanceObject final : public GameObject {
     bool static_ = false;
     bool usePhysics = false;
     int changeAtomic = -1;
+    /// The atomic to use once the model has been streamed in
+    int modelAtomic = 0;
 
     /**
      * The Atomic instance for this object
      */
     AtomicPtr atomic_;
 
+    /**
+     * Creates the Atomic instance from the resident model
+     */
+    void updateAtomic();
+
 public:
     glm::vec3 scale;
     std::unique_ptr<CollisionInstance> body;
@@ -47,6 +54,12 @@ public:
         return atomic_;
     }
 
+    /**
+     * @return true if the Atomic instance belongs to the model that is
+     * currently resident, false if there is none or the model was evicted
+     */
+    bool isAtomicCurrent() const;
+
     void tick(float dt) override;
 
     void tickPhysics(float dt);
@@ -120,7 +120,7 @@ private:
     bool m_enabled = false;
     float m_enableTimer = 0.f;
     bool m_collected = false;
-    ParticleFX& m_corona;
+    ParticleHandle m_corona;
     short m_colourId = 0;
     bool respawn = false;
     float respawnTime{};
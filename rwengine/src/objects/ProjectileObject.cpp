@@ -9,8 +9,12 @@
 #pragma warning(default : 4305)
 #endif
 
+#include <vector>
+
 #include <glm/gtc/quaternion.hpp>
 
+#include <rw/debug.hpp>
+
 #include "data/WeaponData.hpp"
 #include "engine/GameData.hpp"
 #include "engine/GameWorld.hpp"
@@ -64,7 +68,11 @@ void ProjectileObject::explode() {
         const float damageSize = 5.f;
         const float damage = static_cast<float>(_info.weapon->damage);
 
-        for (auto& o : engine->allObjects) {
+        std::vector<GameObject*> nearby;
+        engine->objectGrid.query(getPosition(), damageSize, nearby);
+        engine->staticObjects.query(getPosition(), damageSize, nearby);
+
+        for (auto& o : nearby) {
             if (o == this) continue;
             switch (o->type()) {
                 case GameObject::Instance:
@@ -84,7 +92,7 @@ void ProjectileObject::explode() {
                            0.f});
         }
 
-        auto& explosion = engine->createParticleEffect();
+        ParticleFX explosion;
 
         auto texPtr = engine->data->findSlotTexture("particle", "explo02");
         explosion.texture = texPtr;
@@ -95,6 +103,7 @@ void ProjectileObject::explode() {
         explosion.colour = glm::vec4(1.0f);
         explosion.position = getPosition();
         explosion.direction = glm::vec3(0.f, 0.f, 1.f);
+        engine->createParticleEffect(explosion);
 
         _exploded = true;
         engine->destroyObjectQueued(this);
@@ -161,9 +170,17 @@ ProjectileObject::ProjectileObject(GameWorld* world, const glm::vec3& position,
             btBroadphaseProxy::AllFilter);
     }
 
-    const auto& modelData = world->data->findModelInfo<SimpleModelInfo>(
-        getProjectileInfo().weapon->modelID);
-    setModel(modelData->getAtomic(0)->clone(std::make_shared<ModelFrame>()));
+    const auto modelID = getProjectileInfo().weapon->modelID;
+    const auto& modelData =
+        world->data->findModelInfo<SimpleModelInfo>(modelID);
+    RW_CHECK(modelData, "Failed to read modelinfo using " << modelID);
+    if (modelData && !modelData->isLoaded()) {
+        world->data->loadModel(modelID);
+    }
+    if (modelData && modelData->getAtomic(0)) {
+        setModel(
+            modelData->getAtomic(0)->clone(std::make_shared<ModelFrame>()));
+    }
 }
 
 ProjectileObject::~ProjectileObject() {
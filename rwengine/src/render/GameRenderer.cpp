@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cmath>
+#include <fstream>
 #include <string>
 #include <vector>
 
@@ -14,6 +15,7 @@
 #include <gl/TextureData.hpp>
 #include <rw/types.hpp>
 
+#include "core/JobPool.hpp"
 #include "core/Logger.hpp"
 #include "core/Profiler.hpp"
 #include "engine/GameData.hpp"
@@ -22,27 +24,18 @@
 #include "loaders/WeatherLoader.hpp"
 #include "objects/GameObject.hpp"
 #include "render/ObjectRenderer.hpp"
+#include "render/RenderCapture.hpp"
+#include "render/RenderSort.hpp"
 #include "render/GameShaders.hpp"
 #include "render/VisualFX.hpp"
 
 constexpr size_t skydomeSegments = 8, skydomeRows = 10;
 
-/// @todo collapse all of these into "VertPNC" etc.
-struct ParticleVert {
-    static const AttributeList vertex_attributes() {
-        return {{ATRS_Position, 2, sizeof(ParticleVert), 0ul},
-                {ATRS_TexCoord, 2, sizeof(ParticleVert), 2ul * sizeof(float)},
-                {ATRS_Colour, 3, sizeof(ParticleVert), 4ul * sizeof(float)}};
-    }
-
-    float x, y;
-    float u, v;
-    float r, g, b;
-};
-
-GameRenderer::GameRenderer(Logger* log, GameData* _data)
+GameRenderer::GameRenderer(Logger* log, GameData* _data,
+                           std::unique_ptr<Renderer> _renderer)
     : data(_data)
     , logger(log)
+    , renderer(std::move(_renderer))
     , map(*renderer, _data)
     , water(*this)
     , text(*this) {
@@ -56,6 +49,16 @@ GameRenderer::GameRenderer(Logger* log, GameData* _data)
     renderer->setProgramBlockBinding(worldProg.get(), "SceneData", 1);
     renderer->setProgramBlockBinding(worldProg.get(), "ObjectData", 2);
 
+    worldInstancedProg = renderer->createShader(
+        GameShaders::WorldObject::InstancedVertexShader,
+        GameShaders::WorldObject::FragmentShader);
+
+    renderer->setUniformTexture(worldInstancedProg.get(), "texture", 0);
+    renderer->setProgramBlockBinding(worldInstancedProg.get(), "SceneData", 1);
+    renderer->setProgramBlockBinding(worldInstancedProg.get(), "ObjectData",
+                                     2);
+    renderer->setInstancedProgram(worldProg.get(), worldInstancedProg.get());
+
     particleProg =
         renderer->createShader(GameShaders::WorldObject::VertexShader,
                                GameShaders::Particle::FragmentShader);
@@ -73,37 +76,10 @@ GameRenderer::GameRenderer(Logger* log, GameData* _data)
         renderer->createShader(GameShaders::DefaultPostProcess::VertexShader,
                                GameShaders::DefaultPostProcess::FragmentShader);
 
-    glGenVertexArrays(1, &vao);
-
-    glGenFramebuffers(1, &framebufferName);
-    glBindFramebuffer(GL_FRAMEBUFFER, framebufferName);
-    glGenTextures(2, fbTextures);
-
-    glBindTexture(GL_TEXTURE_2D, fbTextures[0]);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 128, 128, 0, GL_RGBA,
-                 GL_UNSIGNED_BYTE, nullptr);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    glBindTexture(GL_TEXTURE_2D, fbTextures[1]);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_R16F, 128, 128, 0, GL_RED, GL_FLOAT,
-                 nullptr);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
-                           fbTextures[0], 0);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D,
-                           fbTextures[1], 0);
+    frameTextures = renderer->setFrameSize({128, 128});
 
     // Give water renderer the data texture
-    water.setDataTexture(1, fbTextures[1]);
-
-    glGenRenderbuffers(1, fbRenderBuffers);
-    glBindRenderbuffer(GL_RENDERBUFFER, fbRenderBuffers[0]);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, 128, 128);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT,
-                              GL_RENDERBUFFER, fbRenderBuffers[0]);
+    water.setDataTexture(1, frameTextures[1]);
 
     // Create the skydome
 
@@ -147,13 +123,10 @@ GameRenderer::GameRenderer(Logger* log, GameData* _data)
 
     glBindVertexArray(0);
 
-    particleGeom.uploadVertices<ParticleVert>(
-        {{0.5f, 0.5f, 1.f, 1.f, 1.f, 1.f, 1.f},
-         {-0.5f, 0.5f, 0.f, 1.f, 1.f, 1.f, 1.f},
-         {0.5f, -0.5f, 1.f, 0.f, 1.f, 1.f, 1.f},
-         {-0.5f, -0.5f, 0.f, 0.f, 1.f, 1.f, 1.f}});
+    // Refilled with the particle billboards every frame
+    particleGeom.uploadVertices(particleVertices, GL_STREAM_DRAW);
     particleDraw.addGeometry(&particleGeom);
-    particleDraw.setFaceType(GL_TRIANGLE_STRIP);
+    particleDraw.setFaceType(GL_TRIANGLES);
 
     ssRectGeom.uploadVertices<VertexP2>({{-1.f, -1.f}, {1.f, -1.f}, {-1.f, 1.f}, {1.f, 1.f}});
     ssRectDraw.addGeometry(&ssRectGeom);
@@ -165,16 +138,11 @@ GameRenderer::GameRenderer(Logger* log, GameData* _data)
     renderer->setUniform(ssRectProg.get(), "texture", 0);
 }
 
-GameRenderer::~GameRenderer() {
-    glDeleteFramebuffers(1, &framebufferName);
-}
+GameRenderer::~GameRenderer() = default;
 
 void GameRenderer::setupRender() {
-    // Set the viewport
-    const glm::ivec2& vp = getRenderer().getViewport();
-    glViewport(0, 0, vp.x, vp.y);
-    glBindFramebuffer(GL_FRAMEBUFFER, framebufferName);
-    glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
+    renderer->useFrame(true);
+    renderer->clear(glm::vec4(0.f));
 }
 
 void GameRenderer::renderWorld(GameWorld* world, const ViewCamera& camera,
@@ -189,8 +157,6 @@ void GameRenderer::renderWorld(GameWorld* world, const ViewCamera& camera,
 
     setupRender();
 
-    glBindVertexArray(vao);
-
     float tod = world->getHour() + world->getMinute() / 60.f;
 
     const auto currentWeather = WeatherCondition(state->basic.nextWeather);
@@ -245,8 +211,6 @@ void GameRenderer::renderWorld(GameWorld* world, const ViewCamera& camera,
 
     renderer->pushDebugGroup("Sky");
 
-    glBindVertexArray(vao);
-
     Renderer::DrawParameters dp;
     dp.start = 0;
     dp.count = skydomeSegments * skydomeRows * 6;
@@ -265,8 +229,6 @@ void GameRenderer::renderWorld(GameWorld* world, const ViewCamera& camera,
     renderEffects(world);
     profEffects = renderer->popDebugGroup();
 
-    glDisable(GL_DEPTH_TEST);
-
     GLuint splashTexName = 0;
     const auto fc = world->state->fadeColour;
     if ((fc.r + fc.g + fc.b) == 0 && !world->state->currentSplash.empty()) {
@@ -293,11 +255,35 @@ void GameRenderer::renderWorld(GameWorld* world, const ViewCamera& camera,
     renderPostProcess();
 }
 
-void GameRenderer::renderObjects(const GameWorld *world) {
+namespace {
+/// Objects built into each partial render list. Fixed so that the joined
+/// list doesn't depend on the number of threads.
+constexpr std::size_t kRenderListChunkSize = 256;
+}  // namespace
+
+void GameRenderer::setRenderListThreads(unsigned int threads) {
+    if (threads == 1) {
+        renderListJobs.reset();
+        return;
+    }
+    renderListJobs = std::make_unique<JobPool>(threads);
+}
+
+void GameRenderer::renderObjects(GameWorld* world) {
     RW_PROFILE_SCOPE(__func__);
 
     renderer->useProgram(worldProg.get());
-    RenderList renderList = createObjectRenderList(world);
+    RenderList renderList = createObjectRenderList(
+        world, cullOverride ? cullingCamera : _camera, _renderAlpha);
+
+    if (!capturePath.empty()) {
+        std::ofstream out(capturePath, std::ios::binary);
+        RenderCapture::create(renderList, renderer->getSceneData()).write(out);
+        logger->info("Renderer", "Saved " +
+                                     std::to_string(renderList.size()) +
+                                     " draws to " + capturePath);
+        capturePath.clear();
+    }
 
     renderer->pushDebugGroup("Objects");
     renderer->pushDebugGroup("RenderList");
@@ -307,21 +293,64 @@ void GameRenderer::renderObjects(const GameWorld *world) {
     profObjects = renderer->popDebugGroup();
 }
 
-RenderList GameRenderer::createObjectRenderList(const GameWorld *world) {
+RenderList GameRenderer::createObjectRenderList(GameWorld* world,
+                                                const ViewCamera& camera,
+                                                float alpha) {
     RW_PROFILE_SCOPE(__func__);
-    // This is sequential at the moment, it should be easy to make it
-    // run in parallel with a good threading system.
     RenderList renderList;
     // Naive optimisation, assume 50% hitrate
     renderList.reserve(static_cast<size_t>(world->allObjects.size() * 0.5f));
 
-    ObjectRenderer objectRenderer(_renderWorld,
-                                  (cullOverride ? cullingCamera : _camera),
-                                  _renderAlpha);
-
     // World Objects
-    for (auto object : world->allObjects) {
-        objectRenderer.buildRenderList(object, renderList);
+    std::vector<GameObject *> visible;
+    world->staticObjects.query(camera.frustum, visible);
+    world->objectGrid.query(camera.frustum, visible);
+
+    // Cutscene objects are positioned relative to the scene, not the world
+    for (auto &p : world->cutscenePool.objects) {
+        visible.push_back(p.second.get());
+    }
+
+    // Objects are only read while the lists are built
+    ObjectRenderer objectRenderer(world, camera, alpha);
+    for (auto object : visible) {
+        objectRenderer.prepareObject(object);
+    }
+
+    // Each chunk has its own renderer, as they count culled objects and
+    // collect the models to stream while building
+    const auto chunkCount =
+        (visible.size() + kRenderListChunkSize - 1) / kRenderListChunkSize;
+    std::vector<ObjectRenderer> chunkRenderers(
+        chunkCount, ObjectRenderer(world, camera, alpha));
+    std::vector<RenderList> chunkLists(chunkCount);
+
+    auto buildChunk = [&](std::size_t chunk) {
+        auto first = chunk * kRenderListChunkSize;
+        auto last = std::min(first + kRenderListChunkSize, visible.size());
+        for (auto i = first; i < last; ++i) {
+            chunkRenderers[chunk].buildRenderList(visible[i],
+                                                  chunkLists[chunk]);
+        }
+    };
+
+    {
+        RW_PROFILE_SCOPE("buildRenderList");
+        if (renderListJobs) {
+            renderListJobs->run(chunkCount, buildChunk);
+        } else {
+            for (std::size_t chunk = 0; chunk < chunkCount; ++chunk) {
+                buildChunk(chunk);
+            }
+        }
+    }
+
+    for (std::size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        renderList.insert(renderList.end(),
+                          std::make_move_iterator(chunkLists[chunk].begin()),
+                          std::make_move_iterator(chunkLists[chunk].end()));
+        chunkRenderers[chunk].flush();
+        culled += chunkRenderers[chunk].culled;
     }
 
     // Area indicators
@@ -331,7 +360,7 @@ RenderList GameRenderer::createObjectRenderList(const GameWorld *world) {
         m = translate(m, i.position);
         m = scale(
                 m, glm::vec3(i.radius +
-                             0.15f * sin(_renderWorld->getGameTime() * 5.f)));
+                             0.15f * sin(world->getGameTime() * 5.f)));
 
         objectRenderer.renderClump(sphereModel.get(), m, nullptr, renderList);
     }
@@ -367,21 +396,12 @@ RenderList GameRenderer::createObjectRenderList(const GameWorld *world) {
         model = scale(model, glm::vec3(1.5f, 1.5f, 1.5f));
         objectRenderer.renderClump(arrowModel.get(), model, nullptr, renderList);
     }
+    objectRenderer.flush();
     culled += objectRenderer.culled;
 
-    RW_PROFILE_SCOPE("sortRenderList");
-    // Also parallelizable
     // Earlier position in the array means earlier object's rendering
-    // Transparent objects should be sorted and rendered after opaque
-    sort(renderList.begin(), renderList.end(),
-         [](const Renderer::RenderInstruction &a,
-            const Renderer::RenderInstruction &b) {
-             if (a.drawInfo.blendMode == BlendMode::BLEND_NONE && b.drawInfo.blendMode != BlendMode::BLEND_NONE)
-                 return true;
-             if (a.drawInfo.blendMode != BlendMode::BLEND_NONE && b.drawInfo.blendMode == BlendMode::BLEND_NONE)
-                 return false;
-             return (a.sortKey > b.sortKey);
-         });
+    // Transparent objects are sorted and rendered after opaque
+    sortRenderList(renderList);
 
     return renderList;
 }
@@ -420,76 +440,49 @@ void GameRenderer::renderSplash(GameWorld* world, GLuint splashTexName, glm::u16
 }
 
 void GameRenderer::renderPostProcess() {
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glStencilMask(0xFF);
-    glClearStencil(0x00);
-    glClear(GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
+    renderer->useFrame(false);
+    renderer->clear(glm::vec4(0.f), false, true, true);
 
     renderer->useProgram(postProg.get());
 
     Renderer::DrawParameters wdp;
     wdp.start = 0;
     wdp.count = ssRectGeom.getCount();
-    wdp.textures = {{fbTextures[0]}};
+    wdp.textures = {{frameTextures[0]}};
     wdp.depthMode = DepthMode::OFF;
 
     renderer->drawArrays(glm::mat4(1.0f), &ssRectDraw, wdp);
 }
 
 void GameRenderer::renderEffects(GameWorld* world) {
-    renderer->useProgram(particleProg.get());
+    RW_PROFILE_SCOPE(__func__);
 
-    auto cpos = _camera.position;
+    // Other effects not implemented yet
     auto cfwd = glm::normalize(glm::inverse(_camera.rotation) *
                                glm::vec3(0.f, 1.f, 0.f));
+    world->particles.buildBillboards(_camera.position, cfwd,
+                                     particleVertices, particleBatches);
+    if (particleBatches.empty()) {
+        return;
+    }
 
-    auto& effects = world->effects;
-
-    std::sort(effects.begin(), effects.end(),
-              [&](const auto& a, const auto& b) {
-                  return glm::distance(a->position, cpos) >
-                         glm::distance(b->position, cpos);
-              });
-
-    for (auto& fx : effects) {
-        // Other effects not implemented yet
-        if (fx->getType() != Particle) continue;
-        auto particle = static_cast<ParticleFX*>(fx.get());
-
-        auto& p = particle->position;
-
-        // Figure the direction to the camera center.
-        auto amp = cpos - p;
-        glm::vec3 ptc = particle->up;
-
-        if (particle->orientation == ParticleFX::UpCamera) {
-            ptc = glm::normalize(amp - (glm::dot(amp, cfwd)) * cfwd);
-        } else if (particle->orientation == ParticleFX::Camera) {
-            ptc = amp;
-        }
-
-        ptc = glm::normalize(ptc);
-
-        glm::mat4 transformMat(1.f);
-
-        glm::mat4 lookMat = glm::lookAt(
-            glm::vec3(0.0f,0.0f,0.0f),
-            ptc,
-            glm::vec3(0.0f,0.0f,1.0f));
-
-        transformMat = glm::scale(glm::translate(transformMat,p),
-            glm::vec3(particle->size,1.0f)) * glm::inverse(lookMat);
-
-        Renderer::DrawParameters dp;
-        dp.textures = {{particle->texture->getName()}};
-        dp.ambient = 1.f;
-        dp.colour = glm::u8vec4(particle->colour * 255.f);
-        dp.start = 0;
-        dp.count = 4;
-        dp.blendMode = BlendMode::BLEND_ADDITIVE;
-        dp.diffuse = 1.f;
+    renderer->useProgram(particleProg.get());
+    particleGeom.uploadVertices(particleVertices, GL_STREAM_DRAW);
 
-        renderer->drawArrays(transformMat, &particleDraw, dp);
+    // Particles are added together, so they can be drawn in any order as
+    // long as they don't write depth
+    Renderer::DrawParameters dp;
+    dp.ambient = 1.f;
+    dp.colour = glm::u8vec4(255);
+    dp.blendMode = BlendMode::BLEND_ADDITIVE;
+    dp.depthWrite = false;
+    dp.diffuse = 1.f;
+
+    for (const auto& batch : particleBatches) {
+        dp.textures = {{batch.texture->getName()}};
+        dp.start = batch.start;
+        dp.count = batch.count;
+        renderer->drawArrays(glm::mat4(1.f), &particleDraw, dp);
     }
 }
 
@@ -548,15 +541,6 @@ void GameRenderer::setViewport(int w, int h) {
     auto& lastViewport = renderer->getViewport();
     if (lastViewport.x != w || lastViewport.y != h) {
         renderer->setViewport({w, h});
-
-        glBindTexture(GL_TEXTURE_2D, fbTextures[0]);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, w, h, 0, GL_RGB,
-                     GL_UNSIGNED_BYTE, nullptr);
-        glBindTexture(GL_TEXTURE_2D, fbTextures[1]);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_R16F, w, h, 0, GL_RED, GL_FLOAT,
-                     nullptr);
-
-        glBindRenderbuffer(GL_RENDERBUFFER, fbRenderBuffers[0]);
-        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, w, h);
+        frameTextures = renderer->setFrameSize({w, h});
     }
 }
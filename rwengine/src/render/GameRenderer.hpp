@@ -3,6 +3,8 @@
 
 #include <cstddef>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <gl/DrawBuffer.hpp>
 #include <gl/GeometryBuffer.hpp>
@@ -13,8 +15,10 @@
 #include <render/MapRenderer.hpp>
 #include <render/TextRenderer.hpp>
 #include <render/ViewCamera.hpp>
+#include <render/VisualFX.hpp>
 #include <render/WaterRenderer.hpp>
 
+class JobPool;
 class Logger;
 class GameData;
 class GameWorld;
@@ -25,6 +29,10 @@ class TextureData;
  *
  * Rendering of object types is handled by drawWorld, calling the respective
  * render function for each object.
+ *
+ * Drawing goes through the Renderer it is given, but its own buffers and
+ * textures are created through the rwcore GL wrappers, so it needs a GL
+ * context even when drawing through a NullRenderer.
  */
 class GameRenderer {
     /** Game data to use for rendering */
@@ -34,15 +42,12 @@ class GameRenderer {
     Logger* logger;
 
     /** The low-level drawing interface to use */
-    std::unique_ptr<Renderer> renderer = std::make_unique<OpenGLRenderer>();
+    std::unique_ptr<Renderer> renderer;
 
     // Temporary variables used during rendering
     float _renderAlpha{0.f};
     GameWorld* _renderWorld = nullptr;
 
-    /** Internal non-descript VAOs */
-    GLuint vao;
-
     /** Camera values passed to renderWorld() */
     ViewCamera _camera;
     ViewCamera cullingCamera;
@@ -51,22 +56,28 @@ class GameRenderer {
     /** Number of culling events */
     size_t culled;
 
-    GLuint framebufferName;
-    GLuint fbTextures[2];
-    GLuint fbRenderBuffers[1];
+    /** Colour and data textures the world is drawn to */
+    Renderer::Textures frameTextures{};
     std::unique_ptr<Renderer::ShaderProgram> postProg;
 
+    /// Billboards of every particle, streamed each frame
     GeometryBuffer particleGeom;
     DrawBuffer particleDraw;
+    std::vector<ParticleVertex> particleVertices;
+    std::vector<ParticleBatch> particleBatches;
 
     GeometryBuffer ssRectGeom;
     DrawBuffer ssRectDraw;
 
 public:
-    GameRenderer(Logger* log, GameData* data);
+    GameRenderer(Logger* log, GameData* data,
+                 std::unique_ptr<Renderer> renderer =
+                     std::make_unique<OpenGLRenderer>());
     ~GameRenderer();
 
     std::unique_ptr<Renderer::ShaderProgram> worldProg;
+    /// Draws groups of identical world objects in one call
+    std::unique_ptr<Renderer::ShaderProgram> worldInstancedProg;
     std::unique_ptr<Renderer::ShaderProgram> skyProg;
     std::unique_ptr<Renderer::ShaderProgram> particleProg;
 
@@ -127,6 +138,31 @@ public:
         cullOverride = override;
     }
 
+    /**
+     * @brief Sets how many threads build the object render list
+     * @param threads 0 for one per hardware thread, 1 to build it on the
+     * calling thread only
+     */
+    void setRenderListThreads(unsigned int threads);
+
+    /**
+     * @brief Builds the sorted list of objects visible from the camera
+     *
+     * Objects are split into fixed chunks that are built independently and
+     * joined in order, so the list is the same however many threads build
+     * it. The camera's frustum must be up to date.
+     */
+    RenderList createObjectRenderList(GameWorld* world,
+                                      const ViewCamera& camera, float alpha);
+
+    /**
+     * @brief Saves the object render list of the next frame
+     * @see RenderCapture
+     */
+    void captureRenderList(const std::string& path) {
+        capturePath = path;
+    }
+
     MapRenderer map;
     WaterRenderer water;
     TextRenderer text;
@@ -162,9 +198,13 @@ private:
 
     void drawRect(const glm::vec4& colour, TextureData* texture, glm::vec4& extents);
 
-    void renderObjects(const GameWorld *world);
+    void renderObjects(GameWorld* world);
+
+    /// Threads building the render list, if it isn't built sequentially
+    std::unique_ptr<JobPool> renderListJobs;
 
-    RenderList createObjectRenderList(const GameWorld *world);
+    /// Where to save the next render list, if anywhere
+    std::string capturePath;
 };
 
 #endif
@@ -155,6 +155,14 @@ struct Sky {
             })";
 };
 
+/**
+ * @brief World geometry shaders
+ *
+ * ObjectData holds one object. Batched draws bind it to each draw's range of
+ * a buffer holding the data for many objects, see
+ * OpenGLRenderer::drawBatched. Instanced draws only differ in their model
+ * matrix, which comes from the instance attributes instead.
+ */
 struct WorldObject {
     static constexpr char const* VertexShader =
         R"(
@@ -196,6 +204,43 @@ struct WorldObject {
                 vec4 viewspace = view * worldspace;
                 gl_Position = projection * viewspace;
 
+                WorldSpace = vec4(worldspace.xyz, length(worldspace.xyz - campos.xyz));
+            })";
+    /// Takes the model matrix from the instance attributes, for instanced
+    /// draws of objects that are otherwise identical
+    static constexpr char const* InstancedVertexShader =
+        R"(
+            #version 330
+
+            layout(location = 0) in vec3 position;
+            layout(location = 1) in vec3 normal;
+            layout(location = 2) in vec4 _colour;
+            layout(location = 3) in vec2 texCoords;
+            layout(location = 4) in mat4 instanceModel;
+            out vec3 Normal;
+            out vec2 TexCoords;
+            out vec4 Colour;
+            out vec4 WorldSpace;
+
+            layout(std140) uniform SceneData {
+                mat4 projection;
+                mat4 view;
+                vec4 ambient;
+                vec4 dynamic;
+                vec4 fogColor;
+                vec4 campos;
+                float fogStart;
+                float fogEnd;
+            };
+
+            void main() {
+                Normal = normal;
+                TexCoords = texCoords;
+                Colour = _colour;
+                vec4 worldspace = instanceModel * vec4(position, 1.0);
+                vec4 viewspace = view * worldspace;
+                gl_Position = projection * viewspace;
+
                 WorldSpace = vec4(worldspace.xyz, length(worldspace.xyz - campos.xyz));
             })";
     static constexpr char const* FragmentShader =
@@ -281,7 +326,7 @@ struct Particle {
                 if(c.a <= ALPHA_DISCARD_THRESHOLD) discard;
                 float fogZ = (gl_FragCoord.z / gl_FragCoord.w);
                 float fogfac = clamp( (fogStart-fogZ)/(fogEnd-fogStart), 0.0, 1.0 );
-                vec4 tint = vec4(colour.rgb, visibility);
+                vec4 tint = vec4(colour.rgb * Colour.rgb, visibility);
                 outColour = c * tint;
             })";
 };
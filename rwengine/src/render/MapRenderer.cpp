@@ -53,6 +53,8 @@ MapRenderer::MapRenderer(Renderer &renderer, GameData* _data)
         {{-.5f, -.5f}, {.5f, -.5f}, {.5f, .5f}, {-.5f, .5f}});
     rect.addGeometry(&rectGeom);
     rect.setFaceType(GL_TRIANGLE_FAN);
+    rectOutline.addGeometry(&rectGeom);
+    rectOutline.setFaceType(GL_LINE_LOOP);
 
     std::vector<VertexP2> circleVerts;
     circleVerts.emplace_back(0.f, 0.f);
@@ -100,14 +102,11 @@ void MapRenderer::draw(GameWorld* world, const MapInfo& mi) {
         glm::mat4 circleView = glm::scale(view, glm::vec3(mi.screenSize));
         renderer.setUniform(rectProg.get(), "view", circleView);
         dp.count = 182;
-        glEnable(GL_STENCIL_TEST);
-        glStencilFunc(GL_ALWAYS, 1, 0xFF);
-        glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
-        glStencilMask(0xFF);
-        glColorMask(0x00, 0x00, 0x00, 0x00);
+        renderer.setStencilMode(StencilMode::WRITE);
+        renderer.setColourWrite(false);
         renderer.drawArrays(glm::mat4(1.0f), &circle, dp);
-        glColorMask(0xFF, 0xFF, 0xFF, 0xFF);
-        glStencilFunc(GL_EQUAL, 1, 0xFF);
+        renderer.setColourWrite(true);
+        renderer.setStencilMode(StencilMode::TEST);
     }
 
     view = glm::scale(view, glm::vec3(worldScale));
@@ -148,9 +147,9 @@ void MapRenderer::draw(GameWorld* world, const MapInfo& mi) {
     renderer.setUniform(rectProg.get(), "view", glm::mat4(1.0f));
 
     if (mi.clipToSize) {
-        glDisable(GL_STENCIL_TEST);
+        renderer.setStencilMode(StencilMode::OFF);
         // We only need the outer ring if we're clipping.
-        glBlendFuncSeparate(GL_DST_COLOR, GL_ZERO, GL_ONE, GL_ZERO);
+        dp.blendMode = BlendMode::BLEND_MULTIPLY;
         auto radarDiscTexPtr = data->findSlotTexture("hud", "radardisc");
         dp.textures = {{radarDiscTexPtr->getName()}};
 
@@ -159,8 +158,6 @@ void MapRenderer::draw(GameWorld* world, const MapInfo& mi) {
         model = glm::scale(model, glm::vec3(mi.screenSize * 1.07f));
         renderer.setUniform(rectProg.get(), "model", model);
         renderer.drawArrays(glm::mat4(1.0f), &rect, dp);
-        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE,
-                            GL_ZERO);
     }
 
     // Draw the player blip
@@ -236,12 +233,10 @@ void MapRenderer::draw(GameWorld* world, const MapInfo& mi) {
         }
     }
 
-    /// @TODO migrate to using the renderer
-    renderer.invalidate();
     renderer.popDebugGroup();
 }
 
-void MapRenderer::prepareBlip(const glm::vec2& coord, const glm::mat4& view,
+GLuint MapRenderer::prepareBlip(const glm::vec2& coord, const glm::mat4& view,
                               const MapInfo& mi, const std::string& texture,
                               glm::vec4 colour, float size, float heading) {
     glm::vec2 adjustedCoord = coord;
@@ -269,17 +264,16 @@ void MapRenderer::prepareBlip(const glm::vec2& coord, const glm::mat4& view,
     }
     renderer.setUniform(rectProg.get(), "colour", colour);
 
-    glBindTexture(GL_TEXTURE_2D, tex);
-
-    glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+    return tex;
 }
 
 void MapRenderer::drawBlip(const glm::vec2& coord, const glm::mat4& view,
                            const MapInfo& mi, const std::string& texture,
                            glm::vec4 colour, float size, float heading) {
-    prepareBlip(coord, view, mi, texture, colour, size, heading);
-    glBindVertexArray(rect.getVAOName());
-    glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+    auto dp = blipParameters();
+    dp.textures = {{prepareBlip(coord, view, mi, texture, colour, size,
+                                heading)}};
+    renderer.drawArrays(glm::mat4(1.0f), &rect, dp);
 }
 
 void MapRenderer::drawBlip(const glm::vec2& coord, const glm::mat4& view,
@@ -287,7 +281,16 @@ void MapRenderer::drawBlip(const glm::vec2& coord, const glm::mat4& view,
     drawBlip(coord, view, mi, "", colour, size);
     // Draw outline
     renderer.setUniform(rectProg.get(), "colour", glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-    glDrawArrays(GL_LINE_LOOP, 0, 4);
+    renderer.drawArrays(glm::mat4(1.0f), &rectOutline, blipParameters());
+}
+
+Renderer::DrawParameters MapRenderer::blipParameters() {
+    Renderer::DrawParameters dp;
+    dp.count = 4;
+    dp.blendMode = BlendMode::BLEND_ALPHA;
+    dp.depthWrite = false;
+    dp.textures = {{0}};
+    return dp;
 }
 
 void MapRenderer::scaleHUD(const float scale) {
@@ -45,6 +45,7 @@ private:
 
     GeometryBuffer rectGeom;
     DrawBuffer rect;
+    DrawBuffer rectOutline;
 
     GeometryBuffer circleGeom;
     DrawBuffer circle;
@@ -55,14 +56,20 @@ private:
 
     std::unique_ptr<Renderer::ShaderProgram> rectProg;
 
-    void prepareBlip(const glm::vec2& coord, const glm::mat4& view,
-                     const MapInfo& mi, const std::string& texture,
-                     glm::vec4 colour, float size, float heading);
+    /**
+     * Sets the uniforms to draw a blip
+     * @return The texture to draw it with
+     */
+    GLuint prepareBlip(const glm::vec2& coord, const glm::mat4& view,
+                       const MapInfo& mi, const std::string& texture,
+                       glm::vec4 colour, float size, float heading);
     void drawBlip(const glm::vec2& coord, const glm::mat4& view,
                   const MapInfo& mi, const std::string& texture,
                   glm::vec4 colour, float size, float heading = 0.0f);
     void drawBlip(const glm::vec2& coord, const glm::mat4& view,
                   const MapInfo& mi, glm::vec4 colour, float size);
+
+    static Renderer::DrawParameters blipParameters();
 };
 
 #endif
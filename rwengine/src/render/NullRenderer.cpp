@@ -0,0 +1,273 @@
+#include "render/NullRenderer.hpp"
+
+#include <rw/debug.hpp>
+
+std::string NullRenderer::getIDString() const {
+    return "Null Renderer";
+}
+
+std::unique_ptr<Renderer::ShaderProgram> NullRenderer::createShader(
+    const std::string& vert, const std::string& frag) {
+    RW_UNUSED(vert);
+    RW_UNUSED(frag);
+    return std::make_unique<NullShaderProgram>();
+}
+
+void NullRenderer::setProgramBlockBinding(ShaderProgram* p,
+                                          const std::string& name,
+                                          GLint point) {
+    RW_UNUSED(p);
+    RW_UNUSED(name);
+    RW_UNUSED(point);
+}
+
+void NullRenderer::setUniformTexture(ShaderProgram* p,
+                                     const std::string& name, GLint tex) {
+    RW_UNUSED(name);
+    RW_UNUSED(tex);
+    countUniform(p);
+}
+
+void NullRenderer::setUniform(ShaderProgram* p, const std::string& name,
+                              const glm::mat4& m) {
+    RW_UNUSED(name);
+    RW_UNUSED(m);
+    countUniform(p);
+}
+
+void NullRenderer::setUniform(ShaderProgram* p, const std::string& name,
+                              const glm::vec4& m) {
+    RW_UNUSED(name);
+    RW_UNUSED(m);
+    countUniform(p);
+}
+
+void NullRenderer::setUniform(ShaderProgram* p, const std::string& name,
+                              const glm::vec3& m) {
+    RW_UNUSED(name);
+    RW_UNUSED(m);
+    countUniform(p);
+}
+
+void NullRenderer::setUniform(ShaderProgram* p, const std::string& name,
+                              const glm::vec2& m) {
+    RW_UNUSED(name);
+    RW_UNUSED(m);
+    countUniform(p);
+}
+
+void NullRenderer::setUniform(ShaderProgram* p, const std::string& name,
+                              float f) {
+    RW_UNUSED(name);
+    RW_UNUSED(f);
+    countUniform(p);
+}
+
+void NullRenderer::countUniform(ShaderProgram* p) {
+    useProgram(p);
+    statistics.uniforms++;
+}
+
+void NullRenderer::useProgram(ShaderProgram* p) {
+    if (p != currentProgram) {
+        currentProgram = p;
+        statistics.programs++;
+    }
+}
+
+void NullRenderer::clear(const glm::vec4& colour, bool clearColour,
+                         bool clearDepth, bool clearStencil) {
+    RW_UNUSED(colour);
+    if (clearColour || clearDepth || clearStencil) {
+        statistics.clears++;
+    }
+}
+
+Renderer::Textures NullRenderer::setFrameSize(const glm::ivec2& size) {
+    RW_UNUSED(size);
+    return {};
+}
+
+void NullRenderer::useFrame(bool offscreen) {
+    RW_UNUSED(offscreen);
+    statistics.frames++;
+}
+
+void NullRenderer::setFrameOutput(unsigned int texture) {
+    RW_UNUSED(texture);
+    statistics.frames++;
+}
+
+void NullRenderer::setStencilMode(StencilMode mode) {
+    if (mode != stencilMode) {
+        stencilMode = mode;
+        statistics.states++;
+    }
+}
+
+void NullRenderer::setColourWrite(bool enable) {
+    if (enable != colourWriteEnabled) {
+        colourWriteEnabled = enable;
+        statistics.states++;
+    }
+}
+
+void NullRenderer::setSceneParameters(const SceneUniformData& data) {
+    lastSceneData = data;
+    countUpload();
+}
+
+void NullRenderer::applyDrawState(DrawBuffer* draw, const DrawParameters& p) {
+    auto group = currentGroup();
+
+    if (draw != currentDbuff) {
+        currentDbuff = draw;
+        bufferCounter++;
+        statistics.buffers++;
+        if (group) {
+            group->buffers++;
+        }
+    }
+
+    for (GLuint u = 0; u < p.textures.size(); ++u) {
+        auto& texture = currentTextures[u];
+        if (texture != p.textures[u]) {
+            texture = p.textures[u];
+            textureCounter++;
+            statistics.textures++;
+            if (group) {
+                group->textures++;
+            }
+        }
+    }
+
+    if (p.blendMode != blendMode) {
+        blendMode = p.blendMode;
+        statistics.states++;
+    }
+    if (p.depthWrite != depthWriteEnabled) {
+        depthWriteEnabled = p.depthWrite;
+        statistics.states++;
+    }
+    if (p.depthMode != depthMode) {
+        depthMode = p.depthMode;
+        statistics.states++;
+    }
+
+    drawCounter++;
+    statistics.draws++;
+    statistics.primitives += p.count;
+    if (group) {
+        group->draws++;
+        group->primitives += static_cast<unsigned int>(p.count);
+    }
+}
+
+void NullRenderer::countUpload() {
+    statistics.uploads++;
+    if (auto group = currentGroup()) {
+        group->uploads++;
+    }
+}
+
+void NullRenderer::draw(const glm::mat4& model, DrawBuffer* draw,
+                        const DrawParameters& p) {
+    RW_UNUSED(model);
+    applyDrawState(draw, p);
+    countUpload();
+}
+
+void NullRenderer::drawArrays(const glm::mat4& model, DrawBuffer* draw,
+                              const DrawParameters& p) {
+    RW_UNUSED(model);
+    applyDrawState(draw, p);
+    countUpload();
+}
+
+void NullRenderer::drawBatched(const RenderList& list) {
+    auto program = currentProgram;
+    auto instancedIt = instancedPrograms.find(program);
+    auto instanced =
+        instancedIt != instancedPrograms.end() ? instancedIt->second : nullptr;
+
+    const auto& draws = batcher.build(list, instanced != nullptr);
+
+    // The object data of every draw is written at once
+    if (!draws.empty()) {
+        countUpload();
+    }
+
+    for (const auto& draw : draws) {
+        const auto& ri = *draw.instruction;
+        if (instanced) {
+            useProgram(draw.instanceCount > 0 ? instanced : program);
+        }
+        applyDrawState(ri.dbuff, ri.drawInfo);
+        if (draw.instanceCount > 1) {
+            const auto extra = ri.drawInfo.count * (draw.instanceCount - 1);
+            statistics.primitives += extra;
+            if (auto group = currentGroup()) {
+                group->primitives += static_cast<unsigned int>(extra);
+            }
+        }
+    }
+
+    if (instanced) {
+        useProgram(program);
+    }
+}
+
+void NullRenderer::setInstancedProgram(ShaderProgram* program,
+                                       ShaderProgram* instanced) {
+    if (instanced) {
+        instancedPrograms[program] = instanced;
+    } else {
+        instancedPrograms.erase(program);
+    }
+}
+
+void NullRenderer::invalidate() {
+    currentDbuff = nullptr;
+    currentProgram = nullptr;
+    currentTextures.clear();
+    blendMode = BlendMode::BLEND_NONE;
+    depthMode = DepthMode::OFF;
+}
+
+Renderer::ProfileInfo* NullRenderer::currentGroup() {
+    if (currentDebugDepth == 0) {
+        return nullptr;
+    }
+    return &profileInfo[currentDebugDepth - 1];
+}
+
+void NullRenderer::pushDebugGroup(const std::string& title) {
+    RW_UNUSED(title);
+    RW_ASSERT(currentDebugDepth < MAX_DEBUG_DEPTH);
+
+    profileInfo[currentDebugDepth] = {};
+    groupStart[currentDebugDepth] = std::chrono::steady_clock::now();
+    currentDebugDepth++;
+}
+
+const Renderer::ProfileInfo& NullRenderer::popDebugGroup() {
+    RW_ASSERT(currentDebugDepth > 0);
+    currentDebugDepth--;
+
+    auto& prof = profileInfo[currentDebugDepth];
+    prof.duration = static_cast<GLuint64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - groupStart[currentDebugDepth])
+            .count());
+
+    // Add counters to the parent group
+    if (auto parent = currentGroup()) {
+        parent->draws += prof.draws;
+        parent->buffers += prof.buffers;
+        parent->primitives += prof.primitives;
+        parent->textures += prof.textures;
+        parent->uploads += prof.uploads;
+    }
+
+    return prof;
+}
@@ -0,0 +1,146 @@
+#ifndef _RWENGINE_NULLRENDERER_HPP_
+#define _RWENGINE_NULLRENDERER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <render/OpenGLRenderer.hpp>
+
+/**
+ * @brief Renderer that draws nothing, and counts what it is asked to do.
+ *
+ * It keeps the same state cache as OpenGLRenderer, and plans batched
+ * draws with the same DrawBatcher, so its counts match the draws and state
+ * changes a real frame would make. The exception is object data uploads:
+ * drawBatched counts one per list, where OpenGLRenderer maps its buffer
+ * again each time it wraps around.
+ *
+ * It never calls into GL itself, but the draw buffers, textures and
+ * geometry passed to it are still created by the rwcore GL wrappers and
+ * loaders. GameRenderer and the game data need a GL context even when
+ * drawing through a NullRenderer; only code that is handed its buffers,
+ * like rwrenderreplay --null, runs without one.
+ *
+ * Debug groups are timed on the CPU, with the counters of each group.
+ */
+class NullRenderer final : public Renderer {
+public:
+    /**
+     * Totals since the statistics were last reset
+     */
+    struct Statistics {
+        std::uint64_t draws{};
+        /// Indices or vertices drawn
+        std::uint64_t primitives{};
+        std::uint64_t programs{};
+        std::uint64_t uniforms{};
+        std::uint64_t textures{};
+        std::uint64_t buffers{};
+        /// Object and scene data uploads
+        std::uint64_t uploads{};
+        /// Blend, depth, stencil and colour write changes
+        std::uint64_t states{};
+        std::uint64_t clears{};
+        /// Changes of the frame drawn to
+        std::uint64_t frames{};
+    };
+
+    NullRenderer() = default;
+
+    std::string getIDString() const override;
+
+    std::unique_ptr<ShaderProgram> createShader(
+        const std::string& vert, const std::string& frag) override;
+    void setProgramBlockBinding(ShaderProgram* p, const std::string& name,
+                                GLint point) override;
+    void setUniformTexture(ShaderProgram* p, const std::string& name,
+                           GLint tex) override;
+    void setUniform(ShaderProgram* p, const std::string& name,
+                    const glm::mat4& m) override;
+    void setUniform(ShaderProgram* p, const std::string& name,
+                    const glm::vec4& m) override;
+    void setUniform(ShaderProgram* p, const std::string& name,
+                    const glm::vec3& m) override;
+    void setUniform(ShaderProgram* p, const std::string& name,
+                    const glm::vec2& m) override;
+    void setUniform(ShaderProgram* p, const std::string& name,
+                    float f) override;
+    void useProgram(ShaderProgram* p) override;
+
+    void clear(const glm::vec4& colour, bool clearColour = true,
+               bool clearDepth = true, bool clearStencil = false) override;
+
+    Textures setFrameSize(const glm::ivec2& size) override;
+
+    void useFrame(bool offscreen) override;
+
+    void setFrameOutput(unsigned int texture) override;
+
+    void setStencilMode(StencilMode mode) override;
+
+    void setColourWrite(bool enable) override;
+
+    void setSceneParameters(const SceneUniformData& data) override;
+
+    void draw(const glm::mat4& model, DrawBuffer* draw,
+              const DrawParameters& p) override;
+    void drawArrays(const glm::mat4& model, DrawBuffer* draw,
+                    const DrawParameters& p) override;
+
+    void drawBatched(const RenderList& list) override;
+
+    void setInstancedProgram(ShaderProgram* program,
+                             ShaderProgram* instanced) override;
+
+    void invalidate() override;
+
+    void pushDebugGroup(const std::string& title) override;
+
+    const ProfileInfo& popDebugGroup() override;
+
+    const Statistics& getStatistics() const {
+        return statistics;
+    }
+
+    void resetStatistics() {
+        statistics = {};
+    }
+
+private:
+    class NullShaderProgram final : public ShaderProgram {};
+
+    void applyDrawState(DrawBuffer* draw, const DrawParameters& p);
+
+    void countUniform(ShaderProgram* p);
+
+    void countUpload();
+
+    /// The innermost debug group, if there is one
+    ProfileInfo* currentGroup();
+
+    // State Cache
+    DrawBuffer* currentDbuff = nullptr;
+    ShaderProgram* currentProgram = nullptr;
+    BlendMode blendMode = BlendMode::BLEND_NONE;
+    DepthMode depthMode = DepthMode::OFF;
+    bool depthWriteEnabled = false;
+    StencilMode stencilMode = StencilMode::OFF;
+    bool colourWriteEnabled = true;
+    std::map<GLuint, GLuint> currentTextures;
+
+    // Instancing
+    std::map<ShaderProgram*, ShaderProgram*> instancedPrograms;
+    DrawBatcher batcher;
+
+    Statistics statistics;
+
+    // Debug group profiling
+    ProfileInfo profileInfo[MAX_DEBUG_DEPTH];
+    std::chrono::steady_clock::time_point groupStart[MAX_DEBUG_DEPTH];
+    int currentDebugDepth = 0;
+};
+
+#endif
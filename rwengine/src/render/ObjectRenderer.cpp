@@ -12,6 +12,7 @@
 #include "engine/GameData.hpp"
 #include "engine/GameState.hpp"
 #include "engine/GameWorld.hpp"
+#include "render/RenderSort.hpp"
 #include "render/ViewCamera.hpp"
 
 // Objects that we know how to turn into renderlist entries
@@ -35,11 +36,6 @@ constexpr float kMagicLODDistance = 330.f;
 constexpr float kVehicleLODDistance = 70.f;
 constexpr float kVehicleDrawDistance = 280.f;
 
-RenderKey createKey(float normalizedDepth, Renderer::Textures& textures) {
-    return (uint32_t(0x7FFFFF * normalizedDepth) << 8 |
-            uint8_t(0xFF & (!textures.empty() ? textures[0] : 0)));
-}
-
 void ObjectRenderer::renderGeometry(Geometry* geom,
                                     const glm::mat4& modelMatrix,
                                     GameObject* object, RenderList& outList) {
@@ -105,8 +101,8 @@ void ObjectRenderer::renderGeometry(Geometry* geom,
         float distance = glm::length(m_camera.position - position);
         float depth = (distance - m_camera.frustum.near) /
                       (m_camera.frustum.far - m_camera.frustum.near);
-        outList.emplace_back(createKey(depth * depth, dp.textures), modelMatrix,
-                             &geom->dbuff, dp);
+        outList.emplace_back(createRenderKey(depth * depth, &geom->dbuff, dp),
+                             modelMatrix, &geom->dbuff, dp);
     }
 }
 
@@ -116,20 +112,25 @@ void ObjectRenderer::renderAtomic(Atomic* atomic,
     RW_CHECK(atomic->getGeometry(), "Can't render an atomic without geometry");
     RW_CHECK(atomic->getFrame(), "Can't render an atomic without a frame");
 
-    const auto& geometry = atomic->getGeometry();
     const auto& frame = atomic->getFrame();
+    renderVisibleGeometry(atomic->getGeometry().get(),
+                          worldtransform * frame->getWorldTransform(), object,
+                          render);
+}
 
+void ObjectRenderer::renderVisibleGeometry(Geometry* geometry,
+                                           const glm::mat4& transform,
+                                           GameObject* object,
+                                           RenderList& render) {
     RW::BSGeometryBounds& bounds = geometry->geometryBounds;
 
-    auto transform = worldtransform * frame->getWorldTransform();
-
     glm::vec3 boundpos = bounds.center + glm::vec3(transform[3]);
     if (!m_camera.frustum.intersects(boundpos, bounds.radius)) {
         culled++;
         return;
     }
 
-    renderGeometry(geometry.get(), transform, object, render);
+    renderGeometry(geometry, transform, object, render);
 }
 
 void ObjectRenderer::renderClump(Clump* model, const glm::mat4& worldtransform,
@@ -146,17 +147,15 @@ void ObjectRenderer::renderClump(Clump* model, const glm::mat4& worldtransform,
 
 void ObjectRenderer::renderInstance(InstanceObject* instance,
                                     RenderList& outList) {
-    const auto& atomic = instance->getAtomic();
-    if (!atomic) {
-        return;
-    }
-
     // Only draw visible objects
     if (!instance->isVisible()) {
         return;
     }
 
     auto modelinfo = instance->getModelInfo<SimpleModelInfo>();
+    if (!modelinfo) {
+        return;
+    }
 
     // Handles times provided by TOBJ data
     const auto currentHour = m_world->getHour();
@@ -178,6 +177,21 @@ void ObjectRenderer::renderInstance(InstanceObject* instance,
         return;
     }
 
+    // The model is streamed in once it's within drawing distance, and may
+    // have been evicted since the instance last picked it up
+    if (!modelinfo->isLoaded()) {
+        m_streamRequests.emplace_back(modelinfo->id(),
+                                      instance->getPosition());
+        return;
+    }
+    m_usedModels.push_back(modelinfo);
+
+    // Wait for the instance to pick up the resident model
+    if (!instance->isAtomicCurrent()) {
+        return;
+    }
+    const auto& atomic = instance->getAtomic();
+
     if (modelinfo->isBigBuilding() &&
         mindist < modelinfo->getNearLodDistance() &&
         mindist < kMagicLODDistance) {
@@ -194,36 +208,39 @@ void ObjectRenderer::renderInstance(InstanceObject* instance,
         return;
     }
 
-    if (atomic->getGeometry() != distanceatomic->getGeometry()) {
-        atomic->setGeometry(distanceatomic->getGeometry());
-    }
-
-    // Render the atomic the instance thinks it should be
-    renderAtomic(atomic.get(), glm::mat4(1.0f), instance, outList);
+    // Render the level of detail in the instance's place, leaving its atomic
+    // alone as other threads may be reading it
+    RW_CHECK(atomic->getFrame(), "Can't render an atomic without a frame");
+    renderVisibleGeometry(distanceatomic->getGeometry().get(),
+                          atomic->getFrame()->getWorldTransform(), instance,
+                          outList);
 }
 
-void ObjectRenderer::renderCharacter(CharacterObject* pedestrian,
-                                     RenderList& outList) {
-    const auto& clump = pedestrian->getClump();
+void ObjectRenderer::prepareCharacter(CharacterObject* pedestrian) {
+    if (!pedestrian->getCurrentVehicle()) {
+        return;
+    }
 
-    if (pedestrian->getCurrentVehicle()) {
-        auto vehicle = pedestrian->getCurrentVehicle();
-        const auto& vehicleclump = vehicle->getClump();
-        auto seat = pedestrian->getCurrentSeat();
-        auto matrixModel = vehicleclump->getFrame()->getWorldTransform();
-        if (pedestrian->isEnteringOrExitingVehicle()) {
+    const auto& clump = pedestrian->getClump();
+    auto vehicle = pedestrian->getCurrentVehicle();
+    const auto& vehicleclump = vehicle->getClump();
+    auto seat = pedestrian->getCurrentSeat();
+    auto matrixModel = vehicleclump->getFrame()->getWorldTransform();
+    if (pedestrian->isEnteringOrExitingVehicle()) {
+        matrixModel = glm::translate(matrixModel,
+                                     vehicle->getSeatEntryPosition(seat));
+        clump->getFrame()->setTransform(matrixModel);
+    } else {
+        if (seat < vehicle->info->seats.size()) {
             matrixModel = glm::translate(matrixModel,
-                                         vehicle->getSeatEntryPosition(seat));
+                                         vehicle->info->seats[seat].offset);
             clump->getFrame()->setTransform(matrixModel);
-        } else {
-            if (seat < vehicle->info->seats.size()) {
-                matrixModel = glm::translate(matrixModel,
-                                             vehicle->info->seats[seat].offset);
-                clump->getFrame()->setTransform(matrixModel);
-            }
         }
     }
+}
 
+void ObjectRenderer::renderCharacter(CharacterObject* pedestrian,
+                                     RenderList& outList) {
     renderClump(pedestrian->getClump().get(), glm::mat4(1.0f), nullptr,
                 outList);
 
@@ -240,23 +257,25 @@ void ObjectRenderer::renderCharacter(CharacterObject* pedestrian,
             m_world->data->findModelInfo<SimpleModelInfo>(weapon.modelID);
         RW_CHECK(simple, "Failed to read modelinfo using " << weapon.modelID);
         auto itematomic = simple->getAtomic(0);
+        if (!itematomic) {
+            m_streamRequests.emplace_back(weapon.modelID,
+                                          pedestrian->getPosition());
+            return;
+        }
+        m_usedModels.push_back(simple);
         renderAtomic(itematomic, handFrame->getWorldTransform(), nullptr,
                      outList);
     }
 }
 
-void ObjectRenderer::renderVehicle(VehicleObject* vehicle,
-                                   RenderList& outList) {
-    const auto& clump = vehicle->getClump();
-    RW_CHECK(clump, "Vehicle clump is null");
-    if (!clump) {
+void ObjectRenderer::prepareVehicle(VehicleObject* vehicle) {
+    if (!vehicle->getClump()) {
         return;
     }
 
     float mindist = glm::length(vehicle->getPosition() - m_camera.position) /
                     kVehicleDrawDistanceFactor;
     if (mindist > kVehicleDrawDistance) {
-        culled++;
         return;
     }
 
@@ -266,6 +285,26 @@ void ObjectRenderer::renderVehicle(VehicleObject* vehicle,
         vehicle->getLowLOD()->setFlag(Atomic::ATOMIC_RENDER, !highLOD);
     }
 
+    for (size_t w = 0; w < vehicle->info->wheels.size(); ++w) {
+        vehicle->physVehicle->updateWheelTransform(static_cast<int>(w), false);
+    }
+}
+
+void ObjectRenderer::renderVehicle(VehicleObject* vehicle,
+                                   RenderList& outList) {
+    const auto& clump = vehicle->getClump();
+    RW_CHECK(clump, "Vehicle clump is null");
+    if (!clump) {
+        return;
+    }
+
+    float mindist = glm::length(vehicle->getPosition() - m_camera.position) /
+                    kVehicleDrawDistanceFactor;
+    if (mindist > kVehicleDrawDistance) {
+        culled++;
+        return;
+    }
+
     renderClump(clump.get(), glm::mat4(1.0f), vehicle, outList);
 
     auto modelinfo = vehicle->getVehicle();
@@ -274,12 +313,13 @@ void ObjectRenderer::renderVehicle(VehicleObject* vehicle,
     if (!woi || !woi->isLoaded() || !woi->getDistanceAtomic(mindist)) {
         return;
     }
+    m_usedModels.push_back(woi);
 
     auto wheelatomic = woi->getDistanceAtomic(mindist);
     for (size_t w = 0; w < vehicle->info->wheels.size(); ++w) {
-        auto& wi = vehicle->physVehicle->getWheelInfo(static_cast<int>(w));
         // Construct our own matrix so we can use the local transform
-        vehicle->physVehicle->updateWheelTransform(static_cast<int>(w), false);
+        const auto& wi =
+            vehicle->physVehicle->getWheelInfo(static_cast<int>(w));
         bool isRhino = (vehicle->getVehicle()->vehiclename_ == "RHINO");
 
         auto up = -wi.m_wheelDirectionCS;
@@ -334,9 +374,36 @@ void ObjectRenderer::renderCutsceneObject(CutsceneObject* cutscene,
 void ObjectRenderer::renderProjectile(ProjectileObject* projectile,
                                       RenderList& outList) {
     const auto& atomic = projectile->getAtomic();
+    if (!atomic) {
+        return;
+    }
     renderAtomic(atomic.get(), glm::mat4(1.0f), nullptr, outList);
 }
 
+void ObjectRenderer::flush() {
+    for (const auto& [id, position] : m_streamRequests) {
+        m_world->data->streamer.request(id, position);
+    }
+    for (auto info : m_usedModels) {
+        m_world->data->residency.markUsed(info);
+    }
+    m_streamRequests.clear();
+    m_usedModels.clear();
+}
+
+void ObjectRenderer::prepareObject(GameObject* object) {
+    switch (object->type()) {
+        case GameObject::Character:
+            prepareCharacter(static_cast<CharacterObject*>(object));
+            break;
+        case GameObject::Vehicle:
+            prepareVehicle(static_cast<VehicleObject*>(object));
+            break;
+        default:
+            break;
+    }
+}
+
 void ObjectRenderer::buildRenderList(GameObject* object, RenderList& outList) {
     // Right now specialized on each object type
     switch (object->type()) {
@@ -2,6 +2,12 @@
 #define _RWENGINE_OBJECTRENDERER_HPP_
 
 #include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+#include <data/ModelData.hpp>
 
 #include "render/OpenGLRenderer.hpp"
 
@@ -23,6 +29,12 @@ struct Geometry;
  *
  * Determines what parts of an object are within a camera frustum and exports
  * a list of things to render for the object.
+ *
+ * Objects are changed for drawing, e.g. their level of detail and wheels,
+ * by prepareObject() alone. Once every object has been prepared, separate
+ * ObjectRenderers may build lists in parallel, as building only reads the
+ * objects. Models that have to be streamed in or marked as used are
+ * collected, and passed on by flush().
  */
 class ObjectRenderer {
 public:
@@ -33,6 +45,13 @@ public:
         , m_renderAlpha(renderAlpha) {
     }
 
+    /**
+     * @brief Updates the state that drawing an object depends on, which may be
+     * shared with other objects or the physics world. Must be called on the
+     * main thread before building the object's list.
+     */
+    void prepareObject(GameObject* object);
+
     /**
      * @brief buildRenderList
      *
@@ -60,11 +79,29 @@ public:
      * @param render
      */
     void renderClump(Clump* model, const glm::mat4& worldtransform, GameObject* object, RenderList& render);
+
+    /**
+     * @brief Requests the models that weren't loaded from the streamer, and
+     * marks the models that were drawn as used. Must be called on the main
+     * thread.
+     */
+    void flush();
 private:
     GameWorld* m_world;
     const ViewCamera& m_camera;
     float m_renderAlpha;
 
+    /// Models to stream in, with where they're needed
+    std::vector<std::pair<ModelID, glm::vec3>> m_streamRequests;
+    /// Models drawn since the last flush
+    std::vector<BaseModelInfo*> m_usedModels;
+
+    void prepareCharacter(CharacterObject* pedestrian);
+    void prepareVehicle(VehicleObject* vehicle);
+
+    void renderVisibleGeometry(Geometry* geometry, const glm::mat4& transform,
+                               GameObject* object, RenderList& render);
+
     void renderInstance(InstanceObject* instance, RenderList& outList);
     void renderCharacter(CharacterObject* pedestrian, RenderList& outList);
     void renderVehicle(VehicleObject* vehicle, RenderList& outList);
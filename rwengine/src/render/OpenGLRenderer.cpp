@@ -1,6 +1,9 @@
 #include "render/OpenGLRenderer.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <functional>
+#include <limits>
 #include <sstream>
 
 #include <glm/gtc/matrix_transform.hpp>
@@ -13,6 +16,28 @@
 namespace {
 constexpr GLuint kUBOIndexScene = 1;
 constexpr GLuint kUBOIndexDraw = 2;
+
+/// First of the four attributes holding the instance model matrix
+constexpr GLuint kInstanceModelAttribute = 4;
+/// Fewer identical draws than this are drawn one at a time
+constexpr std::uint32_t kMinInstances = 2;
+constexpr std::uint32_t kNoInstanceGroup =
+    std::numeric_limits<std::uint32_t>::max();
+
+/// Only opaque draws can be reordered to be drawn together
+bool isInstanceable(const Renderer::RenderInstruction& ri) {
+    const auto& p = ri.drawInfo;
+    return ri.dbuff && p.blendMode == BlendMode::BLEND_NONE && p.depthWrite &&
+           p.depthMode == DepthMode::LESS && p.visibility >= 1.f;
+}
+
+Renderer::ObjectUniformData makeObjectData(const glm::mat4& model,
+                                           const Renderer::DrawParameters& p) {
+    return {model,
+            glm::vec4(p.colour.r / 255.f, p.colour.g / 255.f,
+                      p.colour.b / 255.f, p.colour.a / 255.f),
+            1.f, 1.f, p.visibility};
+}
 }
 
 GLuint compileShader(GLenum type, const char* source) {
@@ -173,6 +198,9 @@ void OpenGLRenderer::setBlend(BlendMode mode) {
         case BlendMode::BLEND_ADDITIVE:
             glBlendFunc(GL_ONE, GL_ONE);
             break;
+        case BlendMode::BLEND_MULTIPLY:
+            glBlendFuncSeparate(GL_DST_COLOR, GL_ZERO, GL_ONE, GL_ZERO);
+            break;
 
         }
     }
@@ -198,6 +226,39 @@ void OpenGLRenderer::setDepthWrite(bool enable) {
     }
 }
 
+void OpenGLRenderer::setStencilMode(StencilMode mode) {
+    if (mode == stencilMode) {
+        return;
+    }
+    if (stencilMode == StencilMode::OFF) {
+        glEnable(GL_STENCIL_TEST);
+    }
+    switch (mode) {
+    case StencilMode::OFF:
+        glDisable(GL_STENCIL_TEST);
+        glStencilMask(0xFF);
+        break;
+    case StencilMode::WRITE:
+        glStencilFunc(GL_ALWAYS, 1, 0xFF);
+        glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
+        glStencilMask(0xFF);
+        break;
+    case StencilMode::TEST:
+        glStencilFunc(GL_EQUAL, 1, 0xFF);
+        glStencilMask(0x00);
+        break;
+    }
+    stencilMode = mode;
+}
+
+void OpenGLRenderer::setColourWrite(bool enable) {
+    if (enable != colourWriteEnabled) {
+        const GLboolean mask = enable ? GL_TRUE : GL_FALSE;
+        glColorMask(mask, mask, mask, mask);
+        colourWriteEnabled = enable;
+    }
+}
+
 void OpenGLRenderer::useProgram(Renderer::ShaderProgram* p) {
     if (p != currentProgram) {
         currentProgram = static_cast<OpenGLShaderProgram*>(p);
@@ -219,9 +280,19 @@ OpenGLRenderer::OpenGLRenderer() {
 
     createUBO(UBOObject, MaxUBOSize, sizeof(ObjectUniformData));
 
+    glGenBuffers(1, &instanceBuffer);
+
     swap();
 }
 
+OpenGLRenderer::~OpenGLRenderer() {
+    if (frameBuffer != 0) {
+        glDeleteFramebuffers(1, &frameBuffer);
+        glDeleteTextures(2, frameTextures.data());
+        glDeleteRenderbuffers(1, &frameDepthStencil);
+    }
+}
+
 std::string OpenGLRenderer::getIDString() const {
     std::stringstream ss;
     ss << "OpenGL Renderer";
@@ -292,7 +363,7 @@ void OpenGLRenderer::setUniform(Renderer::ShaderProgram* p,
 }
 
 void OpenGLRenderer::clear(const glm::vec4& colour, bool clearColour,
-                           bool clearDepth) {
+                           bool clearDepth, bool clearStencil) {
     auto flags = 0;
     if (clearColour) {
         flags |= GL_COLOR_BUFFER_BIT;
@@ -303,12 +374,80 @@ void OpenGLRenderer::clear(const glm::vec4& colour, bool clearColour,
         flags |= GL_DEPTH_BUFFER_BIT;
         setDepthWrite(true);
     }
+    // Testing the stencil masks out writes to it, clearing included
+    const bool stencilMasked = stencilMode == StencilMode::TEST;
+    if (clearStencil) {
+        flags |= GL_STENCIL_BUFFER_BIT;
+        glClearStencil(0x00);
+        if (stencilMasked) {
+            glStencilMask(0xFF);
+        }
+    }
 
     glClear(flags);
 
     if (depthWriteWasEnabled != depthWriteEnabled) {
         setDepthWrite(depthWriteWasEnabled);
     }
+    if (clearStencil && stencilMasked) {
+        glStencilMask(0x00);
+    }
+}
+
+Renderer::Textures OpenGLRenderer::setFrameSize(const glm::ivec2& size) {
+    const bool create = frameBuffer == 0;
+    if (create) {
+        glGenFramebuffers(1, &frameBuffer);
+        glGenTextures(2, frameTextures.data());
+        glGenRenderbuffers(1, &frameDepthStencil);
+    }
+
+    if (currentUnit != 0) {
+        glActiveTexture(GL_TEXTURE0);
+        currentUnit = 0;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, frameTextures[0]);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size.x, size.y, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    glBindTexture(GL_TEXTURE_2D, frameTextures[1]);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R16F, size.x, size.y, 0, GL_RED,
+                 GL_FLOAT, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    currentTextures[0] = frameTextures[1];
+
+    glBindRenderbuffer(GL_RENDERBUFFER, frameDepthStencil);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, size.x,
+                          size.y);
+
+    if (create) {
+        GLint previousFrame;
+        glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFrame);
+        glBindFramebuffer(GL_FRAMEBUFFER, frameBuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                               GL_TEXTURE_2D, frameTextures[0], 0);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1,
+                               GL_TEXTURE_2D, frameTextures[1], 0);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT,
+                                  GL_RENDERBUFFER, frameDepthStencil);
+        glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previousFrame));
+    }
+
+    return frameTextures;
+}
+
+void OpenGLRenderer::useFrame(bool offscreen) {
+    glBindFramebuffer(GL_FRAMEBUFFER, offscreen ? frameBuffer : 0);
+    glViewport(0, 0, getViewport().x, getViewport().y);
+}
+
+void OpenGLRenderer::setFrameOutput(unsigned int texture) {
+    const GLenum buffer = GL_COLOR_ATTACHMENT0 + texture;
+    glDrawBuffers(1, &buffer);
 }
 
 void OpenGLRenderer::setSceneParameters(
@@ -319,6 +458,12 @@ void OpenGLRenderer::setSceneParameters(
 
 void OpenGLRenderer::setDrawState(const glm::mat4& model, DrawBuffer* draw,
                                   const Renderer::DrawParameters& p) {
+    applyDrawState(draw, p);
+    uploadUBO(UBOObject, makeObjectData(model, p));
+}
+
+void OpenGLRenderer::applyDrawState(DrawBuffer* draw,
+                                    const Renderer::DrawParameters& p) {
     useDrawBuffer(draw);
 
     for (GLuint u = 0; u < p.textures.size(); ++u) {
@@ -329,12 +474,6 @@ void OpenGLRenderer::setDrawState(const glm::mat4& model, DrawBuffer* draw,
     setDepthWrite(p.depthWrite);
     setDepthMode(p.depthMode);
 
-    ObjectUniformData objectData{model,
-                             glm::vec4(p.colour.r / 255.f, p.colour.g / 255.f,
-                                       p.colour.b / 255.f, p.colour.a / 255.f),
-                             1.f, 1.f, p.visibility};
-    uploadUBO(UBOObject, objectData);
-
     drawCounter++;
 #ifdef RW_GRAPHICS_STATS
     if (currentDebugDepth > 0) {
@@ -362,53 +501,211 @@ void OpenGLRenderer::drawArrays(const glm::mat4& model, DrawBuffer* draw,
 
 void OpenGLRenderer::drawBatched(const RenderList& list) {
     RW_PROFILE_SCOPE(__func__);
-#if 0  // Needs shader changes
-	// Determine how many batches we need to process the entire list
-	auto entries = list.size();
-	glBindBuffer(GL_UNIFORM_BUFFER, UBOObject);
-	for (int b = 0; b < entries; b += maxObjectEntries)
-	{
-		auto toConsume = std::min((GLuint)entries, b + maxObjectEntries) - b;
-		std::vector<ObjectUniformData> uploadBuffer;
-		uploadBuffer.resize(toConsume);
-		for (int d = 0; d < toConsume; ++d)
-		{
-			auto& draw = list[b+d];
-			uploadBuffer[d] = {
-				draw.model,
-				glm::vec4(draw.drawInfo.colour.r/255.f,
-				draw.drawInfo.colour.g/255.f,
-				draw.drawInfo.colour.b/255.f, 1.f),
-				1.f,
-				1.f,
-				draw.drawInfo.colour.a/255.f
-			};
-		}
-		glBufferData(GL_UNIFORM_BUFFER,
-					 toConsume * sizeof(ObjectUniformData),
-					 uploadBuffer.data(),
-					 GL_STREAM_DRAW);
-
-		// Dispatch individual draws
-		for (int d = 0; d < toConsume; ++d)
-		{
-			auto& draw = list[b+d];
-			useDrawBuffer(draw.dbuff);
-
-			for( GLuint u = 0; u < draw.drawInfo.textures.size(); ++u )
-			{
-				useTexture(u, draw.drawInfo.textures[u]);
-			}
-
-			glDrawElements(draw.dbuff->getFaceType(), draw.drawInfo.count, GL_UNSIGNED_INT,
-                           reinterpret_cast<void*>(sizeof(RenderIndex) * draw.drawInfo.start));
-		}
-	}
-#else
-    for (auto& ri : list) {
-        draw(ri.model, ri.dbuff, ri.drawInfo);
+    auto program = currentProgram;
+    auto instancedIt = instancedPrograms.find(program);
+    auto instanced =
+        instancedIt != instancedPrograms.end() ? instancedIt->second : nullptr;
+
+    const auto& batchedDraws = batcher.build(list, instanced != nullptr);
+
+    const auto instances = batcher.getInstanceCount();
+    if (instances > 0) {
+        const auto size =
+            static_cast<GLsizeiptr>(instances * sizeof(glm::mat4));
+        glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+        glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_STREAM_DRAW);
+        auto dst = static_cast<glm::mat4*>(glMapBufferRange(
+            GL_ARRAY_BUFFER, 0, size,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+        RW_ASSERT(dst != nullptr);
+        batcher.writeInstances(list, dst);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
     }
+
+    // Write the object data of as many draws as fit in the rest of the
+    // buffer with one mapping, then bind each draw's range of it
+    auto& buffer = UBOObject;
+    attachUBO(buffer.name);
+
+    std::size_t first = 0;
+    while (first < batchedDraws.size()) {
+        if (buffer.currentEntry >= buffer.entryCount) {
+            // Orphan the buffer, we don't want it anymore
+            glBufferData(GL_UNIFORM_BUFFER, buffer.bufferSize, nullptr,
+                         GL_STREAM_DRAW);
+            buffer.currentEntry = 0;
+        }
+
+        const auto count = std::min<std::size_t>(
+            batchedDraws.size() - first,
+            buffer.entryCount - buffer.currentEntry);
+        const auto base = buffer.currentEntry * buffer.entrySize;
+        const auto flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+                           GL_MAP_UNSYNCHRONIZED_BIT;
+        auto dst = static_cast<char*>(
+            glMapBufferRange(GL_UNIFORM_BUFFER, base,
+                             static_cast<GLsizeiptr>(count * buffer.entrySize),
+                             flags));
+        RW_ASSERT(dst != nullptr);
+        for (std::size_t d = 0; d < count; ++d) {
+            const auto& ri = *batchedDraws[first + d].instruction;
+            const auto data = makeObjectData(ri.model, ri.drawInfo);
+            memcpy(dst + d * buffer.entrySize, &data, sizeof(data));
+        }
+        glUnmapBuffer(GL_UNIFORM_BUFFER);
+#ifdef RW_GRAPHICS_STATS
+        if (currentDebugDepth > 0) {
+            profileInfo[currentDebugDepth - 1].uploads++;
+        }
+#endif
+
+        for (std::size_t d = 0; d < count; ++d) {
+            const auto& draw = batchedDraws[first + d];
+            const auto& ri = *draw.instruction;
+            if (instanced) {
+                useProgram(draw.instanceCount > 0 ? instanced : program);
+            }
+            applyDrawState(ri.dbuff, ri.drawInfo);
+            glBindBufferRange(GL_UNIFORM_BUFFER, kUBOIndexDraw, buffer.name,
+                              base + d * buffer.entrySize,
+                              sizeof(ObjectUniformData));
+
+            const auto indices = reinterpret_cast<void*>(
+                sizeof(RenderIndex) * ri.drawInfo.start);
+            if (draw.instanceCount == 0) {
+                glDrawElements(ri.dbuff->getFaceType(),
+                               static_cast<GLsizei>(ri.drawInfo.count),
+                               GL_UNSIGNED_INT, indices);
+                continue;
+            }
+
+            // GL 3.3 has no base instance, so point the attributes at the
+            // group's matrices. They are kept in the draw buffer's VAO, the
+            // other programs don't read them.
+            glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+            for (GLuint c = 0; c < 4; ++c) {
+                const auto attribute = kInstanceModelAttribute + c;
+                glEnableVertexAttribArray(attribute);
+                glVertexAttribPointer(
+                    attribute, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+                    reinterpret_cast<void*>(
+                        draw.instanceOffset * sizeof(glm::mat4) +
+                        c * sizeof(glm::vec4)));
+                glVertexAttribDivisor(attribute, 1);
+            }
+            glDrawElementsInstanced(
+                ri.dbuff->getFaceType(),
+                static_cast<GLsizei>(ri.drawInfo.count), GL_UNSIGNED_INT,
+                indices, static_cast<GLsizei>(draw.instanceCount));
+#ifdef RW_GRAPHICS_STATS
+            if (currentDebugDepth > 0) {
+                profileInfo[currentDebugDepth - 1].primitives +=
+                    ri.drawInfo.count * (draw.instanceCount - 1);
+            }
 #endif
+        }
+
+        buffer.currentEntry += static_cast<GLuint>(count);
+        first += count;
+    }
+
+    if (instanced) {
+        useProgram(program);
+    }
+}
+
+std::size_t DrawBatcher::InstanceKeyHash::operator()(
+    const InstanceKey& key) const {
+    std::size_t seed = std::hash<DrawBuffer*>()(key.dbuff);
+    auto combine = [&seed](std::size_t value) {
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    };
+    combine(key.start);
+    combine(key.count);
+    combine(key.textures[0]);
+    combine(key.textures[1]);
+    combine(std::size_t(key.colour.r) << 24 | std::size_t(key.colour.g) << 16 |
+            std::size_t(key.colour.b) << 8 | std::size_t(key.colour.a));
+    return seed;
+}
+
+const std::vector<DrawBatcher::BatchedDraw>& DrawBatcher::build(
+    const Renderer::RenderList& list, bool instancing) {
+    batchedDraws.clear();
+    instanceCount = 0;
+    if (!instancing) {
+        for (const auto& ri : list) {
+            batchedDraws.push_back({&ri, 0, 0});
+        }
+        return batchedDraws;
+    }
+
+    instanceGroupIndex.clear();
+    instanceGroups.clear();
+    instructionGroups.assign(list.size(), kNoInstanceGroup);
+    for (std::uint32_t i = 0; i < list.size(); ++i) {
+        const auto& ri = list[i];
+        if (!isInstanceable(ri)) {
+            continue;
+        }
+        InstanceKey key{ri.dbuff, ri.drawInfo.start, ri.drawInfo.count,
+                        ri.drawInfo.textures, ri.drawInfo.colour};
+        auto [it, inserted] = instanceGroupIndex.try_emplace(
+            key, static_cast<std::uint32_t>(instanceGroups.size()));
+        if (inserted) {
+            instanceGroups.push_back({i, 0, 0, 0});
+        }
+        instanceGroups[it->second].count++;
+        instructionGroups[i] = it->second;
+    }
+
+    for (auto& group : instanceGroups) {
+        if (group.count >= kMinInstances) {
+            group.offset = instanceCount;
+            instanceCount += group.count;
+        }
+    }
+
+    // Each group is drawn where its nearest instruction was sorted to, so
+    // the rest of the list stays in front to back order
+    for (std::uint32_t i = 0; i < list.size(); ++i) {
+        const auto group = instructionGroups[i];
+        if (group == kNoInstanceGroup ||
+            instanceGroups[group].count < kMinInstances) {
+            batchedDraws.push_back({&list[i], 0, 0});
+        } else if (instanceGroups[group].first == i) {
+            const auto& g = instanceGroups[group];
+            batchedDraws.push_back({&list[i], g.count, g.offset});
+        }
+    }
+
+    return batchedDraws;
+}
+
+void DrawBatcher::writeInstances(const Renderer::RenderList& list,
+                                 glm::mat4* out) {
+    for (auto& group : instanceGroups) {
+        group.filled = 0;
+    }
+    for (std::size_t i = 0; i < instructionGroups.size(); ++i) {
+        if (instructionGroups[i] == kNoInstanceGroup) {
+            continue;
+        }
+        auto& group = instanceGroups[instructionGroups[i]];
+        if (group.count >= kMinInstances) {
+            out[group.offset + group.filled++] = list[i].model;
+        }
+    }
+}
+
+void OpenGLRenderer::setInstancedProgram(ShaderProgram* program,
+                                         ShaderProgram* instanced) {
+    if (instanced) {
+        instancedPrograms[program] =
+            static_cast<OpenGLShaderProgram*>(instanced);
+    } else {
+        instancedPrograms.erase(program);
+    }
 }
 
 void OpenGLRenderer::invalidate() {
@@ -6,6 +6,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <array>
 
@@ -62,7 +63,9 @@ struct VertexP3 {
 enum class BlendMode {
     BLEND_NONE,
     BLEND_ALPHA,
-    BLEND_ADDITIVE
+    BLEND_ADDITIVE,
+    /// Multiplies the colour already drawn
+    BLEND_MULTIPLY
 };
 
 enum class DepthMode {
@@ -70,6 +73,17 @@ enum class DepthMode {
     LESS,
 };
 
+/**
+ * Enum used to determine how draws use the stencil buffer
+ */
+enum class StencilMode {
+    OFF,
+    /// Marks the pixels drawn to
+    WRITE,
+    /// Only draws to the pixels marked before
+    TEST,
+};
+
 class Renderer {
 public:
     typedef std::array<GLuint,2> Textures;
@@ -182,7 +196,30 @@ public:
                             float f) = 0;
 
     virtual void clear(const glm::vec4& colour, bool clearColour = true,
-                       bool clearDepth = true) = 0;
+                       bool clearDepth = true, bool clearStencil = false) = 0;
+
+    /**
+     * Creates the offscreen frame the world is drawn to, or resizes it. It
+     * has a colour texture, a data texture and a depth-stencil buffer.
+     * @return The colour and data textures
+     */
+    virtual Textures setFrameSize(const glm::ivec2& size) = 0;
+
+    /**
+     * Draws to the offscreen frame, or to the window if false, over the
+     * whole viewport
+     */
+    virtual void useFrame(bool offscreen) = 0;
+
+    /**
+     * Selects the texture of the offscreen frame that draws write colour
+     * to, 0 for the colour texture and 1 for the data texture
+     */
+    virtual void setFrameOutput(unsigned int texture) = 0;
+
+    virtual void setStencilMode(StencilMode mode) = 0;
+
+    virtual void setColourWrite(bool enable) = 0;
 
     virtual void setSceneParameters(const SceneUniformData& data) = 0;
 
@@ -193,6 +230,14 @@ public:
 
     virtual void drawBatched(const RenderList& list) = 0;
 
+    /**
+     * Sets the program drawBatched uses to draw identical opaque
+     * instructions in one call, while program is in use. It takes the
+     * model matrix of each instance from attribute 4.
+     */
+    virtual void setInstancedProgram(ShaderProgram* program,
+                                     ShaderProgram* instanced) = 0;
+
     void setViewport(const glm::ivec2& vp);
     const glm::ivec2& getViewport() const {
         return viewport;
@@ -255,6 +300,83 @@ protected:
     SceneUniformData lastSceneData{};
 };
 
+/**
+ * @brief Plans the draws Renderer::drawBatched makes for a list.
+ *
+ * Opaque instructions that share a draw buffer, index range, textures and
+ * colour are grouped, and each group of two or more is drawn with one
+ * instanced draw in place of its first, nearest instruction. Every other
+ * instruction is drawn on its own, in order. The renderers share it, so
+ * that they make the same draws.
+ */
+class DrawBatcher {
+public:
+    struct BatchedDraw {
+        const Renderer::RenderInstruction* instruction;
+        /// Instances drawn from instanceOffset, 0 for a normal draw
+        std::uint32_t instanceCount;
+        std::uint32_t instanceOffset;
+    };
+
+    /**
+     * Plans the draws for the list, grouping instructions if instancing
+     * @return The draws, valid until the next call
+     */
+    const std::vector<BatchedDraw>& build(const Renderer::RenderList& list,
+                                          bool instancing);
+
+    /**
+     * @return The number of model matrices the instanced draws read
+     */
+    std::uint32_t getInstanceCount() const {
+        return instanceCount;
+    }
+
+    /**
+     * Writes the model matrices of the instanced draws of the list last
+     * built, getInstanceCount() of them
+     */
+    void writeInstances(const Renderer::RenderList& list, glm::mat4* out);
+
+private:
+    /// The state that has to match for draws to be instanced together
+    struct InstanceKey {
+        DrawBuffer* dbuff;
+        std::size_t start;
+        std::size_t count;
+        Renderer::Textures textures;
+        glm::u8vec4 colour;
+
+        bool operator==(const InstanceKey& other) const {
+            return dbuff == other.dbuff && start == other.start &&
+                   count == other.count && textures == other.textures &&
+                   colour == other.colour;
+        }
+    };
+
+    struct InstanceKeyHash {
+        std::size_t operator()(const InstanceKey& key) const;
+    };
+
+    struct InstanceGroup {
+        /// Index of the first instruction in the group
+        std::uint32_t first;
+        std::uint32_t count;
+        /// First matrix of the group in the instance buffer
+        std::uint32_t offset;
+        /// Matrices written so far
+        std::uint32_t filled;
+    };
+
+    std::unordered_map<InstanceKey, std::uint32_t, InstanceKeyHash>
+        instanceGroupIndex;
+    std::vector<InstanceGroup> instanceGroups;
+    /// The group of each instruction in the list being drawn
+    std::vector<std::uint32_t> instructionGroups;
+    std::vector<BatchedDraw> batchedDraws;
+    std::uint32_t instanceCount = 0;
+};
+
 class OpenGLRenderer final : public Renderer {
 public:
     class OpenGLShaderProgram final : public ShaderProgram {
@@ -278,7 +400,7 @@ public:
 
     OpenGLRenderer();
 
-    ~OpenGLRenderer() override = default;
+    ~OpenGLRenderer() override;
 
     std::string getIDString() const override;
 
@@ -301,13 +423,28 @@ public:
     void useProgram(ShaderProgram* p) override;
 
     void clear(const glm::vec4& colour, bool clearColour = true,
-               bool clearDepth = true) override;
+               bool clearDepth = true, bool clearStencil = false) override;
+
+    Textures setFrameSize(const glm::ivec2& size) override;
+
+    void useFrame(bool offscreen) override;
+
+    void setFrameOutput(unsigned int texture) override;
+
+    void setStencilMode(StencilMode mode) override;
+
+    void setColourWrite(bool enable) override;
 
     void setSceneParameters(const SceneUniformData& data) override;
 
     void setDrawState(const glm::mat4& model, DrawBuffer* draw,
                       const DrawParameters& p);
 
+    /**
+     * Binds the state for the draw, without the object data
+     */
+    void applyDrawState(DrawBuffer* draw, const DrawParameters& p);
+
     void draw(const glm::mat4& model, DrawBuffer* draw,
               const DrawParameters& p) override;
     void drawArrays(const glm::mat4& model, DrawBuffer* draw,
@@ -315,6 +452,9 @@ public:
 
     void drawBatched(const RenderList& list) override;
 
+    void setInstancedProgram(ShaderProgram* program,
+                             ShaderProgram* instanced) override;
+
     void invalidate() override;
 
     void pushDebugGroup(const std::string& title) override;
@@ -344,10 +484,22 @@ private:
     BlendMode blendMode = BlendMode::BLEND_NONE;
     DepthMode depthMode = DepthMode::OFF;
     bool depthWriteEnabled = false;
+    StencilMode stencilMode = StencilMode::OFF;
+    bool colourWriteEnabled = true;
     GLuint currentUBO = 0;
     GLuint currentUnit = 0;
     std::map<GLuint, GLuint> currentTextures;
 
+    // Offscreen frame
+    GLuint frameBuffer = 0;
+    Textures frameTextures{};
+    GLuint frameDepthStencil = 0;
+
+    // Instancing
+    std::map<ShaderProgram*, OpenGLShaderProgram*> instancedPrograms;
+    GLuint instanceBuffer = 0;
+    DrawBatcher batcher;
+
     // Set state
     void setBlend(BlendMode mode);
 
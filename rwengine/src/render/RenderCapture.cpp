@@ -0,0 +1,105 @@
+#include "render/RenderCapture.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include <gl/DrawBuffer.hpp>
+
+namespace {
+constexpr char kMagic[4] = {'R', 'W', 'R', 'L'};
+constexpr std::uint32_t kVersion = 1;
+
+template <class T>
+void writeValue(std::ostream& out, const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only plain values can be written");
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+T readValue(std::istream& in) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only plain values can be read");
+    T value;
+    if (!in.read(reinterpret_cast<char*>(&value), sizeof(T))) {
+        throw std::runtime_error("Render capture is truncated");
+    }
+    return value;
+}
+}  // namespace
+
+RenderCapture RenderCapture::create(const RenderList& list,
+                                    const Renderer::SceneUniformData& scene) {
+    RenderCapture capture;
+    capture.scene = scene;
+    capture.draws.reserve(list.size());
+    for (const auto& ri : list) {
+        capture.draws.push_back(
+            {ri.sortKey, ri.model, ri.dbuff ? ri.dbuff->getVAOName() : 0u,
+             ri.dbuff ? ri.dbuff->getFaceType() : GLenum(GL_TRIANGLES),
+             ri.drawInfo});
+    }
+    return capture;
+}
+
+void RenderCapture::write(std::ostream& out) const {
+    out.write(kMagic, sizeof(kMagic));
+    writeValue(out, kVersion);
+    writeValue(out, scene);
+    writeValue(out, static_cast<std::uint64_t>(draws.size()));
+    for (const auto& draw : draws) {
+        const auto& p = draw.drawInfo;
+        writeValue(out, draw.sortKey);
+        writeValue(out, draw.model);
+        writeValue(out, draw.buffer);
+        writeValue(out, draw.faceType);
+        writeValue(out, static_cast<std::uint64_t>(p.count));
+        writeValue(out, static_cast<std::uint64_t>(p.start));
+        writeValue(out, p.textures);
+        writeValue(out, static_cast<std::uint8_t>(p.blendMode));
+        writeValue(out, static_cast<std::uint8_t>(p.depthMode));
+        writeValue(out, static_cast<std::uint8_t>(p.depthWrite));
+        writeValue(out, p.colour);
+        writeValue(out, p.ambient);
+        writeValue(out, p.diffuse);
+        writeValue(out, p.visibility);
+    }
+}
+
+RenderCapture RenderCapture::read(std::istream& in) {
+    char magic[sizeof(kMagic)];
+    if (!in.read(magic, sizeof(magic)) ||
+        !std::equal(std::begin(magic), std::end(magic), std::begin(kMagic))) {
+        throw std::runtime_error("Not a render capture");
+    }
+    if (readValue<std::uint32_t>(in) != kVersion) {
+        throw std::runtime_error("Unsupported render capture version");
+    }
+
+    RenderCapture capture;
+    capture.scene = readValue<Renderer::SceneUniformData>(in);
+    const auto count = readValue<std::uint64_t>(in);
+    for (std::uint64_t i = 0; i < count; ++i) {
+        Draw draw;
+        auto& p = draw.drawInfo;
+        draw.sortKey = readValue<RenderKey>(in);
+        draw.model = readValue<glm::mat4>(in);
+        draw.buffer = readValue<GLuint>(in);
+        draw.faceType = readValue<GLenum>(in);
+        p.count = readValue<std::uint64_t>(in);
+        p.start = readValue<std::uint64_t>(in);
+        p.textures = readValue<Renderer::Textures>(in);
+        p.blendMode = static_cast<BlendMode>(readValue<std::uint8_t>(in));
+        p.depthMode = static_cast<DepthMode>(readValue<std::uint8_t>(in));
+        p.depthWrite = readValue<std::uint8_t>(in) != 0;
+        p.colour = readValue<glm::u8vec4>(in);
+        p.ambient = readValue<float>(in);
+        p.diffuse = readValue<float>(in);
+        p.visibility = readValue<float>(in);
+        capture.draws.push_back(draw);
+    }
+    return capture;
+}
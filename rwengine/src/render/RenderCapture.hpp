@@ -0,0 +1,44 @@
+#ifndef _RWENGINE_RENDERCAPTURE_HPP_
+#define _RWENGINE_RENDERCAPTURE_HPP_
+
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include <render/OpenGLRenderer.hpp>
+
+/**
+ * @brief A render list saved along with the scene it was drawn with.
+ *
+ * Draw buffers and textures are stored by their GL names, which only tell
+ * the draws that share them apart. Replaying a capture needs stand-ins
+ * for them, see rwrenderreplay.
+ *
+ * The file stores the scene data as it is laid out in memory, so it is
+ * only meant to be read back on the same platform.
+ */
+struct RenderCapture {
+    struct Draw {
+        RenderKey sortKey;
+        glm::mat4 model;
+        GLuint buffer;
+        GLenum faceType;
+        Renderer::DrawParameters drawInfo;
+    };
+
+    Renderer::SceneUniformData scene;
+    std::vector<Draw> draws;
+
+    static RenderCapture create(const RenderList& list,
+                                const Renderer::SceneUniformData& scene);
+
+    void write(std::ostream& out) const;
+
+    /**
+     * @throws std::runtime_error if the stream doesn't hold a capture of
+     * this version
+     */
+    static RenderCapture read(std::istream& in);
+};
+
+#endif
@@ -0,0 +1,104 @@
+#include "render/RenderSort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include <gl/DrawBuffer.hpp>
+
+#include "core/Profiler.hpp"
+
+namespace {
+template <unsigned int Bits>
+RenderKey field(std::uint64_t value, unsigned int shift) {
+    return (value & ((RenderKey(1) << Bits) - 1)) << shift;
+}
+
+template <unsigned int Bits>
+std::uint64_t quantize(float value) {
+    value = std::min(std::max(value, 0.f), 1.f);
+    return std::uint64_t(value * float((1u << Bits) - 1));
+}
+
+struct SortEntry {
+    RenderKey key;
+    std::uint32_t index;
+};
+
+constexpr unsigned int kRadixBits = 8;
+constexpr unsigned int kRadixPasses = sizeof(RenderKey) * 8 / kRadixBits;
+constexpr std::size_t kRadixSize = 1 << kRadixBits;
+}  // namespace
+
+RenderKey createRenderKey(float normalizedDepth, const DrawBuffer* dbuff,
+                          const Renderer::DrawParameters& dp) {
+    const std::uint64_t buffer = dbuff ? dbuff->getVAOName() : 0;
+    const std::uint64_t texture = dp.textures[0];
+    const auto blend = std::uint64_t(dp.blendMode);
+    const std::uint64_t depthWrite = dp.depthWrite ? 1 : 0;
+
+    if (dp.blendMode == BlendMode::BLEND_NONE) {
+        return field<1>(0, 63) | field<2>(blend, 61) |
+               field<1>(depthWrite, 60) | field<20>(buffer, 40) |
+               field<20>(texture, 20) |
+               field<20>(quantize<20>(normalizedDepth), 0);
+    }
+
+    return field<1>(1, 63) |
+           field<23>(quantize<23>(1.f - normalizedDepth), 40) |
+           field<2>(blend, 38) | field<1>(depthWrite, 37) |
+           field<18>(buffer, 19) | field<19>(texture, 0);
+}
+
+void sortRenderList(RenderList& list) {
+    RW_PROFILE_SCOPE(__func__);
+    const auto count = list.size();
+    if (count < 2) {
+        return;
+    }
+
+    // Reused between frames to avoid reallocating every time
+    static thread_local std::vector<SortEntry> entries;
+    static thread_local std::vector<SortEntry> scratch;
+    entries.resize(count);
+    scratch.resize(count);
+
+    std::array<std::array<std::size_t, kRadixSize>, kRadixPasses> counts{};
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto key = list[i].sortKey;
+        entries[i] = {key, static_cast<std::uint32_t>(i)};
+        for (auto pass = 0u; pass < kRadixPasses; ++pass) {
+            counts[pass][(key >> (pass * kRadixBits)) & (kRadixSize - 1)]++;
+        }
+    }
+
+    // Least significant digit first, each pass is stable
+    for (auto pass = 0u; pass < kRadixPasses; ++pass) {
+        const auto shift = pass * kRadixBits;
+        auto& histogram = counts[pass];
+
+        // Every key has the same digit, so this pass wouldn't move anything
+        if (histogram[(entries[0].key >> shift) & (kRadixSize - 1)] == count) {
+            continue;
+        }
+
+        std::size_t offset = 0;
+        for (auto& bucket : histogram) {
+            auto size = bucket;
+            bucket = offset;
+            offset += size;
+        }
+        for (const auto& entry : entries) {
+            scratch[histogram[(entry.key >> shift) & (kRadixSize - 1)]++] =
+                entry;
+        }
+        entries.swap(scratch);
+    }
+
+    RenderList sorted;
+    sorted.reserve(count);
+    for (const auto& entry : entries) {
+        sorted.push_back(std::move(list[entry.index]));
+    }
+    list.swap(sorted);
+}
@@ -0,0 +1,45 @@
+#ifndef _RWENGINE_RENDERSORT_HPP_
+#define _RWENGINE_RENDERSORT_HPP_
+
+#include <render/OpenGLRenderer.hpp>
+
+/**
+ * Creates the key a render instruction is sorted by.
+ *
+ * Opaque draws come first, grouped by the state they need so that
+ * consecutive draws share buffers and textures, then front to back:
+ *
+ *   63      pass (0)
+ *   62..61  blend mode
+ *   60      depth write
+ *   59..40  draw buffer
+ *   39..20  texture
+ *   19..0   depth
+ *
+ * Transparent draws have to be drawn back to front, so depth comes before
+ * their state:
+ *
+ *   63      pass (1)
+ *   62..40  depth, inverted
+ *   39..38  blend mode
+ *   37      depth write
+ *   36..19  draw buffer
+ *   18..0   texture
+ *
+ * Names too large for their field only share a group with other names, the
+ * draws still use their own state.
+ *
+ * @param normalizedDepth Depth between the near (0) and far (1) planes
+ */
+RenderKey createRenderKey(float normalizedDepth, const DrawBuffer* dbuff,
+                          const Renderer::DrawParameters& dp);
+
+/**
+ * Sorts the list by the instructions' keys, keeping the order of equal keys.
+ *
+ * The keys are radix sorted along with their indices, and the instructions
+ * moved into place once at the end.
+ */
+void sortRenderList(RenderList& list);
+
+#endif
@@ -14,6 +14,10 @@
 
 namespace {
 
+/// Strings are laid out again once they haven't been drawn for this many
+/// other strings
+constexpr std::size_t kMaxCachedLayouts = 256;
+
 unsigned charToIndex(std::uint16_t g) {
     // Correct for the default font maps
     /// @todo confirm for JA / RU font maps
@@ -177,23 +181,59 @@ void TextRenderer::setFontTexture(font_t font, const std::string& textureName) {
     };
 }
 
-void TextRenderer::renderText(const TextRenderer::TextInfo& ti,
-                              bool forceColour) {
-    if (ti.text.empty() || ti.text[0] == '*')
-        return;
+std::size_t TextRenderer::LayoutKeyHash::operator()(
+    const LayoutKey& key) const {
+    std::size_t seed = 0;
+    auto combine = [&seed](std::size_t value) {
+        seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    };
+    for (auto c : key.text) {
+        combine(c);
+    }
+    combine(key.font);
+    combine(std::hash<float>()(key.size));
+    combine(std::size_t(key.baseColour.r) << 16 |
+            std::size_t(key.baseColour.g) << 8 | key.baseColour.b);
+    combine(std::hash<int>()(key.wrapX));
+    combine(key.forceColour);
+    return seed;
+}
 
-    renderer.getRenderer().pushDebugGroup("Text");
-    renderer.getRenderer().useProgram(textShader.get());
+TextRenderer::TextLayout& TextRenderer::getLayout(const TextInfo& ti,
+                                                  bool forceColour) {
+    LayoutKey key{ti.text, ti.font, ti.size, ti.baseColour, ti.wrapX,
+                  forceColour};
+    auto it = layouts.find(key);
+    if (it == layouts.end()) {
+        // Strings that change every frame, like timers, replace the least
+        // recently drawn ones and reuse their buffers
+        std::unique_ptr<TextLayout> layout;
+        if (layouts.size() >= kMaxCachedLayouts) {
+            auto oldest = std::min_element(
+                layouts.begin(), layouts.end(), [](auto& a, auto& b) {
+                    return a.second->lastUsed < b.second->lastUsed;
+                });
+            layout = std::move(oldest->second);
+            layouts.erase(oldest);
+        } else {
+            layout = std::make_unique<TextLayout>();
+        }
+        buildLayout(ti, forceColour, *layout);
+        it = layouts.emplace(std::move(key), std::move(layout)).first;
+    }
+    it->second->lastUsed = ++layoutUses;
+    return *it->second;
+}
 
+void TextRenderer::buildLayout(const TextInfo& ti, bool forceColour,
+                               TextLayout& layout) const {
     glm::vec2 coord(0.f, 0.f);
-    glm::vec2 alignment = ti.screenPosition;
     // We should track real size not just chars.
     auto lineLength = 0;
 
     glm::vec2 ss(ti.size);
 
     glm::vec3 colour = glm::vec3(ti.baseColour) * (1 / 255.f);
-    glm::vec4 colourBG = glm::vec4(ti.backgroundColour) * (1 / 255.f);
     std::vector<TextVertex> geo;
 
     float maxWidth = 0.f;
@@ -316,6 +356,36 @@ void TextRenderer::renderText(const TextRenderer::TextInfo& ti,
         geo.emplace_back(glm::vec2{p.x + ss.x, p.y + ss.y}, glm::vec2{tex.z, tex.w}, colour);
     }
 
+    layout.maxWidth = maxWidth;
+    layout.maxHeight = maxHeight;
+    layout.glyphSize = ss;
+
+    // A reused layout keeps its buffer and vertex array, and only replaces
+    // the buffer's contents
+    layout.gb.uploadVertices(geo, GL_DYNAMIC_DRAW);
+    if (layout.db.getVAOName() == 0) {
+        layout.db.addGeometry(&layout.gb);
+        layout.db.setFaceType(GL_TRIANGLES);
+    }
+}
+
+void TextRenderer::renderText(const TextRenderer::TextInfo& ti,
+                              bool forceColour) {
+    if (ti.text.empty() || ti.text[0] == '*')
+        return;
+
+    renderer.getRenderer().pushDebugGroup("Text");
+    renderer.getRenderer().useProgram(textShader.get());
+
+    auto& layout = getLayout(ti, forceColour);
+    const auto& fontMetaData = fonts[ti.font];
+    const auto maxWidth = layout.maxWidth;
+    const auto maxHeight = layout.maxHeight;
+    const auto ss = layout.glyphSize;
+
+    glm::vec2 alignment = ti.screenPosition;
+    glm::vec4 colourBG = glm::vec4(ti.backgroundColour) * (1 / 255.f);
+
     if (ti.align == TextInfo::TextAlignment::Right) {
         alignment.x -= maxWidth;
     } else if (ti.align == TextInfo::TextAlignment::Center) {
@@ -336,19 +406,15 @@ void TextRenderer::renderText(const TextRenderer::TextInfo& ti,
     renderer.getRenderer().setUniformTexture(textShader.get(), "fontTexture", 0);
     renderer.getRenderer().setUniform(textShader.get(), "alignment", alignment);
 
-    gb.uploadVertices(geo);
-    db.addGeometry(&gb);
-    db.setFaceType(GL_TRIANGLES);
-
     Renderer::DrawParameters dp;
     dp.start = 0;
     dp.blendMode = BlendMode::BLEND_ALPHA;
-    dp.count = gb.getCount();
+    dp.count = static_cast<std::size_t>(layout.gb.getCount());
     auto fTexturePtr = renderer.getData().findSlotTexture("fonts", fontMetaData.textureName);
     dp.textures = {{fTexturePtr->getName()}};
     dp.depthMode = DepthMode::OFF;
 
-    renderer.getRenderer().drawArrays(glm::mat4(1.0f), &db, dp);
+    renderer.getRenderer().drawArrays(glm::mat4(1.0f), &layout.db, dp);
 
     renderer.getRenderer().popDebugGroup();
 }
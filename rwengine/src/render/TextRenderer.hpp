@@ -2,9 +2,10 @@
 #define _RWENGINE_TEXTRENDERER_HPP_
 
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
-#include <array>
+#include <unordered_map>
 
 #include <gl/DrawBuffer.hpp>
 #include <gl/GeometryBuffer.hpp>
@@ -16,8 +17,9 @@ class GameRenderer;
 /**
  * @brief Handles rendering of bitmap font textures.
  *
- * In future, strings textures might be cached to improve performance, but
- * for now, we just render each glyph on it's own quad
+ * Each glyph is rendered on its own quad. The quads of a string are kept in
+ * a vertex buffer that is reused for as long as the same string is drawn
+ * with the same font, size and colours.
  */
 class TextRenderer {
 public:
@@ -85,12 +87,55 @@ private:
         std::uint8_t monoWidth;
     };
 
+    /// The laid out glyph quads of a string
+    struct TextLayout {
+        GeometryBuffer gb;
+        DrawBuffer db;
+        float maxWidth = 0.f;
+        float maxHeight = 0.f;
+        /// Size of the last glyph
+        glm::vec2 glyphSize{};
+        std::uint64_t lastUsed = 0;
+    };
+
+    /// Everything in TextInfo that changes the layout
+    struct LayoutKey {
+        GameString text;
+        font_t font;
+        float size;
+        glm::u8vec3 baseColour;
+        int wrapX;
+        bool forceColour;
+
+        bool operator==(const LayoutKey& other) const {
+            return text == other.text && font == other.font &&
+                   size == other.size && baseColour == other.baseColour &&
+                   wrapX == other.wrapX && forceColour == other.forceColour;
+        }
+    };
+
+    struct LayoutKeyHash {
+        std::size_t operator()(const LayoutKey& key) const;
+    };
+
+    /**
+     * Returns the cached layout for the text, laying it out if it isn't
+     * cached yet. Once the cache is full, the least recently used layout's
+     * buffers are reused for the new text.
+     */
+    TextLayout& getLayout(const TextInfo& ti, bool forceColour);
+
+    void buildLayout(const TextInfo& ti, bool forceColour,
+                     TextLayout& layout) const;
+
     std::array<FontMetaData, FONTS_COUNT> fonts;
 
     GameRenderer& renderer;
     std::unique_ptr<Renderer::ShaderProgram> textShader;
 
-    GeometryBuffer gb;
-    DrawBuffer db;
+    std::unordered_map<LayoutKey, std::unique_ptr<TextLayout>, LayoutKeyHash>
+        layouts;
+    /// Incremented for every string drawn, to find the least recently used
+    std::uint64_t layoutUses = 0;
 };
 #endif
@@ -33,3 +33,17 @@ bool ViewFrustum::intersects(glm::vec3 center, float radius) const {
 
     return result;
 }
+
+bool ViewFrustum::intersects(const glm::vec3 &min, const glm::vec3 &max) const {
+    for (const auto &plane : planes) {
+        // The corner furthest along the plane's normal
+        glm::vec3 corner(plane.normal.x >= 0.f ? max.x : min.x,
+                         plane.normal.y >= 0.f ? max.y : min.y,
+                         plane.normal.z >= 0.f ? max.z : min.z);
+        if (glm::dot(plane.normal, corner) + plane.distance < 0.f) {
+            return false;
+        }
+    }
+
+    return true;
+}
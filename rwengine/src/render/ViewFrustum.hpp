@@ -32,6 +32,8 @@ public:
     void update(const glm::mat4& proj);
 
     bool intersects(glm::vec3 center, float radius) const;
+
+    bool intersects(const glm::vec3& min, const glm::vec3& max) const;
 };
 
 #endif
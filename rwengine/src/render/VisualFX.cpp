@@ -1 +1,184 @@
 #include "render/VisualFX.hpp"
+
+#include <algorithm>
+
+#include <glm/glm.hpp>
+
+#include <rw/debug.hpp>
+
+ParticleHandle ParticlePool::create(const ParticleFX& particle) {
+    std::uint32_t id;
+    if (!freeIds.empty()) {
+        id = freeIds.back();
+        freeIds.pop_back();
+    } else {
+        id = static_cast<std::uint32_t>(slots.size());
+        slots.push_back(0);
+        generations.push_back(0);
+    }
+
+    slots[id] = static_cast<std::uint32_t>(positions.size());
+    ids.push_back(id);
+    positions.push_back(particle.position);
+    directions.push_back(particle.direction);
+    ups.push_back(particle.up);
+    sizes.push_back(particle.size);
+    colours.push_back(particle.colour);
+    starttimes.push_back(particle.starttime);
+    lifetimes.push_back(particle.lifetime);
+    textures.push_back(particle.texture);
+    orientations.push_back(particle.orientation);
+
+    return {id, generations[id]};
+}
+
+void ParticlePool::destroy(ParticleHandle handle) {
+    if (!isAlive(handle)) {
+        return;
+    }
+
+    const auto i = slots[handle.id];
+    const auto last = positions.size() - 1;
+    if (i != last) {
+        positions[i] = positions[last];
+        directions[i] = directions[last];
+        ups[i] = ups[last];
+        sizes[i] = sizes[last];
+        colours[i] = colours[last];
+        starttimes[i] = starttimes[last];
+        lifetimes[i] = lifetimes[last];
+        textures[i] = textures[last];
+        orientations[i] = orientations[last];
+        ids[i] = ids[last];
+        slots[ids[i]] = i;
+    }
+    positions.pop_back();
+    directions.pop_back();
+    ups.pop_back();
+    sizes.pop_back();
+    colours.pop_back();
+    starttimes.pop_back();
+    lifetimes.pop_back();
+    textures.pop_back();
+    orientations.pop_back();
+    ids.pop_back();
+
+    generations[handle.id]++;
+    freeIds.push_back(handle.id);
+}
+
+bool ParticlePool::isAlive(ParticleHandle handle) const {
+    return handle.id < generations.size() &&
+           generations[handle.id] == handle.generation &&
+           slots[handle.id] < ids.size() && ids[slots[handle.id]] == handle.id;
+}
+
+std::size_t ParticlePool::index(ParticleHandle handle) const {
+    RW_ASSERT(isAlive(handle));
+    return slots[handle.id];
+}
+
+ParticleFX ParticlePool::get(ParticleHandle handle) const {
+    const auto i = index(handle);
+    ParticleFX particle;
+    particle.position = positions[i];
+    particle.direction = directions[i];
+    particle.orientation = orientations[i];
+    particle.starttime = starttimes[i];
+    particle.lifetime = lifetimes[i];
+    particle.texture = textures[i];
+    particle.size = sizes[i];
+    particle.up = ups[i];
+    particle.colour = colours[i];
+    return particle;
+}
+
+void ParticlePool::set(ParticleHandle handle, const ParticleFX& particle) {
+    const auto i = index(handle);
+    positions[i] = particle.position;
+    directions[i] = particle.direction;
+    orientations[i] = particle.orientation;
+    starttimes[i] = particle.starttime;
+    lifetimes[i] = particle.lifetime;
+    textures[i] = particle.texture;
+    sizes[i] = particle.size;
+    ups[i] = particle.up;
+    colours[i] = particle.colour;
+}
+
+void ParticlePool::removeExpired(float gameTime) {
+    // Walk backwards, so the particle moved into a removed one's place has
+    // already been checked
+    for (auto i = positions.size(); i-- > 0;) {
+        if (lifetimes[i] >= 0.f && gameTime >= starttimes[i] + lifetimes[i]) {
+            destroy({ids[i], generations[ids[i]]});
+        }
+    }
+}
+
+void ParticlePool::clear() {
+    for (auto i = positions.size(); i-- > 0;) {
+        destroy({ids[i], generations[ids[i]]});
+    }
+}
+
+void ParticlePool::buildBillboards(const glm::vec3& cameraPosition,
+                                   const glm::vec3& cameraForward,
+                                   std::vector<ParticleVertex>& vertices,
+                                   std::vector<ParticleBatch>& batches) const {
+    vertices.clear();
+    batches.clear();
+
+    order.clear();
+    for (auto i = 0u; i < positions.size(); ++i) {
+        if (textures[i] && sizes[i].x != 0.f && sizes[i].y != 0.f) {
+            order.push_back(i);
+        }
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::uint32_t a, std::uint32_t b) {
+                         return textures[a] < textures[b];
+                     });
+
+    // Corners of the quad as two triangles, with their texture coordinates
+    static const glm::vec2 kCorners[] = {{0.5f, 0.5f},   {-0.5f, 0.5f},
+                                         {0.5f, -0.5f},  {-0.5f, 0.5f},
+                                         {-0.5f, -0.5f}, {0.5f, -0.5f}};
+
+    vertices.reserve(order.size() * 6);
+    for (auto i : order) {
+        const auto& p = positions[i];
+
+        // Figure the direction to the camera center.
+        auto amp = cameraPosition - p;
+        glm::vec3 ptc = ups[i];
+
+        if (orientations[i] == ParticleFX::UpCamera) {
+            ptc = glm::normalize(amp - glm::dot(amp, cameraForward) *
+                                           cameraForward);
+        } else if (orientations[i] == ParticleFX::Camera) {
+            ptc = amp;
+        }
+
+        ptc = glm::normalize(ptc);
+
+        // The axes of the inverse of a view looking along ptc, scaled in
+        // world space as the particle's transform was
+        const auto side = glm::normalize(glm::cross(ptc, {0.f, 0.f, 1.f}));
+        const auto up = glm::cross(side, ptc);
+        const glm::vec3 scale(sizes[i], 1.f);
+        const auto right = scale * side;
+        const auto top = scale * up;
+
+        const auto colour = glm::clamp(colours[i], 0.f, 1.f);
+
+        if (batches.empty() || batches.back().texture != textures[i]) {
+            batches.push_back({textures[i], vertices.size(), 0});
+        }
+        for (const auto& corner : kCorners) {
+            vertices.push_back({p + right * corner.x + top * corner.y,
+                                corner + glm::vec2(0.5f), colour});
+        }
+        batches.back().count += 6;
+    }
+}
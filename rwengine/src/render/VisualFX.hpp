@@ -1,10 +1,15 @@
-﻿#ifndef _RWENGINE_VISUALFX_HPP_
+#ifndef _RWENGINE_VISUALFX_HPP_
 #define _RWENGINE_VISUALFX_HPP_
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
 
+#include <gl/GeometryBuffer.hpp>
 #include <gl/TextureData.hpp>
 
 enum EffectType { Light, Particle, Trail };
@@ -31,7 +36,13 @@ struct LightFX final : public VisualFX {
     }
 };
 
-struct ParticleFX final : public VisualFX {
+/**
+ * Parameters of a particle, see ParticlePool
+ */
+struct ParticleFX {
+    /** World position */
+    glm::vec3 position{};
+
     /** Direction of particle */
     glm::vec3 direction{};
 
@@ -60,14 +71,6 @@ struct ParticleFX final : public VisualFX {
 
     /** Render tint colour */
     glm::vec4 colour{1.f, 1.f, 1.f, 1.f};
-
-    /** Constructs a particle */
-    ParticleFX() = default;
-    ~ParticleFX() override = default;
-
-    EffectType getType() const override {
-        return Particle;
-    }
 };
 
 struct TrailFX final : public VisualFX {
@@ -79,4 +82,128 @@ struct TrailFX final : public VisualFX {
     }
 };
 
+/**
+ * Refers to a particle in a ParticlePool until the particle is destroyed
+ */
+struct ParticleHandle {
+    std::uint32_t id = ~0u;
+    std::uint32_t generation = 0;
+
+    bool operator==(const ParticleHandle& other) const {
+        return id == other.id && generation == other.generation;
+    }
+    bool operator!=(const ParticleHandle& other) const {
+        return !(*this == other);
+    }
+};
+
+/**
+ * Vertex of a particle billboard, in world space
+ */
+struct ParticleVertex {
+    glm::vec3 position{};
+    glm::vec2 texcoord{};
+    glm::vec4 colour{};
+
+    static const AttributeList vertex_attributes() {
+        return {{ATRS_Position, 3, sizeof(ParticleVertex), 0ul},
+                {ATRS_TexCoord, 2, sizeof(ParticleVertex), 3ul * sizeof(float)},
+                {ATRS_Colour, 4, sizeof(ParticleVertex), 5ul * sizeof(float)}};
+    }
+};
+
+/**
+ * Range of billboard vertices sharing a texture, drawn as triangles
+ */
+struct ParticleBatch {
+    TextureData* texture;
+    std::size_t start;
+    std::size_t count;
+};
+
+/**
+ * @brief Stores particles as arrays of each of their parameters.
+ *
+ * Particles are kept packed, so destroying one moves the last particle into
+ * its place. Handles stay valid across this, and stop being valid when
+ * their particle is destroyed.
+ */
+class ParticlePool {
+public:
+    ParticleHandle create(const ParticleFX& particle);
+
+    void destroy(ParticleHandle handle);
+
+    bool isAlive(ParticleHandle handle) const;
+
+    /**
+     * @return The parameters of a live particle
+     */
+    ParticleFX get(ParticleHandle handle) const;
+
+    void set(ParticleHandle handle, const ParticleFX& particle);
+
+    void setPosition(ParticleHandle handle, const glm::vec3& position) {
+        positions[index(handle)] = position;
+    }
+
+    void setSize(ParticleHandle handle, const glm::vec2& size) {
+        sizes[index(handle)] = size;
+    }
+
+    void setColour(ParticleHandle handle, const glm::vec4& colour) {
+        colours[index(handle)] = colour;
+    }
+
+    /**
+     * Destroys every particle whose lifetime has passed at gameTime
+     */
+    void removeExpired(float gameTime);
+
+    std::size_t size() const {
+        return positions.size();
+    }
+
+    bool empty() const {
+        return positions.empty();
+    }
+
+    void clear();
+
+    /**
+     * @brief Builds a camera facing quad for every visible particle.
+     *
+     * Replaces the contents of vertices and batches. Particles are grouped
+     * by texture, with one batch per texture. Particles without a texture
+     * or with no area are skipped.
+     */
+    void buildBillboards(const glm::vec3& cameraPosition,
+                         const glm::vec3& cameraForward,
+                         std::vector<ParticleVertex>& vertices,
+                         std::vector<ParticleBatch>& batches) const;
+
+private:
+    std::size_t index(ParticleHandle handle) const;
+
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> directions;
+    std::vector<glm::vec3> ups;
+    std::vector<glm::vec2> sizes;
+    std::vector<glm::vec4> colours;
+    std::vector<float> starttimes;
+    std::vector<float> lifetimes;
+    std::vector<TextureData*> textures;
+    std::vector<ParticleFX::Orientation> orientations;
+    /// Handle id of each particle
+    std::vector<std::uint32_t> ids;
+
+    /// Particle index of each handle id
+    std::vector<std::uint32_t> slots;
+    std::vector<std::uint32_t> generations;
+    std::vector<std::uint32_t> freeIds;
+
+    /// Particle order used while building billboards
+    mutable std::vector<std::uint32_t> order;
+};
+
 #endif
@@ -113,31 +113,24 @@ void WaterRenderer::render(GameRenderer &renderer, GameWorld* world) {
     wdp.start = 0;
     wdp.count = maskGeom.getCount();
     wdp.textures = {{0}};
+    // Neither the mask nor the screen space grid use the depth buffer
+    wdp.depthMode = DepthMode::OFF;
+    wdp.depthWrite = false;
     glm::mat4 m(1.0);
 
-    glEnable(GL_STENCIL_TEST);
-    glDisable(GL_DEPTH_TEST);
-
-    glStencilFunc(GL_ALWAYS, 1, 0xFF);
-    glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
-    glStencilMask(0xFF);
-
-    GLenum buffers[] = {GL_COLOR_ATTACHMENT1};
-    glDrawBuffers(1, buffers);
-    glClear(GL_STENCIL_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
+    r.setStencilMode(StencilMode::WRITE);
+    r.setFrameOutput(fbOutput);
+    r.clear(glm::vec4(0.f), true, false, true);
 
     r.useProgram(maskProg.get());
 
     r.drawArrays(m, &maskDraw, wdp);
 
-    glStencilFunc(GL_EQUAL, 1, 0xFF);
-    glStencilMask(0x00);
-    glDisable(GL_DEPTH_TEST);
+    r.setStencilMode(StencilMode::TEST);
 
     r.useProgram(waterProg.get());
 
-    buffers[0] = GL_COLOR_ATTACHMENT0;
-    glDrawBuffers(1, buffers);
+    r.setFrameOutput(0);
 
     r.setUniform(waterProg.get(), "time", world->getGameTime());
     r.setUniform(waterProg.get(), "waveParams",
@@ -151,6 +144,5 @@ void WaterRenderer::render(GameRenderer &renderer, GameWorld* world) {
 
     r.drawArrays(m, &gridDraw, wdp);
 
-    glDisable(GL_STENCIL_TEST);
-    glEnable(GL_DEPTH_TEST);
+    r.setStencilMode(StencilMode::OFF);
 }
@@ -5,6 +5,7 @@
 
 void SCMFile::loadFile(char *data, size_t size) {
     _data = std::make_unique<SCMByte[]>(size);
+    _size = size;
     std::copy(data, data + size, _data.get());
 
     // Bytes required to hop over a jump opcode.
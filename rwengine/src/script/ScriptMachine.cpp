@@ -1,8 +1,11 @@
 #include "script/ScriptMachine.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
+#include <iterator>
 
 #include "ai/PlayerController.hpp"
 #include "core/Logger.hpp"
@@ -12,7 +15,7 @@
 #include "script/SCMFile.hpp"
 #include "script/ScriptModule.hpp"
 
-void ScriptMachine::executeThread(SCMThread& t, int msPassed) {
+void ScriptMachine::executeThread(SCMThread& t) {
     auto player = state->world->getPlayer();
 
     if (player) {
@@ -23,103 +26,32 @@ void ScriptMachine::executeThread(SCMThread& t, int msPassed) {
             t.programCounter = t.calls[t.stackDepth];
         }
     }
-    // There is 02a1 opcode that is used only during "Kingdom Come", which
-    // basically acts like a wait command, but waiting time can be skipped
-    // by pressing 'X'? PS2 button
-    if (t.allowWaitSkip && getState()->input[0].pressed(GameInputState::Jump)) {
-        t.wakeCounter = 0;
-        t.allowWaitSkip = false;
-    }
-    if (t.wakeCounter > 0) {
-        t.wakeCounter = std::max(t.wakeCounter - msPassed, 0);
-    }
-    if (t.wakeCounter > 0) return;
-
-    while (t.wakeCounter == 0) {
-        auto pc = t.programCounter;
-        auto opcode = file.read<SCMOpcode>(pc);
-
-        bool isNegatedConditional = ((opcode & SCM_NEGATE_CONDITIONAL_MASK) ==
-                                     SCM_NEGATE_CONDITIONAL_MASK);
-        opcode = opcode & ~SCM_NEGATE_CONDITIONAL_MASK;
-
-        ScriptFunctionMeta* foundcode;
-        if (!module->findOpcode(opcode, &foundcode)) {
-            throw IllegalInstruction(opcode, pc, t.name);
-        }
-        ScriptFunctionMeta& code = *foundcode;
 
-        pc += sizeof(SCMOpcode);
-
-        SCMParams parameters;
-
-        bool hasExtraParameters = code.arguments < 0;
-        auto requiredParams = std::abs(code.arguments);
+    // The timers count the time since they were last brought up to date,
+    // including any time spent sleeping
+    auto elapsed = static_cast<ScriptInt>(clock - t.timerTime);
+    t.timerTime = clock;
+    SCMOpcodeParameter p;
+    p.globalPtr = (t.locals.data() + SCM_TIMER_LOCAL_A * SCM_VARIABLE_SIZE);
+    *p.globalInteger += elapsed;
+    p.globalPtr = (t.locals.data() + SCM_TIMER_LOCAL_B * SCM_VARIABLE_SIZE);
+    *p.globalInteger += elapsed;
 
-        for (int p = 0; p < requiredParams || hasExtraParameters; ++p) {
-            auto type_r = file.read<SCMByte>(pc);
-            auto type = static_cast<SCMType>(type_r);
+    while (t.wakeCounter == 0) {
+        // The opcode may decode further instructions, which can move this
+        // one, so only what's copied out of it is used once it has run
+        const auto& instruction = getInstruction(t.programCounter, t);
+        const auto opcode = instruction.opcode;
+        const auto negated = instruction.negated;
+        const auto& code = *instruction.code;
 
-            if (type_r > 42) {
-                // for implicit strings, we need the byte we just read.
-                type = TString;
-            } else {
-                pc += sizeof(SCMByte);
+        SCMParams parameters = instruction.parameters;
+        for (auto& parameter : parameters) {
+            if (parameter.type == TGlobal) {
+                parameter.globalPtr = globalData.data() + parameter.integer;
+            } else if (parameter.type == TLocal) {
+                parameter.globalPtr = t.locals.data() + parameter.integer;
             }
-
-            parameters.push_back(SCMOpcodeParameter{type, {0}});
-            switch (type) {
-                case EndOfArgList:
-                    hasExtraParameters = false;
-                    break;
-                case TInt8:
-                    parameters.back().integer = file.read<std::int8_t>(pc);
-                    pc += sizeof(SCMByte);
-                    break;
-                case TInt16:
-                    parameters.back().integer = file.read<std::int16_t>(pc);
-                    pc += sizeof(SCMByte) * 2;
-                    break;
-                case TGlobal: {
-                    auto v = file.read<std::uint16_t>(pc);
-                    parameters.back().globalPtr =
-                        globalData.data() + v;  //* SCM_VARIABLE_SIZE;
-                    if (v >= file.getGlobalsSize()) {
-                        state->world->logger->error(
-                            "SCM", "Global Out of bounds! " +
-                                       std::to_string(v) + " " +
-                                       std::to_string(file.getGlobalsSize()));
-                    }
-                    pc += sizeof(SCMByte) * 2;
-                } break;
-                case TLocal: {
-                    auto v = file.read<std::uint16_t>(pc);
-                    parameters.back().globalPtr =
-                        t.locals.data() + v * SCM_VARIABLE_SIZE;
-                    if (v >= SCM_THREAD_LOCAL_SIZE) {
-                        state->world->logger->error("SCM",
-                                                    "Local Out of bounds!");
-                    }
-                    pc += sizeof(SCMByte) * 2;
-                } break;
-                case TInt32:
-                    parameters.back().integer = file.read<std::int32_t>(pc);
-                    pc += sizeof(SCMByte) * 4;
-                    break;
-                case TString:
-                    std::copy(file.data() + pc, file.data() + pc + 8,
-                              parameters.back().string);
-                    pc += sizeof(SCMByte) * 8;
-                    break;
-                case TFloat16:
-                    parameters.back().real =
-                        file.read<std::int16_t>(pc) / 16.f;
-                    pc += sizeof(SCMByte) * 2;
-                    break;
-                default:
-                    throw UnknownType(type, pc, t.name);
-                    break;
-            };
         }
 
         ScriptArguments sca(&parameters, &t, this);
@@ -143,13 +75,20 @@ void ScriptMachine::executeThread(SCMThread& t, int msPassed) {
 #endif
 
         // After debugging has been completed, update the program counter
-        t.programCounter = pc;
+        t.programCounter = instruction.next;
 
         if (code.function) {
-            code.function(sca);
+            if (profiler) {
+                auto start = std::chrono::steady_clock::now();
+                code.function(sca);
+                profiler->addOpcode(opcode, &code,
+                                    std::chrono::steady_clock::now() - start);
+            } else {
+                code.function(sca);
+            }
         }
 
-        if (isNegatedConditional) {
+        if (negated) {
             t.conditionResult = !t.conditionResult;
         }
 
@@ -175,17 +114,117 @@ void ScriptMachine::executeThread(SCMThread& t, int msPassed) {
         }
     }
 
-    SCMOpcodeParameter p;
-    p.globalPtr = (t.locals.data() + 16 * sizeof(SCMByte) * 4);
-    *p.globalInteger += msPassed;
-    p.globalPtr = (t.locals.data() + 17 * sizeof(SCMByte) * 4);
-    *p.globalInteger += msPassed;
-
     if (t.wakeCounter == -1) {
         t.wakeCounter = 0;
     }
 }
 
+const SCMInstruction& ScriptMachine::getInstruction(SCMAddress pc,
+                                                    const SCMThread& t) {
+    if (instructionIndex.size() != file.size()) {
+        instructionIndex.assign(file.size(), 0);
+    }
+    RW_CHECK(pc < instructionIndex.size(), "Program counter out of range");
+
+    auto& index = instructionIndex[pc];
+    if (index == 0) {
+        instructions.push_back(decodeInstruction(pc, t));
+        index = static_cast<std::uint32_t>(instructions.size());
+    }
+    return instructions[index - 1];
+}
+
+SCMInstruction ScriptMachine::decodeInstruction(SCMAddress pc,
+                                                const SCMThread& t) {
+    SCMInstruction instruction;
+    auto opcode = file.read<SCMOpcode>(pc);
+
+    instruction.negated = ((opcode & SCM_NEGATE_CONDITIONAL_MASK) ==
+                           SCM_NEGATE_CONDITIONAL_MASK);
+    instruction.opcode = opcode & ~SCM_NEGATE_CONDITIONAL_MASK;
+
+    if (!module->findOpcode(instruction.opcode, &instruction.code)) {
+        throw IllegalInstruction(instruction.opcode, pc, t.name);
+    }
+    const auto& code = *instruction.code;
+
+    pc += sizeof(SCMOpcode);
+
+    auto& parameters = instruction.parameters;
+
+    bool hasExtraParameters = code.arguments < 0;
+    auto requiredParams = std::abs(code.arguments);
+
+    for (int p = 0; p < requiredParams || hasExtraParameters; ++p) {
+        if (parameters.full()) {
+            throw TooManyParameters(instruction.opcode, pc, t.name);
+        }
+
+        auto type_r = file.read<SCMByte>(pc);
+        auto type = static_cast<SCMType>(type_r);
+
+        if (type_r > 42) {
+            // for implicit strings, we need the byte we just read.
+            type = TString;
+        } else {
+            pc += sizeof(SCMByte);
+        }
+
+        parameters.push_back(SCMOpcodeParameter{type, {0}});
+        switch (type) {
+            case EndOfArgList:
+                hasExtraParameters = false;
+                break;
+            case TInt8:
+                parameters.back().integer = file.read<std::int8_t>(pc);
+                pc += sizeof(SCMByte);
+                break;
+            case TInt16:
+                parameters.back().integer = file.read<std::int16_t>(pc);
+                pc += sizeof(SCMByte) * 2;
+                break;
+            case TGlobal: {
+                // Stored as an offset, resolved when executed
+                auto v = file.read<std::uint16_t>(pc);
+                parameters.back().integer = v;  //* SCM_VARIABLE_SIZE;
+                if (v >= file.getGlobalsSize()) {
+                    state->world->logger->error(
+                        "SCM", "Global Out of bounds! " + std::to_string(v) +
+                                   " " + std::to_string(file.getGlobalsSize()));
+                }
+                pc += sizeof(SCMByte) * 2;
+            } break;
+            case TLocal: {
+                auto v = file.read<std::uint16_t>(pc);
+                parameters.back().integer = v * SCM_VARIABLE_SIZE;
+                if (v >= SCM_THREAD_LOCAL_SIZE) {
+                    state->world->logger->error("SCM", "Local Out of bounds!");
+                }
+                pc += sizeof(SCMByte) * 2;
+            } break;
+            case TInt32:
+                parameters.back().integer = file.read<std::int32_t>(pc);
+                pc += sizeof(SCMByte) * 4;
+                break;
+            case TString:
+                std::copy(file.data() + pc, file.data() + pc + 8,
+                          parameters.back().string);
+                pc += sizeof(SCMByte) * 8;
+                break;
+            case TFloat16:
+                parameters.back().real = file.read<std::int16_t>(pc) / 16.f;
+                pc += sizeof(SCMByte) * 2;
+                break;
+            default:
+                throw UnknownType(type, pc, t.name);
+                break;
+        };
+    }
+
+    instruction.next = pc;
+    return instruction;
+}
+
 ScriptMachine::ScriptMachine(GameState* _state, SCMFile& file,
                              ScriptModule* ops)
     : file(file)
@@ -212,6 +251,10 @@ void ScriptMachine::startThread(SCMThread::pc_t start, bool mission) {
     t.programCounter = start;
     t.baseAddress = start; /* Indicates where negative jumps should jump from */
     t.wakeCounter = 0;
+    t.wakeTime = 0;
+    t.sleeping = false;
+    t.order = nextThreadOrder++;
+    t.timerTime = clock;
     t.isMission = mission;
     t.finished = false;
     t.stackDepth = 0;
@@ -219,6 +262,14 @@ void ScriptMachine::startThread(SCMThread::pc_t start, bool mission) {
     t.wastedOrBusted = false;
     t.allowWaitSkip = false;
     _activeThreads.push_back(t);
+
+    // Threads started while running get to run in the same tick
+    auto thread = std::prev(_activeThreads.end());
+    if (executing) {
+        runQueue.push_back(thread);
+    } else {
+        awakeThreads.push_back(thread);
+    }
 }
 
 SCMByte* ScriptMachine::getGlobals() {
@@ -228,12 +279,135 @@ SCMByte* ScriptMachine::getGlobals() {
 void ScriptMachine::execute(float dt) {
     RW_PROFILE_SCOPEC(__func__, MP_ORANGERED);
     int ms = static_cast<int>(dt * 1000.f);
-    for (auto t = _activeThreads.begin(); t != _activeThreads.end(); ++t) {
-        auto& thread = *t;
-        executeThread(thread, ms);
+    // Threads waiting until the end of this tick run in it
+    const auto tickEnd = clock + static_cast<std::uint64_t>(std::max(ms, 0));
+
+    auto byOrder = [](ThreadIterator a, ThreadIterator b) {
+        return a->order < b->order;
+    };
 
-        if (thread.finished) {
-            t = _activeThreads.erase(t);
+    // There is 02a1 opcode that is used only during "Kingdom Come", which
+    // basically acts like a wait command, but waiting time can be skipped
+    // by pressing 'X'? PS2 button
+    const bool skipWait = getState()->input[0].pressed(GameInputState::Jump);
+
+    // Sleeping threads only need visiting when the player is wasted or
+    // busted, or waits are being skipped
+    auto player = state->world->getPlayer();
+    const bool wastedOrBusted =
+        player && (player->isWasted() || player->isBusted());
+    if (wastedOrBusted || skipWait) {
+        std::vector<SCMThread*> skipped;
+        for (auto& t : _activeThreads) {
+            if (!t.sleeping) {
+                continue;
+            }
+            if (wastedOrBusted && t.isMission && t.deathOrArrestCheck) {
+                t.wastedOrBusted = true;
+                t.stackDepth = 0;
+                t.programCounter = t.calls[t.stackDepth];
+            }
+            if (skipWait && t.allowWaitSkip) {
+                skipped.push_back(&t);
+            }
         }
+        for (auto t : skipped) {
+            t->wakeCounter = 0;
+            t->allowWaitSkip = false;
+            wakeThread(*t);
+        }
+    }
+
+    std::vector<ThreadIterator> woken;
+    woken.swap(wokenThreads);
+    while (!sleepingThreads.empty() &&
+           sleepingThreads.front().wakeTime <= tickEnd) {
+        std::pop_heap(sleepingThreads.begin(), sleepingThreads.end(),
+                      std::greater<>());
+        auto thread = sleepingThreads.back().thread;
+        sleepingThreads.pop_back();
+        thread->sleeping = false;
+        thread->wakeCounter = 0;
+        woken.push_back(thread);
     }
+    std::sort(woken.begin(), woken.end(), byOrder);
+
+    runQueue.clear();
+    std::merge(awakeThreads.begin(), awakeThreads.end(), woken.begin(),
+               woken.end(), std::back_inserter(runQueue), byOrder);
+
+    std::vector<ThreadIterator> stillAwake;
+    executing = true;
+    for (std::size_t i = 0; i < runQueue.size(); ++i) {
+        auto thread = runQueue[i];
+        auto& t = *thread;
+
+        if (t.allowWaitSkip && skipWait) {
+            t.wakeCounter = 0;
+            t.allowWaitSkip = false;
+        }
+        // A wait set while the thread wasn't sleeping, by loading a game
+        if (t.wakeCounter > 0) {
+            t.wakeCounter = std::max(t.wakeCounter - ms, 0);
+        }
+
+        if (t.wakeCounter <= 0) {
+            if (profiler) {
+                auto start = std::chrono::steady_clock::now();
+                executeThread(t);
+                profiler->addThread(t.name,
+                                    std::chrono::steady_clock::now() - start);
+            } else {
+                executeThread(t);
+            }
+        }
+
+        if (t.finished) {
+            _activeThreads.erase(thread);
+        } else if (t.wakeCounter > 0) {
+            sleepThread(thread, tickEnd + static_cast<std::uint64_t>(
+                                              t.wakeCounter));
+        } else {
+            stillAwake.push_back(thread);
+        }
+    }
+    executing = false;
+    runQueue.clear();
+
+    awakeThreads.swap(stillAwake);
+    clock = tickEnd;
+}
+
+void ScriptMachine::setProfiling(bool enabled) {
+    if (!enabled) {
+        profiler.reset();
+    } else if (!profiler) {
+        profiler = std::make_unique<ScriptProfiler>();
+    }
+}
+
+void ScriptMachine::wakeThread(SCMThread& thread) {
+    if (!thread.sleeping) {
+        return;
+    }
+    auto it = std::find_if(
+        sleepingThreads.begin(), sleepingThreads.end(),
+        [&](const SleepingThread& s) { return &*s.thread == &thread; });
+    RW_CHECK(it != sleepingThreads.end(), "Sleeping thread isn't scheduled");
+    if (it == sleepingThreads.end()) {
+        return;
+    }
+    wokenThreads.push_back(it->thread);
+    sleepingThreads.erase(it);
+    std::make_heap(sleepingThreads.begin(), sleepingThreads.end(),
+                   std::greater<>());
+    thread.sleeping = false;
+}
+
+void ScriptMachine::sleepThread(ThreadIterator thread, std::uint64_t wakeTime) {
+    thread->sleeping = true;
+    thread->wakeTime = wakeTime;
+    sleepingThreads.push_back({wakeTime, thread->order, thread});
+    std::push_heap(sleepingThreads.begin(), sleepingThreads.end(),
+                   std::greater<>());
 }
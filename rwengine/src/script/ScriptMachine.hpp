@@ -5,13 +5,16 @@
 #include <cstdint>
 #include <iomanip>
 #include <list>
+#include <memory>
 #include <random>
 #include <sstream>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <script/ScriptProfiler.hpp>
 #include <script/ScriptTypes.hpp>
 
 class GameState;
@@ -20,6 +23,9 @@ class SCMFile;
 #define SCM_NEGATE_CONDITIONAL_MASK 0x8000
 #define SCM_CONDITIONAL_MASK_PASSED 0xFF
 #define SCM_THREAD_LOCAL_SIZE 256
+/* Locals that count up the milliseconds passed, TIMERA and TIMERB */
+#define SCM_TIMER_LOCAL_A 16
+#define SCM_TIMER_LOCAL_B 17
 
 /* Maximum size value that can be stored in each memory address.
  * Changing this will break saves.
@@ -76,6 +82,29 @@ struct UnknownType : SCMException {
     }
 };
 
+struct TooManyParameters : SCMException {
+    SCMOpcode opcode{};
+    unsigned int offset{0};
+    std::string thread;
+
+    template <class String>
+    TooManyParameters(SCMOpcode _opcode, unsigned int _offset,
+                      String&& _thread)
+        : opcode(_opcode)
+        , offset(_offset)
+        , thread(std::forward<String>(_thread)) {
+    }
+
+    std::string what() const override {
+        std::stringstream ss;
+        ss << "Too many parameters for opcode " << std::setfill('0')
+           << std::setw(4) << std::hex << opcode << " at offset "
+           << std::setfill('0') << std::setw(4) << std::hex << offset
+           << " on thread " << thread;
+        return ss.str();
+    }
+};
+
 struct SCMThread {
     typedef SCMAddress pc_t;
 
@@ -90,6 +119,13 @@ struct SCMThread {
 
     /** Number of MS until the thread should be waked (-1 = yielded) */
     int wakeCounter;
+    /** Machine time the thread is waked at, while it is sleeping */
+    std::uint64_t wakeTime;
+    bool sleeping;
+    /** Threads run in the order they were started */
+    std::uint64_t order;
+    /** Machine time the timer locals were last brought up to date */
+    std::uint64_t timerTime;
     std::array<SCMByte, SCM_THREAD_LOCAL_SIZE*(SCM_VARIABLE_SIZE)> locals;
     bool isMission;
 
@@ -105,6 +141,22 @@ struct SCMThread {
     bool allowWaitSkip;
 };
 
+/**
+ * An instruction decoded from the SCM file.
+ *
+ * Variable parameters hold the byte offset of the variable in place of a
+ * pointer, as a local's address depends on the thread running the
+ * instruction.
+ */
+struct SCMInstruction {
+    ScriptFunctionMeta* code = nullptr;
+    SCMOpcode opcode = 0;
+    bool negated = false;
+    /// Address of the instruction that follows
+    SCMAddress next = 0;
+    SCMParams parameters;
+};
+
 /**
  * Implements the actual fetch-execute mechanism for the game script virtual
  * machine.
@@ -164,22 +216,91 @@ public:
         debugFlag = flag;
     }
 
+    /**
+     * @brief Starts or stops counting the time spent in each opcode and
+     * thread. Stopping discards what was counted.
+     */
+    void setProfiling(bool enabled);
+
+    /**
+     * @return The profiler, or nullptr when not profiling
+     */
+    ScriptProfiler* getProfiler() const {
+        return profiler.get();
+    }
+
     /**
      * @brief executes threads until they are all in waiting state.
+     *
+     * Only threads that are awake are visited. Sleeping threads are kept
+     * ordered by the time they wake at, and join the others in the order
+     * they were started.
      */
     void execute(float dt);
 
+    /**
+     * @brief Runs a sleeping thread on the next tick, for changes made to
+     * its wakeCounter or finished flag while it sleeps.
+     */
+    void wakeThread(SCMThread& thread);
+
 private:
     SCMFile& file;
     ScriptModule* module = nullptr;
     GameState* state = nullptr;
     bool debugFlag;
+    std::unique_ptr<ScriptProfiler> profiler;
 
     std::list<SCMThread> _activeThreads;
 
-    void executeThread(SCMThread& t, int msPassed);
+    using ThreadIterator = std::list<SCMThread>::iterator;
+
+    struct SleepingThread {
+        std::uint64_t wakeTime;
+        std::uint64_t order;
+        ThreadIterator thread;
+
+        bool operator>(const SleepingThread& other) const {
+            return std::tie(wakeTime, order) >
+                   std::tie(other.wakeTime, other.order);
+        }
+    };
+
+    /// Milliseconds passed over all ticks so far
+    std::uint64_t clock = 0;
+    std::uint64_t nextThreadOrder = 0;
+    bool executing = false;
+
+    /// Threads that were awake at the end of the last tick, in order
+    std::vector<ThreadIterator> awakeThreads;
+    /// Threads to run in the current tick, threads started while running
+    /// are added to the end
+    std::vector<ThreadIterator> runQueue;
+    /// Min-heap of sleeping threads by wake time
+    std::vector<SleepingThread> sleepingThreads;
+
+    /// Threads taken out of the sleeping threads by wakeThread
+    std::vector<ThreadIterator> wokenThreads;
+
+    void sleepThread(ThreadIterator thread, std::uint64_t wakeTime);
+
+    void executeThread(SCMThread& t);
+
+    /**
+     * Returns the instruction at the address, decoding it on first use.
+     * The script is never modified, so instructions stay valid.
+     */
+    const SCMInstruction& getInstruction(SCMAddress pc, const SCMThread& t);
+
+    SCMInstruction decodeInstruction(SCMAddress pc, const SCMThread& t);
 
     std::vector<SCMByte> globalData;
+
+    /// Instructions decoded so far, decoding may move them
+    std::vector<SCMInstruction> instructions;
+    /// Index in instructions plus one for each address, zero if the
+    /// instruction there hasn't been decoded
+    std::vector<std::uint32_t> instructionIndex;
 };
 
 #endif
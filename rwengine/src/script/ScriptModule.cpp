@@ -4,10 +4,9 @@
 #include "script/ScriptTypes.hpp"
 
 bool ScriptModule::findOpcode(ScriptFunctionID id, ScriptFunctionMeta** out) {
-    auto it = functions.find(id);
-    if (it == functions.end()) {
+    if (id >= opcodes.size() || !opcodes[id]) {
         return false;
     }
-    *out = &functions[id];
+    *out = opcodes[id];
     return true;
 }
@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <script/ScriptTypes.hpp>
 #include "ScriptMachine.hpp"
@@ -139,6 +140,15 @@ void do_unpacked_call(Tret (*const& func)(Targs...),
                       const ScriptArguments& args) {
     script_bind::binder<Tret, Targs...>::call(func, args);
 }
+
+/**
+ * Unpacks the arguments for a function known at compile time, giving a
+ * plain ScriptFunction for each bound function
+ */
+template <auto func>
+void invoke(const ScriptArguments& args) {
+    do_unpacked_call(func, args);
+}
 }  // namespace script_bind
 
 /**
@@ -152,21 +162,30 @@ void do_unpacked_call(Tret (*const& func)(Targs...),
  */
 class ScriptModule {
 public:
+    /// Opcodes are 15 bits, the top bit negates conditions
+    static constexpr size_t kOpcodeCount = 0x8000;
+
     template <class String>
-    ScriptModule(String&& _name) : name(std::forward<String>(_name)) {
+    ScriptModule(String&& _name)
+        : name(std::forward<String>(_name)), opcodes(kOpcodeCount, nullptr) {
     }
 
     const std::string& getName() const {
         return name;
     }
 
-    template <class Tfunc>
-    void bind(ScriptFunctionID id, int argc, Tfunc function) {
-        functions.insert({id,
-                          {[=](const ScriptArguments& args) {
-                               script_bind::do_unpacked_call(function, args);
-                           },
-                           argc, "opcode", ""}});
+    /**
+     * Binds a function to an opcode
+     * @param signature The opcode's name and parameters, as used by script
+     * compilers
+     */
+    template <auto function>
+    void bind(ScriptFunctionID id, int argc, const char* signature) {
+        auto it = functions.insert({id,
+                                    {&script_bind::invoke<function>, argc,
+                                     signature, ""}})
+                      .first;
+        opcodes[id] = &it->second;
     }
 
     bool findOpcode(ScriptFunctionID id, ScriptFunctionMeta** out);
@@ -178,6 +197,9 @@ public:
 private:
     const std::string name;
     std::unordered_map<ScriptFunctionID, ScriptFunctionMeta> functions;
+    /// Functions indexed by opcode, null for opcodes without one. Elements
+    /// of functions keep their address when it grows.
+    std::vector<ScriptFunctionMeta*> opcodes;
 };
 
 #endif
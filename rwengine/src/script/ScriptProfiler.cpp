@@ -0,0 +1,142 @@
+#include "script/ScriptProfiler.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace {
+double toMilliseconds(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::milli>(time).count();
+}
+
+template <class T>
+void sortByTime(std::vector<T>& entries) {
+    std::stable_sort(entries.begin(), entries.end(),
+                     [](const T& a, const T& b) {
+                         return a.counter.time > b.counter.time;
+                     });
+}
+
+std::string jsonString(const std::string& value) {
+    std::string out = "\"";
+    for (auto c : value) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        if (static_cast<unsigned char>(c) >= 0x20) {
+            out += c;
+        }
+    }
+    return out + '"';
+}
+
+std::string csvString(const std::string& value) {
+    std::string out = "\"";
+    for (auto c : value) {
+        if (c == '"') {
+            out += '"';
+        }
+        out += c;
+    }
+    return out + '"';
+}
+
+void writeCounterJSON(std::ostream& out, const ScriptProfiler::Counter& c) {
+    out << "\"calls\": " << c.calls
+        << ", \"total_ms\": " << toMilliseconds(c.time)
+        << ", \"max_ms\": " << toMilliseconds(c.max);
+}
+
+void writeCounterCSV(std::ostream& out, const ScriptProfiler::Counter& c) {
+    out << c.calls << ',' << toMilliseconds(c.time) << ','
+        << toMilliseconds(c.max);
+}
+}  // namespace
+
+void ScriptProfiler::addOpcode(SCMOpcode opcode,
+                               const ScriptFunctionMeta* meta,
+                               std::chrono::nanoseconds time) {
+    auto& total = opcodes[opcode];
+    total.meta = meta;
+    total.counter.add(time);
+}
+
+void ScriptProfiler::addThread(const char* name,
+                               std::chrono::nanoseconds time) {
+    threads[name].add(time);
+}
+
+void ScriptProfiler::clear() {
+    opcodes.clear();
+    threads.clear();
+}
+
+std::vector<ScriptProfiler::OpcodeEntry> ScriptProfiler::getOpcodes() const {
+    std::vector<OpcodeEntry> entries;
+    entries.reserve(opcodes.size());
+    for (const auto& [opcode, total] : opcodes) {
+        entries.push_back(
+            {opcode, total.meta ? total.meta->signature : std::string(),
+             total.counter});
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const OpcodeEntry& a, const OpcodeEntry& b) {
+                  return a.opcode < b.opcode;
+              });
+    sortByTime(entries);
+    return entries;
+}
+
+std::vector<ScriptProfiler::ThreadEntry> ScriptProfiler::getThreads() const {
+    std::vector<ThreadEntry> entries;
+    entries.reserve(threads.size());
+    for (const auto& [name, counter] : threads) {
+        entries.push_back({name, counter});
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const ThreadEntry& a, const ThreadEntry& b) {
+                  return a.name < b.name;
+              });
+    sortByTime(entries);
+    return entries;
+}
+
+void ScriptProfiler::writeCSV(std::ostream& out) const {
+    out << std::fixed << std::setprecision(4);
+    out << "opcode,signature,calls,total_ms,max_ms\n";
+    for (const auto& entry : getOpcodes()) {
+        out << std::hex << std::setfill('0') << std::setw(4) << entry.opcode
+            << std::dec << ',' << csvString(entry.signature) << ',';
+        writeCounterCSV(out, entry.counter);
+        out << '\n';
+    }
+    out << "\nthread,calls,total_ms,max_ms\n";
+    for (const auto& entry : getThreads()) {
+        out << csvString(entry.name) << ',';
+        writeCounterCSV(out, entry.counter);
+        out << '\n';
+    }
+}
+
+void ScriptProfiler::writeJSON(std::ostream& out) const {
+    out << std::fixed << std::setprecision(4);
+    out << "{\n  \"opcodes\": [";
+    const char* separator = "\n";
+    for (const auto& entry : getOpcodes()) {
+        out << separator << "    {\"opcode\": \"" << std::hex
+            << std::setfill('0') << std::setw(4) << entry.opcode << std::dec
+            << "\", \"signature\": " << jsonString(entry.signature) << ", ";
+        writeCounterJSON(out, entry.counter);
+        out << '}';
+        separator = ",\n";
+    }
+    out << "\n  ],\n  \"threads\": [";
+    separator = "\n";
+    for (const auto& entry : getThreads()) {
+        out << separator << "    {\"name\": " << jsonString(entry.name)
+            << ", ";
+        writeCounterJSON(out, entry.counter);
+        out << '}';
+        separator = ",\n";
+    }
+    out << "\n  ]\n}\n";
+}
@@ -0,0 +1,82 @@
+#ifndef _RWENGINE_SCRIPTPROFILER_HPP_
+#define _RWENGINE_SCRIPTPROFILER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "script/ScriptTypes.hpp"
+
+/**
+ * @brief Counts the calls and time spent in each opcode and thread.
+ *
+ * Opcode times cover only the opcode's function, thread times cover each
+ * tick the thread ran in, so they include the opcodes and the interpreter
+ * overhead around them.
+ */
+class ScriptProfiler {
+public:
+    struct Counter {
+        std::uint64_t calls = 0;
+        std::chrono::nanoseconds time{};
+        /// Longest single call
+        std::chrono::nanoseconds max{};
+
+        void add(std::chrono::nanoseconds t) {
+            calls++;
+            time += t;
+            if (t > max) {
+                max = t;
+            }
+        }
+    };
+
+    struct OpcodeEntry {
+        SCMOpcode opcode;
+        std::string signature;
+        Counter counter;
+    };
+
+    struct ThreadEntry {
+        std::string name;
+        Counter counter;
+    };
+
+    void addOpcode(SCMOpcode opcode, const ScriptFunctionMeta* meta,
+                   std::chrono::nanoseconds time);
+
+    void addThread(const char* name, std::chrono::nanoseconds time);
+
+    void clear();
+
+    /**
+     * @return The opcodes that were called, most time spent first
+     */
+    std::vector<OpcodeEntry> getOpcodes() const;
+
+    /**
+     * @return The threads that ran, most time spent first
+     */
+    std::vector<ThreadEntry> getThreads() const;
+
+    /**
+     * Writes a table of the opcodes followed by one of the threads
+     */
+    void writeCSV(std::ostream& out) const;
+
+    void writeJSON(std::ostream& out) const;
+
+private:
+    struct OpcodeTotal {
+        const ScriptFunctionMeta* meta = nullptr;
+        Counter counter;
+    };
+
+    std::unordered_map<SCMOpcode, OpcodeTotal> opcodes;
+    std::unordered_map<std::string, Counter> threads;
+};
+
+#endif
@@ -9,9 +9,13 @@
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -238,7 +242,94 @@ struct SCMOpcodeParameter {
     }
 };
 
-typedef std::vector<SCMOpcodeParameter> SCMParams;
+/**
+ * @brief The parameters of an instruction.
+ *
+ * Capacity is fixed so that the parameters can live on the stack while the
+ * instruction runs. The most any opcode takes is 18, for a new thread with
+ * all 16 of its locals.
+ */
+class SCMParams {
+public:
+    static constexpr std::size_t kCapacity = 24;
+
+    using iterator = SCMOpcodeParameter*;
+    using const_iterator = const SCMOpcodeParameter*;
+
+    SCMParams() = default;
+
+    // Only the parameters in use are copied
+    SCMParams(const SCMParams& other) : count(other.count) {
+        std::copy(other.begin(), other.end(), items.begin());
+    }
+
+    SCMParams& operator=(const SCMParams& other) {
+        if (this != &other) {
+            count = other.count;
+            std::copy(other.begin(), other.end(), items.begin());
+        }
+        return *this;
+    }
+
+    std::size_t size() const {
+        return count;
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    bool full() const {
+        return count == kCapacity;
+    }
+
+    /**
+     * Appends a parameter, the list must not be full
+     */
+    void push_back(const SCMOpcodeParameter& parameter) {
+        RW_ASSERT(!full());
+        items[count++] = parameter;
+    }
+
+    SCMOpcodeParameter& back() {
+        return items[count - 1];
+    }
+
+    SCMOpcodeParameter& operator[](std::size_t i) {
+        return items[i];
+    }
+
+    const SCMOpcodeParameter& operator[](std::size_t i) const {
+        return items[i];
+    }
+
+    const SCMOpcodeParameter& at(std::size_t i) const {
+        if (i >= count) {
+            throw std::out_of_range("SCMParams::at");
+        }
+        return items[i];
+    }
+
+    iterator begin() {
+        return items.data();
+    }
+
+    iterator end() {
+        return items.data() + count;
+    }
+
+    const_iterator begin() const {
+        return items.data();
+    }
+
+    const_iterator end() const {
+        return items.data() + count;
+    }
+
+private:
+    std::array<SCMOpcodeParameter, kCapacity> items;
+    std::size_t count = 0;
+};
 
 class ScriptArguments {
     const SCMParams* parameters;
@@ -359,8 +450,8 @@ template <>
 ScriptObjectType<Sound> ScriptArguments::getScriptObject(
     unsigned int arg) const;
 
-typedef std::function<void(const ScriptArguments&)> ScriptFunction;
-typedef std::function<bool(const ScriptArguments&)> ScriptFunctionBoolean;
+typedef void (*ScriptFunction)(const ScriptArguments&);
+typedef bool (*ScriptFunctionBoolean)(const ScriptArguments&);
 typedef uint16_t ScriptFunctionID;
 
 struct ScriptFunctionMeta {
@@ -16,908 +16,1157 @@
 GTA3Module::GTA3Module() : ScriptModule("GTA3") {
     reserveFunctions(903);
 
-    bind(0x0000, 0, opcode_0000);
-    bind(0x0001, 1, opcode_0001);
-    bind(0x0002, 1, opcode_0002);
-    bind(0x0003, 1, opcode_0003);
-    bind(0x0004, 2, opcode_0004);
-    bind(0x0005, 2, opcode_0005);
-    bind(0x0006, 2, opcode_0006);
-    bind(0x0007, 2, opcode_0007);
-    bind(0x0008, 2, opcode_0008);
-    bind(0x0009, 2, opcode_0009);
-    bind(0x000a, 2, opcode_000a);
-    bind(0x000b, 2, opcode_000b);
-    bind(0x000c, 2, opcode_000c);
-    bind(0x000d, 2, opcode_000d);
-    bind(0x000e, 2, opcode_000e);
-    bind(0x000f, 2, opcode_000f);
-    bind(0x0010, 2, opcode_0010);
-    bind(0x0011, 2, opcode_0011);
-    bind(0x0012, 2, opcode_0012);
-    bind(0x0013, 2, opcode_0013);
-    bind(0x0014, 2, opcode_0014);
-    bind(0x0015, 2, opcode_0015);
-    bind(0x0016, 2, opcode_0016);
-    bind(0x0017, 2, opcode_0017);
-    bind(0x0018, 2, opcode_0018);
-    bind(0x0019, 2, opcode_0019);
-    bind(0x001a, 2, opcode_001a);
-    bind(0x001b, 2, opcode_001b);
-    bind(0x001c, 2, opcode_001c);
-    bind(0x001d, 2, opcode_001d);
-    bind(0x001e, 2, opcode_001e);
-    bind(0x001f, 2, opcode_001f);
-    bind(0x0020, 2, opcode_0020);
-    bind(0x0021, 2, opcode_0021);
-    bind(0x0022, 2, opcode_0022);
-    bind(0x0023, 2, opcode_0023);
-    bind(0x0024, 2, opcode_0024);
-    bind(0x0025, 2, opcode_0025);
-    bind(0x0026, 2, opcode_0026);
-    bind(0x0027, 2, opcode_0027);
-    bind(0x0028, 2, opcode_0028);
-    bind(0x0029, 2, opcode_0029);
-    bind(0x002a, 2, opcode_002a);
-    bind(0x002b, 2, opcode_002b);
-    bind(0x002c, 2, opcode_002c);
-    bind(0x002d, 2, opcode_002d);
-    bind(0x002e, 2, opcode_002e);
-    bind(0x002f, 2, opcode_002f);
-    bind(0x0030, 2, opcode_0030);
-    bind(0x0031, 2, opcode_0031);
-    bind(0x0032, 2, opcode_0032);
-    bind(0x0033, 2, opcode_0033);
-    bind(0x0034, 2, opcode_0034);
-    bind(0x0035, 2, opcode_0035);
-    bind(0x0036, 2, opcode_0036);
-    bind(0x0037, 2, opcode_0037);
-    bind(0x0038, 2, opcode_0038);
-    bind(0x0039, 2, opcode_0039);
-    bind(0x003a, 2, opcode_003a);
-    bind(0x003b, 2, opcode_003b);
-    bind(0x003c, 2, opcode_003c);
-    bind(0x0042, 2, opcode_0042);
-    bind(0x0043, 2, opcode_0043);
-    bind(0x0044, 2, opcode_0044);
-    bind(0x0045, 2, opcode_0045);
-    bind(0x0046, 2, opcode_0046);
-    bind(0x004c, 1, opcode_004c);
-    bind(0x004d, 1, opcode_004d);
-    bind(0x004e, 0, opcode_004e);
-    bind(0x004f, -1, opcode_004f);
-    bind(0x0050, 1, opcode_0050);
-    bind(0x0051, 0, opcode_0051);
-    bind(0x0053, 5, opcode_0053);
-    bind(0x0054, 4, opcode_0054);
-    bind(0x0055, 4, opcode_0055);
-    bind(0x0056, 6, opcode_0056);
-    bind(0x0057, 8, opcode_0057);
-    bind(0x0058, 2, opcode_0058);
-    bind(0x0059, 2, opcode_0059);
-    bind(0x005a, 2, opcode_005a);
-    bind(0x005b, 2, opcode_005b);
-    bind(0x005c, 2, opcode_005c);
-    bind(0x005d, 2, opcode_005d);
-    bind(0x005e, 2, opcode_005e);
-    bind(0x005f, 2, opcode_005f);
-    bind(0x0060, 2, opcode_0060);
-    bind(0x0061, 2, opcode_0061);
-    bind(0x0062, 2, opcode_0062);
-    bind(0x0063, 2, opcode_0063);
-    bind(0x0064, 2, opcode_0064);
-    bind(0x0065, 2, opcode_0065);
-    bind(0x0066, 2, opcode_0066);
-    bind(0x0067, 2, opcode_0067);
-    bind(0x0068, 2, opcode_0068);
-    bind(0x0069, 2, opcode_0069);
-    bind(0x006a, 2, opcode_006a);
-    bind(0x006b, 2, opcode_006b);
-    bind(0x006c, 2, opcode_006c);
-    bind(0x006d, 2, opcode_006d);
-    bind(0x006e, 2, opcode_006e);
-    bind(0x006f, 2, opcode_006f);
-    bind(0x0070, 2, opcode_0070);
-    bind(0x0071, 2, opcode_0071);
-    bind(0x0072, 2, opcode_0072);
-    bind(0x0073, 2, opcode_0073);
-    bind(0x0074, 2, opcode_0074);
-    bind(0x0075, 2, opcode_0075);
-    bind(0x0076, 2, opcode_0076);
-    bind(0x0077, 2, opcode_0077);
-    bind(0x0078, 2, opcode_0078);
-    bind(0x0079, 2, opcode_0079);
-    bind(0x007a, 2, opcode_007a);
-    bind(0x007b, 2, opcode_007b);
-    bind(0x007c, 2, opcode_007c);
-    bind(0x007d, 2, opcode_007d);
-    bind(0x007e, 2, opcode_007e);
-    bind(0x007f, 2, opcode_007f);
-    bind(0x0080, 2, opcode_0080);
-    bind(0x0081, 2, opcode_0081);
-    bind(0x0082, 2, opcode_0082);
-    bind(0x0083, 2, opcode_0083);
-    bind(0x0084, 2, opcode_0084);
-    bind(0x0085, 2, opcode_0085);
-    bind(0x0086, 2, opcode_0086);
-    bind(0x0087, 2, opcode_0087);
-    bind(0x0088, 2, opcode_0088);
-    bind(0x0089, 2, opcode_0089);
-    bind(0x008a, 2, opcode_008a);
-    bind(0x008b, 2, opcode_008b);
-    bind(0x008c, 2, opcode_008c);
-    bind(0x008d, 2, opcode_008d);
-    bind(0x008e, 2, opcode_008e);
-    bind(0x008f, 2, opcode_008f);
-    bind(0x0090, 2, opcode_0090);
-    bind(0x0091, 2, opcode_0091);
-    bind(0x0092, 2, opcode_0092);
-    bind(0x0093, 2, opcode_0093);
-    bind(0x0094, 1, opcode_0094);
-    bind(0x0095, 1, opcode_0095);
-    bind(0x0096, 1, opcode_0096);
-    bind(0x0097, 1, opcode_0097);
-    bind(0x0098, 1, opcode_0098);
-    bind(0x0099, 1, opcode_0099);
-    bind(0x009a, 6, opcode_009a);
-    bind(0x009b, 1, opcode_009b);
-    bind(0x009c, 2, opcode_009c);
-    bind(0x009d, 0, opcode_009d);
-    bind(0x009e, 4, opcode_009e);
-    bind(0x009f, 1, opcode_009f);
-    bind(0x00a0, 4, opcode_00a0);
-    bind(0x00a1, 4, opcode_00a1);
-    bind(0x00a2, 1, opcode_00a2);
-    bind(0x00a3, 6, opcode_00a3);
-    bind(0x00a4, 8, opcode_00a4);
-    bind(0x00a5, 5, opcode_00a5);
-    bind(0x00a6, 1, opcode_00a6);
-    bind(0x00a7, 4, opcode_00a7);
-    bind(0x00a8, 1, opcode_00a8);
-    bind(0x00a9, 1, opcode_00a9);
-    bind(0x00aa, 4, opcode_00aa);
-    bind(0x00ab, 4, opcode_00ab);
-    bind(0x00ac, 1, opcode_00ac);
-    bind(0x00ad, 2, opcode_00ad);
-    bind(0x00ae, 2, opcode_00ae);
-    bind(0x00af, 2, opcode_00af);
-    bind(0x00b0, 6, opcode_00b0);
-    bind(0x00b1, 8, opcode_00b1);
-    bind(0x00ba, 3, opcode_00ba);
-    bind(0x00bb, 3, opcode_00bb);
-    bind(0x00bc, 3, opcode_00bc);
-    bind(0x00bd, 3, opcode_00bd);
-    bind(0x00be, 0, opcode_00be);
-    bind(0x00bf, 2, opcode_00bf);
-    bind(0x00c0, 2, opcode_00c0);
-    bind(0x00c1, 3, opcode_00c1);
-    bind(0x00c2, 4, opcode_00c2);
-    bind(0x00c3, 0, opcode_00c3);
-    bind(0x00c4, 0, opcode_00c4);
-    bind(0x00c5, 0, opcode_00c5);
-    bind(0x00c6, 0, opcode_00c6);
-    bind(0x00d6, 1, opcode_00d6);
-    bind(0x00d7, 1, opcode_00d7);
-    bind(0x00d8, 0, opcode_00d8);
-    bind(0x00d9, 2, opcode_00d9);
-    bind(0x00da, 2, opcode_00da);
-    bind(0x00db, 2, opcode_00db);
-    bind(0x00dc, 2, opcode_00dc);
-    bind(0x00dd, 2, opcode_00dd);
-    bind(0x00de, 2, opcode_00de);
-    bind(0x00df, 1, opcode_00df);
-    bind(0x00e0, 1, opcode_00e0);
-    bind(0x00e1, 2, opcode_00e1);
-    bind(0x00e2, 3, opcode_00e2);
-    bind(0x00e3, 6, opcode_00e3);
-    bind(0x00e4, 6, opcode_00e4);
-    bind(0x00e5, 6, opcode_00e5);
-    bind(0x00e6, 6, opcode_00e6);
-    bind(0x00e7, 6, opcode_00e7);
-    bind(0x00e8, 6, opcode_00e8);
-    bind(0x00e9, 5, opcode_00e9);
-    bind(0x00ea, 5, opcode_00ea);
-    bind(0x00eb, 5, opcode_00eb);
-    bind(0x00ec, 6, opcode_00ec);
-    bind(0x00ed, 6, opcode_00ed);
-    bind(0x00ee, 6, opcode_00ee);
-    bind(0x00ef, 6, opcode_00ef);
-    bind(0x00f0, 6, opcode_00f0);
-    bind(0x00f1, 6, opcode_00f1);
-    bind(0x00f2, 5, opcode_00f2);
-    bind(0x00f3, 5, opcode_00f3);
-    bind(0x00f4, 5, opcode_00f4);
-    bind(0x00f5, 8, opcode_00f5);
-    bind(0x00f6, 8, opcode_00f6);
-    bind(0x00f7, 8, opcode_00f7);
-    bind(0x00f8, 8, opcode_00f8);
-    bind(0x00f9, 8, opcode_00f9);
-    bind(0x00fa, 8, opcode_00fa);
-    bind(0x00fb, 6, opcode_00fb);
-    bind(0x00fc, 6, opcode_00fc);
-    bind(0x00fd, 6, opcode_00fd);
-    bind(0x00fe, 8, opcode_00fe);
-    bind(0x00ff, 8, opcode_00ff);
-    bind(0x0100, 8, opcode_0100);
-    bind(0x0101, 8, opcode_0101);
-    bind(0x0102, 8, opcode_0102);
-    bind(0x0103, 8, opcode_0103);
-    bind(0x0104, 6, opcode_0104);
-    bind(0x0105, 6, opcode_0105);
-    bind(0x0106, 6, opcode_0106);
-    bind(0x0107, 5, opcode_0107);
-    bind(0x0108, 1, opcode_0108);
-    bind(0x0109, 2, opcode_0109);
-    bind(0x010a, 2, opcode_010a);
-    bind(0x010b, 2, opcode_010b);
-    bind(0x010c, 5, opcode_010c);
-    bind(0x010d, 2, opcode_010d);
-    bind(0x010e, 2, opcode_010e);
-    bind(0x010f, 2, opcode_010f);
-    bind(0x0110, 1, opcode_0110);
-    bind(0x0111, 1, opcode_0111);
-    bind(0x0112, 0, opcode_0112);
-    bind(0x0113, 3, opcode_0113);
-    bind(0x0114, 3, opcode_0114);
-    bind(0x0117, 1, opcode_0117);
-    bind(0x0118, 1, opcode_0118);
-    bind(0x0119, 1, opcode_0119);
-    bind(0x011a, 2, opcode_011a);
-    bind(0x011c, 1, opcode_011c);
-    bind(0x0121, 2, opcode_0121);
-    bind(0x0122, 1, opcode_0122);
-    bind(0x0123, 2, opcode_0123);
-    bind(0x0126, 1, opcode_0126);
-    bind(0x0129, 4, opcode_0129);
-    bind(0x012a, 4, opcode_012a);
-    bind(0x0130, 1, opcode_0130);
-    bind(0x0135, 2, opcode_0135);
-    bind(0x0136, 3, opcode_0136);
-    bind(0x0137, 2, opcode_0137);
-    bind(0x0149, 1, opcode_0149);
-    bind(0x014b, 13, opcode_014b);
-    bind(0x014c, 2, opcode_014c);
-    bind(0x014d, 4, opcode_014d);
-    bind(0x014e, 1, opcode_014e);
-    bind(0x014f, 1, opcode_014f);
-    bind(0x0151, 1, opcode_0151);
-    bind(0x0152, 17, opcode_0152);
-    bind(0x0154, 2, opcode_0154);
-    bind(0x0156, 3, opcode_0156);
-    bind(0x0157, 3, opcode_0157);
-    bind(0x0158, 3, opcode_0158);
-    bind(0x0159, 3, opcode_0159);
-    bind(0x015a, 0, opcode_015a);
-    bind(0x015c, 11, opcode_015c);
-    bind(0x015d, 1, opcode_015d);
-    bind(0x015e, 1, opcode_015e);
-    bind(0x015f, 6, opcode_015f);
-    bind(0x0160, 4, opcode_0160);
-    bind(0x0161, 4, opcode_0161);
-    bind(0x0162, 4, opcode_0162);
-    bind(0x0163, 4, opcode_0163);
-    bind(0x0164, 1, opcode_0164);
-    bind(0x0165, 2, opcode_0165);
-    bind(0x0166, 2, opcode_0166);
-    bind(0x0167, 6, opcode_0167);
-    bind(0x0168, 2, opcode_0168);
-    bind(0x0169, 3, opcode_0169);
-    bind(0x016a, 2, opcode_016a);
-    bind(0x016b, 0, opcode_016b);
-    bind(0x016c, 4, opcode_016c);
-    bind(0x016d, 4, opcode_016d);
-    bind(0x016e, 4, opcode_016e);
-    bind(0x016f, 10, opcode_016f);
-    bind(0x0170, 2, opcode_0170);
-    bind(0x0171, 2, opcode_0171);
-    bind(0x0172, 2, opcode_0172);
-    bind(0x0173, 2, opcode_0173);
-    bind(0x0174, 2, opcode_0174);
-    bind(0x0175, 2, opcode_0175);
-    bind(0x0176, 2, opcode_0176);
-    bind(0x0177, 2, opcode_0177);
-    bind(0x0178, 2, opcode_0178);
-    bind(0x0179, 2, opcode_0179);
-    bind(0x017a, 3, opcode_017a);
-    bind(0x017b, 3, opcode_017b);
-    bind(0x0180, 1, opcode_0180);
-    bind(0x0181, 2, opcode_0181);
-    bind(0x0182, 2, opcode_0182);
-    bind(0x0183, 2, opcode_0183);
-    bind(0x0184, 2, opcode_0184);
-    bind(0x0185, 2, opcode_0185);
-    bind(0x0186, 2, opcode_0186);
-    bind(0x0187, 2, opcode_0187);
-    bind(0x0188, 2, opcode_0188);
-    bind(0x0189, 4, opcode_0189);
-    bind(0x018a, 4, opcode_018a);
-    bind(0x018b, 2, opcode_018b);
-    bind(0x018c, 4, opcode_018c);
-    bind(0x018d, 5, opcode_018d);
-    bind(0x018e, 1, opcode_018e);
-    bind(0x018f, 1, opcode_018f);
-    bind(0x0190, 1, opcode_0190);
-    bind(0x0191, 1, opcode_0191);
-    bind(0x0192, 1, opcode_0192);
-    bind(0x0193, 1, opcode_0193);
-    bind(0x0194, 4, opcode_0194);
-    bind(0x0195, 5, opcode_0195);
-    bind(0x0196, 1, opcode_0196);
-    bind(0x0197, 6, opcode_0197);
-    bind(0x0198, 6, opcode_0198);
-    bind(0x0199, 6, opcode_0199);
-    bind(0x019a, 6, opcode_019a);
-    bind(0x019b, 6, opcode_019b);
-    bind(0x019c, 8, opcode_019c);
-    bind(0x019d, 8, opcode_019d);
-    bind(0x019e, 8, opcode_019e);
-    bind(0x019f, 8, opcode_019f);
-    bind(0x01a0, 8, opcode_01a0);
-    bind(0x01a1, 6, opcode_01a1);
-    bind(0x01a2, 6, opcode_01a2);
-    bind(0x01a3, 6, opcode_01a3);
-    bind(0x01a4, 6, opcode_01a4);
-    bind(0x01a5, 6, opcode_01a5);
-    bind(0x01a6, 8, opcode_01a6);
-    bind(0x01a7, 8, opcode_01a7);
-    bind(0x01a8, 8, opcode_01a8);
-    bind(0x01a9, 8, opcode_01a9);
-    bind(0x01aa, 8, opcode_01aa);
-    bind(0x01ab, 6, opcode_01ab);
-    bind(0x01ac, 8, opcode_01ac);
-    bind(0x01ad, 6, opcode_01ad);
-    bind(0x01ae, 6, opcode_01ae);
-    bind(0x01af, 8, opcode_01af);
-    bind(0x01b0, 8, opcode_01b0);
-    bind(0x01b1, 3, opcode_01b1);
-    bind(0x01b2, 3, opcode_01b2);
-    bind(0x01b4, 2, opcode_01b4);
-    bind(0x01b5, 1, opcode_01b5);
-    bind(0x01b6, 1, opcode_01b6);
-    bind(0x01b7, 0, opcode_01b7);
-    bind(0x01b8, 2, opcode_01b8);
-    bind(0x01b9, 2, opcode_01b9);
-    bind(0x01bb, 4, opcode_01bb);
-    bind(0x01bc, 4, opcode_01bc);
-    bind(0x01bd, 1, opcode_01bd);
-    bind(0x01be, 4, opcode_01be);
-    bind(0x01c0, 2, opcode_01c0);
-    bind(0x01c1, 1, opcode_01c1);
-    bind(0x01c2, 1, opcode_01c2);
-    bind(0x01c3, 1, opcode_01c3);
-    bind(0x01c4, 1, opcode_01c4);
-    bind(0x01c5, 1, opcode_01c5);
-    bind(0x01c6, 1, opcode_01c6);
-    bind(0x01c7, 1, opcode_01c7);
-    bind(0x01c8, 5, opcode_01c8);
-    bind(0x01c9, 2, opcode_01c9);
-    bind(0x01ca, 2, opcode_01ca);
-    bind(0x01cb, 2, opcode_01cb);
-    bind(0x01cc, 2, opcode_01cc);
-    bind(0x01ce, 2, opcode_01ce);
-    bind(0x01cf, 2, opcode_01cf);
-    bind(0x01d0, 2, opcode_01d0);
-    bind(0x01d1, 2, opcode_01d1);
-    bind(0x01d2, 2, opcode_01d2);
-    bind(0x01d3, 2, opcode_01d3);
-    bind(0x01d4, 2, opcode_01d4);
-    bind(0x01d5, 2, opcode_01d5);
-    bind(0x01d8, 2, opcode_01d8);
-    bind(0x01d9, 2, opcode_01d9);
-    bind(0x01de, 2, opcode_01de);
-    bind(0x01df, 2, opcode_01df);
-    bind(0x01e0, 1, opcode_01e0);
-    bind(0x01e1, 3, opcode_01e1);
-    bind(0x01e2, 4, opcode_01e2);
-    bind(0x01e3, 4, opcode_01e3);
-    bind(0x01e4, 4, opcode_01e4);
-    bind(0x01e5, 4, opcode_01e5);
-    bind(0x01e7, 6, opcode_01e7);
-    bind(0x01e8, 6, opcode_01e8);
-    bind(0x01e9, 2, opcode_01e9);
-    bind(0x01ea, 2, opcode_01ea);
-    bind(0x01eb, 1, opcode_01eb);
-    bind(0x01ec, 2, opcode_01ec);
-    bind(0x01ed, 1, opcode_01ed);
-    bind(0x01ee, 10, opcode_01ee);
-    bind(0x01ef, 2, opcode_01ef);
-    bind(0x01f0, 1, opcode_01f0);
-    bind(0x01f3, 1, opcode_01f3);
-    bind(0x01f4, 1, opcode_01f4);
-    bind(0x01f5, 2, opcode_01f5);
-    bind(0x01f6, 0, opcode_01f6);
-    bind(0x01f7, 2, opcode_01f7);
-    bind(0x01f9, 9, opcode_01f9);
-    bind(0x01fa, 1, opcode_01fa);
-    bind(0x01fb, 2, opcode_01fb);
-    bind(0x01fc, 5, opcode_01fc);
-    bind(0x01fd, 5, opcode_01fd);
-    bind(0x01fe, 5, opcode_01fe);
-    bind(0x01ff, 6, opcode_01ff);
-    bind(0x0200, 6, opcode_0200);
-    bind(0x0201, 6, opcode_0201);
-    bind(0x0202, 5, opcode_0202);
-    bind(0x0203, 5, opcode_0203);
-    bind(0x0204, 5, opcode_0204);
-    bind(0x0205, 6, opcode_0205);
-    bind(0x0206, 6, opcode_0206);
-    bind(0x0207, 6, opcode_0207);
-    bind(0x0208, 3, opcode_0208);
-    bind(0x0209, 3, opcode_0209);
-    bind(0x020a, 2, opcode_020a);
-    bind(0x020b, 1, opcode_020b);
-    bind(0x020c, 4, opcode_020c);
-    bind(0x020d, 1, opcode_020d);
-    bind(0x020e, 2, opcode_020e);
-    bind(0x020f, 2, opcode_020f);
-    bind(0x0210, 2, opcode_0210);
-    bind(0x0211, 3, opcode_0211);
-    bind(0x0213, 6, opcode_0213);
-    bind(0x0214, 1, opcode_0214);
-    bind(0x0215, 1, opcode_0215);
-    bind(0x0216, 2, opcode_0216);
-    bind(0x0217, 3, opcode_0217);
-    bind(0x0218, 4, opcode_0218);
-    bind(0x0219, 8, opcode_0219);
-    bind(0x021b, 2, opcode_021b);
-    bind(0x021c, 1, opcode_021c);
-    bind(0x021d, 1, opcode_021d);
-    bind(0x0220, 1, opcode_0220);
-    bind(0x0221, 2, opcode_0221);
-    bind(0x0222, 2, opcode_0222);
-    bind(0x0223, 2, opcode_0223);
-    bind(0x0224, 2, opcode_0224);
-    bind(0x0225, 2, opcode_0225);
-    bind(0x0226, 2, opcode_0226);
-    bind(0x0227, 2, opcode_0227);
-    bind(0x0228, 2, opcode_0228);
-    bind(0x0229, 3, opcode_0229);
-    bind(0x022a, 6, opcode_022a);
-    bind(0x022b, 6, opcode_022b);
-    bind(0x022c, 2, opcode_022c);
-    bind(0x022d, 2, opcode_022d);
-    bind(0x022e, 2, opcode_022e);
-    bind(0x022f, 1, opcode_022f);
-    bind(0x0230, 1, opcode_0230);
-    bind(0x0231, 1, opcode_0231);
-    bind(0x0235, 3, opcode_0235);
-    bind(0x0236, 2, opcode_0236);
-    bind(0x0237, 3, opcode_0237);
-    bind(0x0239, 3, opcode_0239);
-    bind(0x023a, 2, opcode_023a);
-    bind(0x023b, 2, opcode_023b);
-    bind(0x023c, 2, opcode_023c);
-    bind(0x023d, 1, opcode_023d);
-    bind(0x0240, 2, opcode_0240);
-    bind(0x0241, 1, opcode_0241);
-    bind(0x0242, 2, opcode_0242);
-    bind(0x0243, 2, opcode_0243);
-    bind(0x0244, 3, opcode_0244);
-    bind(0x0245, 2, opcode_0245);
-    bind(0x0247, 1, opcode_0247);
-    bind(0x0248, 1, opcode_0248);
-    bind(0x0249, 1, opcode_0249);
-    bind(0x024a, 3, opcode_024a);
-    bind(0x024b, 2, opcode_024b);
-    bind(0x024c, 2, opcode_024c);
-    bind(0x024d, 1, opcode_024d);
-    bind(0x024e, 1, opcode_024e);
-    bind(0x024f, 9, opcode_024f);
-    bind(0x0250, 6, opcode_0250);
-    bind(0x0253, 0, opcode_0253);
-    bind(0x0254, 0, opcode_0254);
-    bind(0x0255, 4, opcode_0255);
-    bind(0x0256, 1, opcode_0256);
-    bind(0x0291, 2, opcode_0291);
-    bind(0x0293, 1, opcode_0293);
-    bind(0x0294, 2, opcode_0294);
-    bind(0x0296, 1, opcode_0296);
-    bind(0x0297, 0, opcode_0297);
-    bind(0x0298, 2, opcode_0298);
-    bind(0x0299, 1, opcode_0299);
-    bind(0x029b, 5, opcode_029b);
-    bind(0x029c, 1, opcode_029c);
-    bind(0x029f, 1, opcode_029f);
-    bind(0x02a0, 1, opcode_02a0);
-    bind(0x02a1, 2, opcode_02a1);
-    bind(0x02a2, 5, opcode_02a2);
-    bind(0x02a3, 1, opcode_02a3);
-    bind(0x02a7, 5, opcode_02a7);
-    bind(0x02a8, 5, opcode_02a8);
-    bind(0x02a9, 2, opcode_02a9);
-    bind(0x02aa, 2, opcode_02aa);
-    bind(0x02ab, 6, opcode_02ab);
-    bind(0x02ac, 6, opcode_02ac);
-    bind(0x02ad, 7, opcode_02ad);
-    bind(0x02ae, 7, opcode_02ae);
-    bind(0x02af, 7, opcode_02af);
-    bind(0x02b0, 7, opcode_02b0);
-    bind(0x02b1, 7, opcode_02b1);
-    bind(0x02b2, 7, opcode_02b2);
-    bind(0x02b3, 9, opcode_02b3);
-    bind(0x02b4, 9, opcode_02b4);
-    bind(0x02b5, 9, opcode_02b5);
-    bind(0x02b6, 9, opcode_02b6);
-    bind(0x02b7, 9, opcode_02b7);
-    bind(0x02b8, 9, opcode_02b8);
-    bind(0x02b9, 1, opcode_02b9);
-    bind(0x02bc, 1, opcode_02bc);
-    bind(0x02bf, 1, opcode_02bf);
-    bind(0x02c0, 6, opcode_02c0);
-    bind(0x02c1, 6, opcode_02c1);
-    bind(0x02c2, 4, opcode_02c2);
-    bind(0x02c3, 1, opcode_02c3);
-    bind(0x02c5, 1, opcode_02c5);
-    bind(0x02c6, 0, opcode_02c6);
-    bind(0x02c7, 5, opcode_02c7);
-    bind(0x02c8, 1, opcode_02c8);
-    bind(0x02c9, 0, opcode_02c9);
-    bind(0x02ca, 1, opcode_02ca);
-    bind(0x02cb, 1, opcode_02cb);
-    bind(0x02cc, 1, opcode_02cc);
-    bind(0x02cd, 2, opcode_02cd);
-    bind(0x02ce, 4, opcode_02ce);
-    bind(0x02cf, 4, opcode_02cf);
-    bind(0x02d0, 1, opcode_02d0);
-    bind(0x02d1, 1, opcode_02d1);
-    bind(0x02d3, 4, opcode_02d3);
-    bind(0x02d4, 1, opcode_02d4);
-    bind(0x02d5, 6, opcode_02d5);
-    bind(0x02d7, 2, opcode_02d7);
-    bind(0x02d8, 2, opcode_02d8);
-    bind(0x02d9, 0, opcode_02d9);
-    bind(0x02db, 2, opcode_02db);
-    bind(0x02dd, 2, opcode_02dd);
-    bind(0x02de, 1, opcode_02de);
-    bind(0x02df, 1, opcode_02df);
-    bind(0x02e0, 1, opcode_02e0);
-    bind(0x02e1, 5, opcode_02e1);
-    bind(0x02e2, 2, opcode_02e2);
-    bind(0x02e3, 2, opcode_02e3);
-    bind(0x02e4, 1, opcode_02e4);
-    bind(0x02e5, 2, opcode_02e5);
-    bind(0x02e6, 2, opcode_02e6);
-    bind(0x02e7, 0, opcode_02e7);
-    bind(0x02e8, 1, opcode_02e8);
-    bind(0x02e9, 0, opcode_02e9);
-    bind(0x02ea, 0, opcode_02ea);
-    bind(0x02eb, 0, opcode_02eb);
-    bind(0x02ec, 3, opcode_02ec);
-    bind(0x02ed, 1, opcode_02ed);
-    bind(0x02ee, 6, opcode_02ee);
-    bind(0x02ef, 6, opcode_02ef);
-    bind(0x02f1, 3, opcode_02f1);
-    bind(0x02f2, 2, opcode_02f2);
-    bind(0x02f3, 2, opcode_02f3);
-    bind(0x02f4, 3, opcode_02f4);
-    bind(0x02f5, 2, opcode_02f5);
-    bind(0x02f6, 2, opcode_02f6);
-    bind(0x02f7, 2, opcode_02f7);
-    bind(0x02f8, 2, opcode_02f8);
-    bind(0x02f9, 2, opcode_02f9);
-    bind(0x02fa, 2, opcode_02fa);
-    bind(0x02fb, 10, opcode_02fb);
-    bind(0x02fc, 5, opcode_02fc);
-    bind(0x02fd, 5, opcode_02fd);
-    bind(0x02fe, 5, opcode_02fe);
-    bind(0x02ff, 6, opcode_02ff);
-    bind(0x0300, 6, opcode_0300);
-    bind(0x0301, 6, opcode_0301);
-    bind(0x0302, 7, opcode_0302);
-    bind(0x0303, 7, opcode_0303);
-    bind(0x0304, 7, opcode_0304);
-    bind(0x0305, 8, opcode_0305);
-    bind(0x0306, 8, opcode_0306);
-    bind(0x0307, 8, opcode_0307);
-    bind(0x0308, 9, opcode_0308);
-    bind(0x0309, 9, opcode_0309);
-    bind(0x030a, 9, opcode_030a);
-    bind(0x030c, 1, opcode_030c);
-    bind(0x030d, 1, opcode_030d);
-    bind(0x030e, 1, opcode_030e);
-    bind(0x030f, 1, opcode_030f);
-    bind(0x0310, 1, opcode_0310);
-    bind(0x0311, 1, opcode_0311);
-    bind(0x0312, 1, opcode_0312);
-    bind(0x0313, 0, opcode_0313);
-    bind(0x0314, 1, opcode_0314);
-    bind(0x0315, 0, opcode_0315);
-    bind(0x0316, 1, opcode_0316);
-    bind(0x0317, 0, opcode_0317);
-    bind(0x0318, 1, opcode_0318);
-    bind(0x0319, 2, opcode_0319);
-    bind(0x031a, 0, opcode_031a);
-    bind(0x031d, 2, opcode_031d);
-    bind(0x031e, 2, opcode_031e);
-    bind(0x031f, 2, opcode_031f);
-    bind(0x0320, 2, opcode_0320);
-    bind(0x0321, 1, opcode_0321);
-    bind(0x0322, 1, opcode_0322);
-    bind(0x0323, 2, opcode_0323);
-    bind(0x0324, 3, opcode_0324);
-    bind(0x0325, 2, opcode_0325);
-    bind(0x0326, 2, opcode_0326);
-    bind(0x0327, 6, opcode_0327);
-    bind(0x0329, 1, opcode_0329);
-    bind(0x032a, 1, opcode_032a);
-    bind(0x032b, 7, opcode_032b);
-    bind(0x032c, 2, opcode_032c);
-    bind(0x032d, 2, opcode_032d);
-    bind(0x0330, 2, opcode_0330);
-    bind(0x0331, 2, opcode_0331);
-    bind(0x0332, 2, opcode_0332);
-    bind(0x0335, 1, opcode_0335);
-    bind(0x0336, 2, opcode_0336);
-    bind(0x0337, 2, opcode_0337);
-    bind(0x0339, 11, opcode_0339);
-    bind(0x033a, 0, opcode_033a);
-    bind(0x033b, 0, opcode_033b);
-    bind(0x033c, 0, opcode_033c);
-    bind(0x033e, 3, opcode_033e);
-    bind(0x033f, 2, opcode_033f);
-    bind(0x0340, 4, opcode_0340);
-    bind(0x0341, 1, opcode_0341);
-    bind(0x0342, 1, opcode_0342);
-    bind(0x0343, 1, opcode_0343);
-    bind(0x0344, 1, opcode_0344);
-    bind(0x0345, 1, opcode_0345);
-    bind(0x0346, 4, opcode_0346);
-    bind(0x0348, 1, opcode_0348);
-    bind(0x0349, 1, opcode_0349);
-    bind(0x034a, 0, opcode_034a);
-    bind(0x034b, 0, opcode_034b);
-    bind(0x034c, 0, opcode_034c);
-    bind(0x034d, 4, opcode_034d);
-    bind(0x034e, 8, opcode_034e);
-    bind(0x034f, 1, opcode_034f);
-    bind(0x0350, 2, opcode_0350);
-    bind(0x0351, 0, opcode_0351);
-    bind(0x0352, 2, opcode_0352);
-    bind(0x0353, 1, opcode_0353);
-    bind(0x0354, 1, opcode_0354);
-    bind(0x0355, 0, opcode_0355);
-    bind(0x0356, 7, opcode_0356);
-    bind(0x0357, 2, opcode_0357);
-    bind(0x0358, 0, opcode_0358);
-    bind(0x0359, 0, opcode_0359);
-    bind(0x035a, 3, opcode_035a);
-    bind(0x035b, 4, opcode_035b);
-    bind(0x035c, 5, opcode_035c);
-    bind(0x035d, 1, opcode_035d);
-    bind(0x035e, 2, opcode_035e);
-    bind(0x035f, 2, opcode_035f);
-    bind(0x0360, 1, opcode_0360);
-    bind(0x0361, 1, opcode_0361);
-    bind(0x0362, 4, opcode_0362);
-    bind(0x0363, 6, opcode_0363);
-    bind(0x0365, 1, opcode_0365);
-    bind(0x0366, 1, opcode_0366);
-    bind(0x0367, 9, opcode_0367);
-    bind(0x0368, 10, opcode_0368);
-    bind(0x0369, 2, opcode_0369);
-    bind(0x036a, 2, opcode_036a);
-    bind(0x036d, 5, opcode_036d);
-    bind(0x036e, 6, opcode_036e);
-    bind(0x036f, 7, opcode_036f);
-    bind(0x0370, 8, opcode_0370);
-    bind(0x0371, 9, opcode_0371);
-    bind(0x0372, 3, opcode_0372);
-    bind(0x0373, 0, opcode_0373);
-    bind(0x0374, 1, opcode_0374);
-    bind(0x0375, 4, opcode_0375);
-    bind(0x0376, 4, opcode_0376);
-    bind(0x0377, 1, opcode_0377);
-    bind(0x0378, 3, opcode_0378);
-    bind(0x0379, 3, opcode_0379);
-    bind(0x037a, 4, opcode_037a);
-    bind(0x037b, 4, opcode_037b);
-    bind(0x037c, 5, opcode_037c);
-    bind(0x037d, 5, opcode_037d);
-    bind(0x037e, 6, opcode_037e);
-    bind(0x037f, 0, opcode_037f);
-    bind(0x0381, 4, opcode_0381);
-    bind(0x0382, 2, opcode_0382);
-    bind(0x0383, 1, opcode_0383);
-    bind(0x0384, 4, opcode_0384);
-    bind(0x0385, 4, opcode_0385);
-    bind(0x0386, 6, opcode_0386);
-    bind(0x0387, 6, opcode_0387);
-    bind(0x0388, 7, opcode_0388);
-    bind(0x0389, 7, opcode_0389);
-    bind(0x038a, 6, opcode_038a);
-    bind(0x038b, 0, opcode_038b);
-    bind(0x038c, 4, opcode_038c);
-    bind(0x038d, 9, opcode_038d);
-    bind(0x038f, 2, opcode_038f);
-    bind(0x0390, 1, opcode_0390);
-    bind(0x0391, 0, opcode_0391);
-    bind(0x0392, 2, opcode_0392);
-    bind(0x0394, 1, opcode_0394);
-    bind(0x0395, 5, opcode_0395);
-    bind(0x0396, 1, opcode_0396);
-    bind(0x0397, 2, opcode_0397);
-    bind(0x0398, 7, opcode_0398);
-    bind(0x0399, 7, opcode_0399);
-    bind(0x039a, 7, opcode_039a);
-    bind(0x039b, 7, opcode_039b);
-    bind(0x039c, 2, opcode_039c);
-    bind(0x039d, 12, opcode_039d);
-    bind(0x039e, 2, opcode_039e);
-    bind(0x039f, 3, opcode_039f);
-    bind(0x03a0, 3, opcode_03a0);
-    bind(0x03a1, 4, opcode_03a1);
-    bind(0x03a2, 2, opcode_03a2);
-    bind(0x03a3, 1, opcode_03a3);
-    bind(0x03a4, 1, opcode_03a4);
-    bind(0x03a5, 3, opcode_03a5);
-    bind(0x03a6, 3, opcode_03a6);
-    bind(0x03aa, 3, opcode_03aa);
-    bind(0x03ab, 2, opcode_03ab);
-    bind(0x03ac, 1, opcode_03ac);
-    bind(0x03ad, 1, opcode_03ad);
-    bind(0x03ae, 6, opcode_03ae);
-    bind(0x03af, 1, opcode_03af);
-    bind(0x03b0, 1, opcode_03b0);
-    bind(0x03b1, 1, opcode_03b1);
-    bind(0x03b2, 0, opcode_03b2);
-    bind(0x03b3, 0, opcode_03b3);
-    bind(0x03b4, 0, opcode_03b4);
-    bind(0x03b5, 0, opcode_03b5);
-    bind(0x03b6, 6, opcode_03b6);
-    bind(0x03b7, 1, opcode_03b7);
-    bind(0x03b8, 1, opcode_03b8);
-    bind(0x03b9, 1, opcode_03b9);
-    bind(0x03ba, 6, opcode_03ba);
-    bind(0x03bb, 1, opcode_03bb);
-    bind(0x03bc, 5, opcode_03bc);
-    bind(0x03bd, 1, opcode_03bd);
-    bind(0x03be, 0, opcode_03be);
-    bind(0x03bf, 2, opcode_03bf);
-    bind(0x03c0, 2, opcode_03c0);
-    bind(0x03c1, 2, opcode_03c1);
-    bind(0x03c2, 1, opcode_03c2);
-    bind(0x03c3, 3, opcode_03c3);
-    bind(0x03c4, 3, opcode_03c4);
-    bind(0x03c5, 4, opcode_03c5);
-    bind(0x03c6, 1, opcode_03c6);
-    bind(0x03c7, 1, opcode_03c7);
-    bind(0x03c8, 0, opcode_03c8);
-    bind(0x03c9, 1, opcode_03c9);
-    bind(0x03ca, 1, opcode_03ca);
-    bind(0x03cb, 3, opcode_03cb);
-    bind(0x03cc, 3, opcode_03cc);
-    bind(0x03cd, 1, opcode_03cd);
-    bind(0x03ce, 1, opcode_03ce);
-    bind(0x03cf, 1, opcode_03cf);
-    bind(0x03d0, 0, opcode_03d0);
-    bind(0x03d1, 0, opcode_03d1);
-    bind(0x03d2, 0, opcode_03d2);
-    bind(0x03d3, 7, opcode_03d3);
-    bind(0x03d4, 2, opcode_03d4);
-    bind(0x03d5, 1, opcode_03d5);
-    bind(0x03d6, 1, opcode_03d6);
-    bind(0x03d7, 3, opcode_03d7);
-    bind(0x03d8, 0, opcode_03d8);
-    bind(0x03d9, 0, opcode_03d9);
-    bind(0x03da, 1, opcode_03da);
-    bind(0x03dc, 2, opcode_03dc);
-    bind(0x03dd, 3, opcode_03dd);
-    bind(0x03de, 1, opcode_03de);
-    bind(0x03df, 1, opcode_03df);
-    bind(0x03e0, 1, opcode_03e0);
-    bind(0x03e1, 1, opcode_03e1);
-    bind(0x03e2, 1, opcode_03e2);
-    bind(0x03e3, 1, opcode_03e3);
-    bind(0x03e4, 1, opcode_03e4);
-    bind(0x03e5, 1, opcode_03e5);
-    bind(0x03e6, 0, opcode_03e6);
-    bind(0x03e7, 1, opcode_03e7);
-    bind(0x03ea, 1, opcode_03ea);
-    bind(0x03eb, 0, opcode_03eb);
-    bind(0x03ec, 0, opcode_03ec);
-    bind(0x03ed, 2, opcode_03ed);
-    bind(0x03ee, 1, opcode_03ee);
-    bind(0x03ef, 1, opcode_03ef);
-    bind(0x03f0, 1, opcode_03f0);
-    bind(0x03f1, 2, opcode_03f1);
-    bind(0x03f2, 2, opcode_03f2);
-    bind(0x03f3, 3, opcode_03f3);
-    bind(0x03f4, 1, opcode_03f4);
-    bind(0x03f5, 2, opcode_03f5);
-    bind(0x03f7, 1, opcode_03f7);
-    bind(0x03f8, 1, opcode_03f8);
-    bind(0x03f9, 3, opcode_03f9);
-    bind(0x03fb, 2, opcode_03fb);
-    bind(0x03fc, 2, opcode_03fc);
-    bind(0x03fd, 1, opcode_03fd);
-    bind(0x03fe, 1, opcode_03fe);
-    bind(0x03ff, 1, opcode_03ff);
-    bind(0x0400, 1, opcode_0400);
-    bind(0x0401, 0, opcode_0401);
-    bind(0x0402, 0, opcode_0402);
-    bind(0x0403, 1, opcode_0403);
-    bind(0x0404, 0, opcode_0404);
-    bind(0x0405, 1, opcode_0405);
-    bind(0x0406, 1, opcode_0406);
-    bind(0x0407, 1, opcode_0407);
-    bind(0x0408, 1, opcode_0408);
-    bind(0x0409, 0, opcode_0409);
-    bind(0x040a, 1, opcode_040a);
-    bind(0x040b, 0, opcode_040b);
-    bind(0x040c, 0, opcode_040c);
-    bind(0x040d, 0, opcode_040d);
-    bind(0x040e, 1, opcode_040e);
-    bind(0x040f, 1, opcode_040f);
-    bind(0x0410, 2, opcode_0410);
-    bind(0x0411, 2, opcode_0411);
-    bind(0x0412, 2, opcode_0412);
-    bind(0x0413, 2, opcode_0413);
-    bind(0x0414, 2, opcode_0414);
-    bind(0x0415, 2, opcode_0415);
-    bind(0x0417, 1, opcode_0417);
-    bind(0x0418, 2, opcode_0418);
-    bind(0x0419, 3, opcode_0419);
-    bind(0x041a, 3, opcode_041a);
-    bind(0x041c, 2, opcode_041c);
-    bind(0x041d, 1, opcode_041d);
-    bind(0x041e, 2, opcode_041e);
-    bind(0x041f, 1, opcode_041f);
-    bind(0x0420, 1, opcode_0420);
-    bind(0x0421, 1, opcode_0421);
-    bind(0x0422, 2, opcode_0422);
-    bind(0x0423, 2, opcode_0423);
-    bind(0x0424, 0, opcode_0424);
-    bind(0x0425, 2, opcode_0425);
-    bind(0x0426, 6, opcode_0426);
-    bind(0x0427, 6, opcode_0427);
-    bind(0x0428, 2, opcode_0428);
-    bind(0x042a, 2, opcode_042a);
-    bind(0x042b, 6, opcode_042b);
-    bind(0x042c, 1, opcode_042c);
-    bind(0x042d, 2, opcode_042d);
-    bind(0x042e, 2, opcode_042e);
-    bind(0x042f, 2, opcode_042f);
-    bind(0x0431, 2, opcode_0431);
-    bind(0x0432, 3, opcode_0432);
-    bind(0x0433, 2, opcode_0433);
-    bind(0x0434, 0, opcode_0434);
-    bind(0x0435, 0, opcode_0435);
-    bind(0x0436, 0, opcode_0436);
-    bind(0x0437, 8, opcode_0437);
-    bind(0x0438, 2, opcode_0438);
-    bind(0x043a, 0, opcode_043a);
-    bind(0x043b, 1, opcode_043b);
-    bind(0x043c, 1, opcode_043c);
-    bind(0x043d, 1, opcode_043d);
-    bind(0x043f, 0, opcode_043f);
-    bind(0x0440, 0, opcode_0440);
-    bind(0x0441, 2, opcode_0441);
-    bind(0x0442, 2, opcode_0442);
-    bind(0x0443, 1, opcode_0443);
-    bind(0x0444, 2, opcode_0444);
-    bind(0x0445, 0, opcode_0445);
-    bind(0x0446, 2, opcode_0446);
-    bind(0x0447, 1, opcode_0447);
-    bind(0x0448, 2, opcode_0448);
-    bind(0x0449, 1, opcode_0449);
-    bind(0x044a, 1, opcode_044a);
-    bind(0x044b, 1, opcode_044b);
-    bind(0x044c, 1, opcode_044c);
-    bind(0x044d, 1, opcode_044d);
-    bind(0x044e, 2, opcode_044e);
-    bind(0x044f, 2, opcode_044f);
-    bind(0x0450, 1, opcode_0450);
-    bind(0x0451, 0, opcode_0451);
-    bind(0x0452, 0, opcode_0452);
-    bind(0x0453, 4, opcode_0453);
-    bind(0x0454, 3, opcode_0454);
-    bind(0x0455, 3, opcode_0455);
-    bind(0x0456, 1, opcode_0456);
-    bind(0x0457, 2, opcode_0457);
-    bind(0x0458, 2, opcode_0458);
-    bind(0x0459, 1, opcode_0459);
-    bind(0x045b, 5, opcode_045b);
-    bind(0x0463, 3, opcode_0463);
-    bind(0x0477, 3, opcode_0477);
-    bind(0x0494, 5, opcode_0494);
+    bind<opcode_0000>(0x0000, 0, "NOP");
+    bind<opcode_0001>(0x0001, 1, "wait %1d% ms");
+    bind<opcode_0002>(0x0002, 1, "goto %1p%");
+    bind<opcode_0003>(0x0003, 1, "shake_cam %1d%");
+    bind<opcode_0004>(0x0004, 2, "%1d% = %2d%");
+    bind<opcode_0005>(0x0005, 2, "%1d% = %2d%");
+    bind<opcode_0006>(0x0006, 2, "%1d% = %2d%");
+    bind<opcode_0007>(0x0007, 2, "%1d% = %2d%");
+    bind<opcode_0008>(0x0008, 2, "%1d% += %2d%");
+    bind<opcode_0009>(0x0009, 2, "%1d% += %2d%");
+    bind<opcode_000a>(0x000a, 2, "%1d% += %2h%");
+    bind<opcode_000b>(0x000b, 2, "%1d% += %2d%");
+    bind<opcode_000c>(0x000c, 2, "%1d% -= %2d%");
+    bind<opcode_000d>(0x000d, 2, "%1d% -= %2d%");
+    bind<opcode_000e>(0x000e, 2, "%1d% -= %2h%");
+    bind<opcode_000f>(0x000f, 2, "%1d% -= %2d%");
+    bind<opcode_0010>(0x0010, 2, "%1d% *= %2d%");
+    bind<opcode_0011>(0x0011, 2, "%1d% *= %2d%");
+    bind<opcode_0012>(0x0012, 2, "%1d% *= %2d%");
+    bind<opcode_0013>(0x0013, 2, "%1d% *= %2d%");
+    bind<opcode_0014>(0x0014, 2, "%1d% /= %2d%");
+    bind<opcode_0015>(0x0015, 2, "%1d% /= %2d%");
+    bind<opcode_0016>(0x0016, 2, "%1d% /= %2d%");
+    bind<opcode_0017>(0x0017, 2, "%1d% /= %2d%");
+    bind<opcode_0018>(0x0018, 2, "%1d% > %2d%");
+    bind<opcode_0019>(0x0019, 2, "%1d% > %2d%");
+    bind<opcode_001a>(0x001a, 2, "%1d% > %2d%");
+    bind<opcode_001b>(0x001b, 2, "%1d% > %2d%");
+    bind<opcode_001c>(0x001c, 2, "%1d% > %2d%");
+    bind<opcode_001d>(0x001d, 2, "%1d% > %2d%");
+    bind<opcode_001e>(0x001e, 2, "%1d% > %2d%");
+    bind<opcode_001f>(0x001f, 2, "%1d% > %2d%");
+    bind<opcode_0020>(0x0020, 2, "%1d% > %2d%");
+    bind<opcode_0021>(0x0021, 2, "%1d% > %2d%");
+    bind<opcode_0022>(0x0022, 2, "%1d% > %2d%");
+    bind<opcode_0023>(0x0023, 2, "%1d% > %2d%");
+    bind<opcode_0024>(0x0024, 2, "%1d% > %2d%");
+    bind<opcode_0025>(0x0025, 2, "%1d% > %2d%");
+    bind<opcode_0026>(0x0026, 2, "%1d% > %2d%");
+    bind<opcode_0027>(0x0027, 2, "%1d% > %2d%");
+    bind<opcode_0028>(0x0028, 2, "%1d% >= %2d%");
+    bind<opcode_0029>(0x0029, 2, "%1d% >= %2d%");
+    bind<opcode_002a>(0x002a, 2, "%1d% >= %2d%");
+    bind<opcode_002b>(0x002b, 2, "%1d% >= %2d%");
+    bind<opcode_002c>(0x002c, 2, "%1d% >= %2d%");
+    bind<opcode_002d>(0x002d, 2, "%1d% >= %2d%");
+    bind<opcode_002e>(0x002e, 2, "%1d% >= %2d%");
+    bind<opcode_002f>(0x002f, 2, "%1d% >= %2d%");
+    bind<opcode_0030>(0x0030, 2, "%1d% >= %2d%");
+    bind<opcode_0031>(0x0031, 2, "%1d% >= %2d%");
+    bind<opcode_0032>(0x0032, 2, "%1d% >= %2d%");
+    bind<opcode_0033>(0x0033, 2, "%1d% >= %2d%");
+    bind<opcode_0034>(0x0034, 2, "%1d% >= %2d%");
+    bind<opcode_0035>(0x0035, 2, "%1d% >= %2d%");
+    bind<opcode_0036>(0x0036, 2, "%1d% >= %2d%");
+    bind<opcode_0037>(0x0037, 2, "%1d% >= %2d%");
+    bind<opcode_0038>(0x0038, 2, "%1d% == %2d%");
+    bind<opcode_0039>(0x0039, 2, "%1d% == %2d%");
+    bind<opcode_003a>(0x003a, 2, "%1d% == %2d%");
+    bind<opcode_003b>(0x003b, 2, "%1d% == %2d%");
+    bind<opcode_003c>(0x003c, 2, "%1d% == %2d%");
+    bind<opcode_0042>(0x0042, 2, "%1d% == %2d%");
+    bind<opcode_0043>(0x0043, 2, "%1d% == %2d%");
+    bind<opcode_0044>(0x0044, 2, "%1d% == %2d%");
+    bind<opcode_0045>(0x0045, 2, "%1d% == %2d%");
+    bind<opcode_0046>(0x0046, 2, "%1d% == %2d%");
+    bind<opcode_004c>(0x004c, 1, "goto_if_true %1p%");
+    bind<opcode_004d>(0x004d, 1, "goto_if_false %1p%");
+    bind<opcode_004e>(0x004e, 0, "end_thread");
+    bind<opcode_004f>(0x004f, -1, "create_thread %1p%");
+    bind<opcode_0050>(0x0050, 1, "gosub %1p%");
+    bind<opcode_0051>(0x0051, 0, "return");
+    bind<opcode_0053>(0x0053, 5, "%5d% = create_player %1o% at %2d% %3d% %4d%");
+    bind<opcode_0054>(0x0054, 4,
+                      "get_player_coordinates %1d% store_to %2d% %3d% %4d%");
+    bind<opcode_0055>(0x0055, 4,
+                      "set_player_coordinates %1d% to %2d% %3d% %4d%");
+    bind<opcode_0056>(0x0056, 6,
+                      "is_player_in_area_2d %1d% coords %2d% %3d% to %4d% %5d% sphere %6b%");
+    bind<opcode_0057>(0x0057, 8,
+                      "is_player_in_area_3d %1d% coords %2d% %3d% %4d% to %5d% %6d% %7d% sphere %8b%");
+    bind<opcode_0058>(0x0058, 2, "%1d% += %2d%");
+    bind<opcode_0059>(0x0059, 2, "%1d% += %2d%");
+    bind<opcode_005a>(0x005a, 2, "%1d% += %2d%");
+    bind<opcode_005b>(0x005b, 2, "%1d% += %2d%");
+    bind<opcode_005c>(0x005c, 2, "%1d% += %2d%");
+    bind<opcode_005d>(0x005d, 2, "%1d% += %2d%");
+    bind<opcode_005e>(0x005e, 2, "%1d% += %2d%");
+    bind<opcode_005f>(0x005f, 2, "%1d% += %2d%");
+    bind<opcode_0060>(0x0060, 2, "%1d% -= %2d%");
+    bind<opcode_0061>(0x0061, 2, "%1d% -= %2d%");
+    bind<opcode_0062>(0x0062, 2, "%1d% -= %2d%");
+    bind<opcode_0063>(0x0063, 2, "%1d% -= %2d%");
+    bind<opcode_0064>(0x0064, 2, "%1d% -= %2d%");
+    bind<opcode_0065>(0x0065, 2, "%1d% -= %2d%");
+    bind<opcode_0066>(0x0066, 2, "%1d% -= %2d%");
+    bind<opcode_0067>(0x0067, 2, "%1d% -= %2d%");
+    bind<opcode_0068>(0x0068, 2, "%1d% *= %2d%");
+    bind<opcode_0069>(0x0069, 2, "%1d% *= %2d%");
+    bind<opcode_006a>(0x006a, 2, "%1d% *= %2d%");
+    bind<opcode_006b>(0x006b, 2, "%1d% *= %2d%");
+    bind<opcode_006c>(0x006c, 2, "%1d% *= %2d%");
+    bind<opcode_006d>(0x006d, 2, "%1d% *= %2d%");
+    bind<opcode_006e>(0x006e, 2, "%1d% *= %2d%");
+    bind<opcode_006f>(0x006f, 2, "%1d% *= %2d%");
+    bind<opcode_0070>(0x0070, 2, "%1d% /= %2d%");
+    bind<opcode_0071>(0x0071, 2, "%1d% /= %2d%");
+    bind<opcode_0072>(0x0072, 2, "%1d% /= %2d%");
+    bind<opcode_0073>(0x0073, 2, "%1d% /= %2d%");
+    bind<opcode_0074>(0x0074, 2, "%1d% /= %2d%");
+    bind<opcode_0075>(0x0075, 2, "%1d% /= %2d%");
+    bind<opcode_0076>(0x0076, 2, "%1d% /= %2d%");
+    bind<opcode_0077>(0x0077, 2, "%1d% /= %2d%");
+    bind<opcode_0078>(0x0078, 2, "%1d% += frame_delta_time * %2d%");
+    bind<opcode_0079>(0x0079, 2, "%1d% += frame_delta_time * %2d%");
+    bind<opcode_007a>(0x007a, 2, "%1d% += frame_delta_time * %2d%");
+    bind<opcode_007b>(0x007b, 2, "%1d% += frame_delta_time * %2d%");
+    bind<opcode_007c>(0x007c, 2, "%1d% += frame_delta_time * %2d%");
+    bind<opcode_007d>(0x007d, 2, "%1d% += frame_delta_time * %2d%");
+    bind<opcode_007e>(0x007e, 2, "%1d% -= frame_delta_time * %2d%");
+    bind<opcode_007f>(0x007f, 2, "%1d% -= frame_delta_time * %2d%");
+    bind<opcode_0080>(0x0080, 2, "%1d% -= frame_delta_time * %2d%");
+    bind<opcode_0081>(0x0081, 2, "%1d% -= frame_delta_time * %2d%");
+    bind<opcode_0082>(0x0082, 2, "%1d% -= frame_delta_time * %2d%");
+    bind<opcode_0083>(0x0083, 2, "%1d% -= frame_delta_time * %2d%");
+    bind<opcode_0084>(0x0084, 2, "%1d% = %2d%");
+    bind<opcode_0085>(0x0085, 2, "%1d% = %2d%");
+    bind<opcode_0086>(0x0086, 2, "%1d% = %2d%");
+    bind<opcode_0087>(0x0087, 2, "%1d% = %2d%");
+    bind<opcode_0088>(0x0088, 2, "%1d% = %2d%");
+    bind<opcode_0089>(0x0089, 2, "%1d% = %2d%");
+    bind<opcode_008a>(0x008a, 2, "%1d% = %2d%");
+    bind<opcode_008b>(0x008b, 2, "%1d% = %2d%");
+    bind<opcode_008c>(0x008c, 2, "%1d% = float_to_integer %2d%");
+    bind<opcode_008d>(0x008d, 2, "%1d% = integer_to_float %2d%");
+    bind<opcode_008e>(0x008e, 2, "%1d% = float_to_integer %2d%");
+    bind<opcode_008f>(0x008f, 2, "%1d% = integer_to_float %2d%");
+    bind<opcode_0090>(0x0090, 2, "%1d% = float_to_int %2d%");
+    bind<opcode_0091>(0x0091, 2, "%1d% = int_to_float %2d%");
+    bind<opcode_0092>(0x0092, 2, "%1d% = float_to_int %2d%");
+    bind<opcode_0093>(0x0093, 2, "%1d% = int_to_float %2d%");
+    bind<opcode_0094>(0x0094, 1, "abs_var_int %1d%");
+    bind<opcode_0095>(0x0095, 1, "abs_lvar_int %1d%");
+    bind<opcode_0096>(0x0096, 1, "abs_var_float %1d%");
+    bind<opcode_0097>(0x0097, 1, "abs_lvar_float %1d%");
+    bind<opcode_0098>(0x0098, 1, "generate_random_float %1d%");
+    bind<opcode_0099>(0x0099, 1, "generate_random_int %1d%");
+    bind<opcode_009a>(0x009a, 6,
+                      "%6d% = create_char %1d% model %2o% at %3d% %4d% %5d%");
+    bind<opcode_009b>(0x009b, 1, "delete_char %1d%");
+    bind<opcode_009c>(0x009c, 2, "char_wander_dir %1d% to %2d%");
+    bind<opcode_009d>(0x009d, 0, "char_wander_range");
+    bind<opcode_009e>(0x009e, 4, "char_follow_path %1d% path %2d% %3d% %4d%");
+    bind<opcode_009f>(0x009f, 1, "char_set_idle %1d%");
+    bind<opcode_00a0>(0x00a0, 4,
+                      "get_char_coordinates %1d% store_to %2d% %3d% %4d%");
+    bind<opcode_00a1>(0x00a1, 4, "set_char_coordinates %1d% to %2d% %3d% %4d%");
+    bind<opcode_00a2>(0x00a2, 1, "is_char_still_alive %1d%");
+    bind<opcode_00a3>(0x00a3, 6,
+                      "is_char_in_area_2d %1d% from %2d% %3d% to %4d% %5d% sphere %6d%");
+    bind<opcode_00a4>(0x00a4, 8,
+                      "is_char_in_area_3d %1d% from %2d% %3d% %4d% to %5d% %6d% %7d% sphere %8d%");
+    bind<opcode_00a5>(0x00a5, 5, "%5d% = create_car %1o% at %2d% %3d% %4d%");
+    bind<opcode_00a6>(0x00a6, 1, "delete_car %1d%");
+    bind<opcode_00a7>(0x00a7, 4,
+                      "car_goto_coordinates %1d% coords %2d% %3d% %4d%");
+    bind<opcode_00a8>(0x00a8, 1, "car_wander_randomly %1d%");
+    bind<opcode_00a9>(0x00a9, 1, "car_set_idle %1d%");
+    bind<opcode_00aa>(0x00aa, 4,
+                      "get_car_coordinates %1d% store_to %2d% %3d% %4d%");
+    bind<opcode_00ab>(0x00ab, 4, "set_car_coordinates %1d% to %2d% %3d% %4d%");
+    bind<opcode_00ac>(0x00ac, 1, "is_car_still_alive %1d%");
+    bind<opcode_00ad>(0x00ad, 2, "set_car_cruise_speed %1d% to %2d%");
+    bind<opcode_00ae>(0x00ae, 2, "set_car_driving_style %1d% to %2d%");
+    bind<opcode_00af>(0x00af, 2, "set_car_mission %1d% to %2d%");
+    bind<opcode_00b0>(0x00b0, 6,
+                      "is_car_in_area_2d %1d% from %2d% %3d% to %4d% %5d% sphere %6d%");
+    bind<opcode_00b1>(0x00b1, 8,
+                      "is_car_in_area_3d %1d% from %2d% %3d% %4d% to %5d% %6d% %7d% sphere %8d%");
+    bind<opcode_00ba>(0x00ba, 3, "print_big %1g% duration %2d% ms style %3d%");
+    bind<opcode_00bb>(0x00bb, 3, "print %1g% duration %2d% ms flag %3d%");
+    bind<opcode_00bc>(0x00bc, 3, "print_now %1g% duration %2d% ms flag %3d%");
+    bind<opcode_00bd>(0x00bd, 3, "print_soon %1g% duration %2d% ms flag %3d%");
+    bind<opcode_00be>(0x00be, 0, "clear_prints");
+    bind<opcode_00bf>(0x00bf, 2, "get_time_of_day %1d% %2d%");
+    bind<opcode_00c0>(0x00c0, 2, "set_current_time %1d% %2d%");
+    bind<opcode_00c1>(0x00c1, 3,
+                      "%3d% = get_minutes_until_time_of_day %1d% %2d%");
+    bind<opcode_00c2>(0x00c2, 4, "is_point_on_screen %1d% %2d% %3d% %4d%");
+    bind<opcode_00c3>(0x00c3, 0, "debug_on");
+    bind<opcode_00c4>(0x00c4, 0, "debug_off");
+    bind<opcode_00c5>(0x00c5, 0, "return_true");
+    bind<opcode_00c6>(0x00c6, 0, "return_false");
+    bind<opcode_00d6>(0x00d6, 1, "if %1d%");
+    bind<opcode_00d7>(0x00d7, 1, "create_thread_without_extra_params %1p%");
+    bind<opcode_00d8>(0x00d8, 0, "mission_has_finished");
+    bind<opcode_00d9>(0x00d9, 2, "%2d% = store_car_char_is_in %1d%");
+    bind<opcode_00da>(0x00da, 2, "%2d% = store_car_player_is_in %1d%");
+    bind<opcode_00db>(0x00db, 2, "is_char_in_car %1d% car %2d%");
+    bind<opcode_00dc>(0x00dc, 2, "is_player_in_car %1d% car %2d%");
+    bind<opcode_00dd>(0x00dd, 2, "is_char_in_model %1d% model %2o%");
+    bind<opcode_00de>(0x00de, 2, "is_player_in_model %1d% model %2t%");
+    bind<opcode_00df>(0x00df, 1, "is_char_in_any_car %1d%");
+    bind<opcode_00e0>(0x00e0, 1, "is_player_in_any_car %1d%");
+    bind<opcode_00e1>(0x00e1, 2, "is_button_pressed %1d% button %2d%");
+    bind<opcode_00e2>(0x00e2, 3, "%3d% = get_pad_state %1d% button %2d%");
+    bind<opcode_00e3>(0x00e3, 6,
+                      "player %1d% %6bin-sphere/%near_point %2d% %3d% radius %4d% %5d%");
+    bind<opcode_00e4>(0x00e4, 6,
+                      "player %1d% %6b:in-sphere/%near_point_on_foot %2d% %3d% radius %4d% %5d%");
+    bind<opcode_00e5>(0x00e5, 6,
+                      "player %1d% %6bin-sphere/%near_point_in_car %2d% %3d% radius %4d% %5d%");
+    bind<opcode_00e6>(0x00e6, 6,
+                      "player %1d% stopped %6bin-sphere/%near_point %2d% %3d% radius %4d% %5d%");
+    bind<opcode_00e7>(0x00e7, 6,
+                      "player %1d% stopped %6b:in-sphere/%near_point_on_foot %2d% %3d% radius %4d% %5d%");
+    bind<opcode_00e8>(0x00e8, 6,
+                      "player %1d% stopped %6b:in-sphere/%near_point_in_car %2d% %3d% radius %4d% %5d%");
+    bind<opcode_00e9>(0x00e9, 5,
+                      "player %1d% %5b:in-sphere/%near_actor %2d% radius %3d% %4d%");
+    bind<opcode_00ea>(0x00ea, 5,
+                      "player %1d% %5b:in-sphere/%near_actor_on_foot %2d% radius %3d% %4d%");
+    bind<opcode_00eb>(0x00eb, 5,
+                      "player %1d% %5b:in-sphere/%near_actor_in_car %2d% radius %3d% %4d%");
+    bind<opcode_00ec>(0x00ec, 6,
+                      "actor %1d% %6bin-sphere/%near_point %2d% %3d% radius %4d% %5d%");
+    bind<opcode_00ed>(0x00ed, 6,
+                      "actor %1d% %6bin-sphere/%near_point_on_foot %2d% %3d% radius %4d% %5d%");
+    bind<opcode_00ee>(0x00ee, 6,
+                      "actor %1d% %6bin-sphere/%near_point_in_car %2d% %3d% radius %4d% %5d%");
+    bind<opcode_00ef>(0x00ef, 6,
+                      "actor %1d% sphere %6bin-sphere/%near_point %2d% %3d% radius %4d% %5d%");
+    bind<opcode_00f0>(0x00f0, 6,
+                      "actor %1d% stopped %6bin-sphere/%near_point_on_foot %2d% %3d% radius %4d% %5d%");
+    bind<opcode_00f1>(0x00f1, 6,
+                      "actor %1d% stopped %6bin-sphere/%near_point_in_car %2d% %3d% radius %4d% %5d%");
+    bind<opcode_00f2>(0x00f2, 5,
+                      "locate_char_any_means_char_2d %1d% char %2d% radius %3d% %4d% sphere %5h%");
+    bind<opcode_00f3>(0x00f3, 5,
+                      "actor %1d% near_actor_on_foot %2d% radius %3d% %4d% sphere %5h%");
+    bind<opcode_00f4>(0x00f4, 5,
+                      "actor %1d% near_actor_in_car %2d% radius %3d% %4d% %5h%");
+    bind<opcode_00f5>(0x00f5, 8,
+                      "player %1d% %8b:in-sphere/%near_point %2d% %3d% %4d% radius %5d% %6d% %7d%");
+    bind<opcode_00f6>(0x00f6, 8,
+                      "player %1d% %8b:in-sphere/%near_point_on_foot %2d% %3d% %4d% radius %5d% %6d% %7d%");
+    bind<opcode_00f7>(0x00f7, 8,
+                      "player %1d% sphere %8b% near_point_in_car %2d% %3d% %4d% radius %5d% %6d% %7d%");
+    bind<opcode_00f8>(0x00f8, 8,
+                      "player %1d% stopped %8b:in-sphere/%near_point %2d% %3d% %4d% radius %5d% %6d% %7d%");
+    bind<opcode_00f9>(0x00f9, 8,
+                      "player %1d% stopped %8b:in-sphere/%near_point_on_foot %2d% %3d% %4d% radius %5d% %6d% %7d%");
+    bind<opcode_00fa>(0x00fa, 8,
+                      "player %1d% stopped %8b:in-sphere/%near_point_in_car %2d% %3d% %4d% radius %5d% %6d% %7d%");
+    bind<opcode_00fb>(0x00fb, 6,
+                      "player %1d% %6b:in-sphere/%near_actor %2d% radius %3d% %4d% %5d%");
+    bind<opcode_00fc>(0x00fc, 6,
+                      "player %1d% %6b:in-sphere/%near_actor %2d% on_foot radius %3d% %4d% %5d%");
+    bind<opcode_00fd>(0x00fd, 6,
+                      "player %1d% %6b:in-sphere/%near_actor %2d% in_car radius %3d% %4d% %5d%");
+    bind<opcode_00fe>(0x00fe, 8,
+                      "actor %1d% %8bin-sphere/%near_point %2d% %3d% %4d% radius %5d% %6d% %7d%");
+    bind<opcode_00ff>(0x00ff, 8,
+                      "actor %1d% %8bin-sphere/%near_point_on_foot %2d% %3d% %4d% radius %5d% %6d% %7d%");
+    bind<opcode_0100>(0x0100, 8,
+                      "actor %1d% near_point_in_car %2d% %3d% %4d% radius %5d% %6d% %7d% sphere %8h%");
+    bind<opcode_0101>(0x0101, 8,
+                      "actor %1d% stopped_near_point %2d% %3d% %4d% radius %5d% %6d% %7d% sphere %8h%");
+    bind<opcode_0102>(0x0102, 8,
+                      "actor %1d% stopped_near_point_on_foot %2d% %3d% %4d% radius %5d% %6d% %7d% sphere %8h%");
+    bind<opcode_0103>(0x0103, 8,
+                      "actor %1d% stopped_near_point_in_car %2d% %3d% %4d% radius %5d% %6d% %7d% sphere %8d%");
+    bind<opcode_0104>(0x0104, 6,
+                      "actor %1d% near_actor %2d% radius %3d% %4d% %5d% sphere %6h%");
+    bind<opcode_0105>(0x0105, 6,
+                      "actor %1d% near_actor_on_foot %2d% radius %3d% %4d% %5d% sphere %6h%");
+    bind<opcode_0106>(0x0106, 6,
+                      "actor %1d% near_actor_in_car %2d% radius %3d% %4d% %5d% %6h%");
+    bind<opcode_0107>(0x0107, 5, "%5d% = create_object %1o% at %2d% %3d% %4d%");
+    bind<opcode_0108>(0x0108, 1, "destroy_object %1d%");
+    bind<opcode_0109>(0x0109, 2, "player %1d% money += %2d%");
+    bind<opcode_010a>(0x010a, 2, "player %1d% money > %2d%");
+    bind<opcode_010b>(0x010b, 2, "%2d% = player %1d% money");
+    bind<opcode_010c>(0x010c, 5,
+                      "change_player_into_rc_buggy %1d% at %2d% %3d% %4d% %5d%");
+    bind<opcode_010d>(0x010d, 2, "set_player %1d% wanted_level_to %2d%");
+    bind<opcode_010e>(0x010e, 2,
+                      "set_player %1d% minimum_wanted_level_to %2d%");
+    bind<opcode_010f>(0x010f, 2, "player %1d% wanted_level > %2d%");
+    bind<opcode_0110>(0x0110, 1, "clear_player %1d% wanted_level");
+    bind<opcode_0111>(0x0111, 1,
+                      "set_wasted_busted_check_to %1benabled/disabled%");
+    bind<opcode_0112>(0x0112, 0, "has_deatharrest_been_executed");
+    bind<opcode_0113>(0x0113, 3, "add_ammo_to_player %1d% weapon %2h% to %3d%");
+    bind<opcode_0114>(0x0114, 3, "set_actor %1d% car_weapon %2h% ammo_to %3d%");
+    bind<opcode_0117>(0x0117, 1, "player %1d% wasted");
+    bind<opcode_0118>(0x0118, 1, "actor %1d% dead");
+    bind<opcode_0119>(0x0119, 1, "car %1d% wrecked");
+    bind<opcode_011a>(0x011a, 2, "set_actor %1d% search_threat %2i%");
+    bind<opcode_011c>(0x011c, 1, "actor %1d% clear_objective");
+    bind<opcode_0121>(0x0121, 2, "player %1d% in_zone %2z%");
+    bind<opcode_0122>(0x0122, 1, "player %1d% pressing_horn");
+    bind<opcode_0123>(0x0123, 2, "actor %1d% spotted_player %2d%");
+    bind<opcode_0126>(0x0126, 1, "actor %1d% walking");
+    bind<opcode_0129>(0x0129, 4,
+                      "%4d% = create_actor %2d% %3o% in_car %1d% driverseat");
+    bind<opcode_012a>(0x012a, 4,
+                      "put_player %1d% at %2d% %3d% %4d% and_remove_from_car");
+    bind<opcode_0130>(0x0130, 1, "player %1d% busted");
+    bind<opcode_0135>(0x0135, 2, "set_car %1d% door_lock %2d%");
+    bind<opcode_0136>(0x0136, 3, "shake_cam_with_point %1d% xyz %2% %3% %4%");
+    bind<opcode_0137>(0x0137, 2, "car %1d% id == %2o%");
+    bind<opcode_0149>(0x0149, 1, "car %1d% crushed_by_car_crusher");
+    bind<opcode_014b>(0x014b, 13,
+                      "%13d% = init_car_generator %5o% %6d% %7d% force_spawn %8d% alarm %9d% door_lock %10d% min_delay %11d% max_delay %12d% at %1d% %2d% %3d% angle %4d%");
+    bind<opcode_014c>(0x014c, 2,
+                      "set_parked_car_generator %1d% cars_to_generate_to %2d%");
+    bind<opcode_014d>(0x014d, 4,
+                      "text_pager %1g% time_per_char %2d% ms unknown_flags %3d% %4d%");
+    bind<opcode_014e>(0x014e, 1, "start_timer_at %1d%");
+    bind<opcode_014f>(0x014f, 1, "stop_timer %1d%");
+    bind<opcode_0151>(0x0151, 1, "remove_status_text %1d%");
+    bind<opcode_0152>(0x0152, 17,
+                      "set_zone_car_info %1s% %2bday/night% %3h% %4h% %5h% %6h% %7h% %8h% %9h% %10h% %11h% %12h% %13h% %14h% %15h% %16h% %17h%");
+    bind<opcode_0154>(0x0154, 2, "actor %1d% in_zone %2z%");
+    bind<opcode_0156>(0x0156, 3,
+                      "set_zone_ped_density %1z% %2b:day/night% %3d%");
+    bind<opcode_0157>(0x0157, 3,
+                      "camera_on_player %1d% mode %2d% switchstyle %3d%");
+    bind<opcode_0158>(0x0158, 3,
+                      "camera_on_vehicle %1d% mode %2d% switchstyle %3d%");
+    bind<opcode_0159>(0x0159, 3,
+                      "camera_on_ped %1d% mode %2d% switchstyle %3d%");
+    bind<opcode_015a>(0x015a, 0, "restore_camera");
+    bind<opcode_015c>(0x015c, 11,
+                      "set_zone_gang_info %1s% %2bday/night% %3h% %4h% %5h% %6h% %7h% %8h% %9h% %10h% %11h%");
+    bind<opcode_015d>(0x015d, 1, "set_time_scale %1d%");
+    bind<opcode_015e>(0x015e, 1, "car %1d% wheels_on_ground");
+    bind<opcode_015f>(0x015f, 6,
+                      "set_camera_position %1d% %2d% %3d% rotation %4d% %5d% %6d%");
+    bind<opcode_0160>(0x0160, 4,
+                      "point_camera %1d% %2d% %3d% switchstyle %4d%");
+    bind<opcode_0161>(0x0161, 4,
+                      "%4d% = create_marker_above_car %1d% color %2d% visibility %3d%");
+    bind<opcode_0162>(0x0162, 4,
+                      "%4d% = create_marker_above_actor %1d% color %2d% visibility %3d%");
+    bind<opcode_0163>(0x0163, 4,
+                      "%4d% = create_marker_above_object %1d% color %2d% visibility %3d%");
+    bind<opcode_0164>(0x0164, 1, "disable_marker %1d%");
+    bind<opcode_0165>(0x0165, 2, "set_marker %1d% color_to %2d%");
+    bind<opcode_0166>(0x0166, 2, "set_marker %1d% brightness_to %2d%");
+    bind<opcode_0167>(0x0167, 6,
+                      "%6d% = create_marker_at %1d% %2d% %3d% color %4d% visibility %5d%");
+    bind<opcode_0168>(0x0168, 2, "show_on_radar %1d% %2d%");
+    bind<opcode_0169>(0x0169, 3, "set_fade_color %1d% %2d% %3d%");
+    bind<opcode_016a>(0x016a, 2, "fade %2b% for %1d% ms");
+    bind<opcode_016b>(0x016b, 0, "fading");
+    bind<opcode_016c>(0x016c, 4,
+                      "restart_if_wasted at %1d% %2d% %3d% heading %4d%");
+    bind<opcode_016d>(0x016d, 4,
+                      "restart_if_busted at %1d% %2d% %3d% heading %4d%");
+    bind<opcode_016e>(0x016e, 4,
+                      "override_next_restart at %1d% %2d% %3d% heading %4d%");
+    bind<opcode_016f>(0x016f, 10,
+                      "create_particle %1a% %5d% %6d% %7d% %8d% %9d% %10d% at %2d% %3d% %4d%");
+    bind<opcode_0170>(0x0170, 2, "%2d% = player %1d% z_angle");
+    bind<opcode_0171>(0x0171, 2, "set_player %1d% z_angle_to %2d%");
+    bind<opcode_0172>(0x0172, 2, "%2d% = actor %1d% z_angle");
+    bind<opcode_0173>(0x0173, 2, "set_actor %1d% z_angle_to %2d%");
+    bind<opcode_0174>(0x0174, 2, "%2d% = car %1d% z_angle");
+    bind<opcode_0175>(0x0175, 2, "set_car %1d% z_angle_to %2d%");
+    bind<opcode_0176>(0x0176, 2, "%2d% = object %1d% z_angle");
+    bind<opcode_0177>(0x0177, 2, "set_object %1d% z_angle_to %2d%");
+    bind<opcode_0178>(0x0178, 2, "player %1d% picked_up_object %2d%");
+    bind<opcode_0179>(0x0179, 2, "actor %1d% picked_up_object %2d%");
+    bind<opcode_017a>(0x017a, 3, "set_player %1d% weapon %2d% ammo_to %3d%");
+    bind<opcode_017b>(0x017b, 3, "set_actor %1d% weapon %2d% ammo_to %3d%");
+    bind<opcode_0180>(0x0180, 1, "declare_mission_flag %1d%");
+    bind<opcode_0181>(0x0181, 2,
+                      "declare_mission_flag_for_contact %1d% as %2d%");
+    bind<opcode_0182>(0x0182, 2, "contact %1d% base_brief = %2d%");
+    bind<opcode_0183>(0x0183, 2, "player %1d% health > %2h%");
+    bind<opcode_0184>(0x0184, 2, "actor %1d% health >= %2d%");
+    bind<opcode_0185>(0x0185, 2, "car %1d% health >= %2d%");
+    bind<opcode_0186>(0x0186, 2, "%2d% = create_marker_above_car %1d%");
+    bind<opcode_0187>(0x0187, 2, "%2d% = create_marker_above_actor %1d%");
+    bind<opcode_0188>(0x0188, 2, "%2d% = create_marker_above_object %1d%");
+    bind<opcode_0189>(0x0189, 4,
+                      "%4d% = unknown_create_checkpoint_at %1d% %2d% %3d%");
+    bind<opcode_018a>(0x018a, 4, "%4d% = create_checkpoint_at %1d% %2d% %3d%");
+    bind<opcode_018b>(0x018b, 2, "show_on_radar %1d% %2d%");
+    bind<opcode_018c>(0x018c, 4, "play_sound %4d% at %1d% %2d% %3d%");
+    bind<opcode_018d>(0x018d, 5, "%5d% = create_sound %4d% at %1d% %2d% %3d%");
+    bind<opcode_018e>(0x018e, 1, "stop_sound %1d%");
+    bind<opcode_018f>(0x018f, 1, "car %1d% flipped_for_2_seconds");
+    bind<opcode_0190>(0x0190, 1, "add_car %1d% to_flipped_check");
+    bind<opcode_0191>(0x0191, 1, "remove_car %1d% from_flipped_check");
+    bind<opcode_0192>(0x0192, 1, "set_actor %1d% objective_to_stand_still");
+    bind<opcode_0193>(0x0193, 1, "set_actor %1d% objective_to_act_like_ped");
+    bind<opcode_0194>(0x0194, 4,
+                      "set_actor %1d% objective_to_guard_point %2d% %3d% %4d%");
+    bind<opcode_0195>(0x0195, 5,
+                      "set_actor %1d% objective3 %2d% %3d% %4d% %5d%");
+    bind<opcode_0196>(0x0196, 1, "actor %1d% objective5");
+    bind<opcode_0197>(0x0197, 6,
+                      "player %1d% %6b:in-sphere/%in_rectangle_on_foot %2d% %3d% %4d% %5d%");
+    bind<opcode_0198>(0x0198, 6,
+                      "player %1d% %6b:in-sphere/%in_rectangle_in_car %2d% %3d% %4d% %5d%");
+    bind<opcode_0199>(0x0199, 6,
+                      "player %1d% %6b:in-sphere/%in_rectangle %2d% %3d% %4d% %5d%");
+    bind<opcode_019a>(0x019a, 6,
+                      "player %1d% stopped %6b:in-sphere/%in_rectangle_on_foot %2d% %3d% %4d% %5d%");
+    bind<opcode_019b>(0x019b, 6,
+                      "player %1d% stopped %6b:in-sphere/%in_rectangle_in_car %2d% %3d% %4d% %5d%");
+    bind<opcode_019c>(0x019c, 8,
+                      "player %1d% %8b:in-sphere/%in_cube_on_foot %2d% %3d% %4d% %5d% %6d% %7d%");
+    bind<opcode_019d>(0x019d, 8,
+                      "player %1d% %8b:in-sphere/%in_cube_in_car %2d% %3d% %4d% %5d% %6d% %7d%");
+    bind<opcode_019e>(0x019e, 8,
+                      "player %1d% stopped %8b:in-sphere/%in_cube %2d% %3d% %4d% %5d% %6d% %7d%");
+    bind<opcode_019f>(0x019f, 8,
+                      "player %1d% stopped %8b:in-sphere/%in_cube_on_foot %2d% %3d% %4d% %5d% %6d% %7d%");
+    bind<opcode_01a0>(0x01a0, 8,
+                      "player %1d% stopped %8b:in-sphere/%in_cube_in_car %2d% %3d% %4d% %5d% %6d% %7d%");
+    bind<opcode_01a1>(0x01a1, 6,
+                      "actor %1d% %6b:in-sphere/%in_rectangle_on_foot %2d% %3d% %4d% %5d%");
+    bind<opcode_01a2>(0x01a2, 6,
+                      "actor %1d% %6b:in-sphere/%in_rectangle_in_car %2d% %3d% %4d% %5d%");
+    bind<opcode_01a3>(0x01a3, 6,
+                      "actor %1d% stopped %6bin-sphere/%in_rectangle %2d% %3d% %4d% %5d%");
+    bind<opcode_01a4>(0x01a4, 6,
+                      "actor %1d% stopped %6bin-sphere/%in_rectangle_on_foot %2d% %3d% %4d% %5d%");
+    bind<opcode_01a5>(0x01a5, 6,
+                      "actor %1d% stopped %6b:in-sphere/%in_rectangle_in_car %2d% %3d% %4d% %5d%");
+    bind<opcode_01a6>(0x01a6, 8,
+                      "actor %1d% %8b:in-sphere/%in_cube_on_foot %2d% %3d% %4d% %5d% %6d% %7d%");
+    bind<opcode_01a7>(0x01a7, 8,
+                      "actor %1d% %8b:in-sphere/%in_cube_in_car %2d% %3d% %4d% %5d% %6d% %7d%");
+    bind<opcode_01a8>(0x01a8, 8,
+                      "actor %1d% stopped %8bin-sphere/%in_cube %2d% %3d% %4d% %5d% %6d% %7d%");
+    bind<opcode_01a9>(0x01a9, 8,
+                      "actor %1d% stopped %8b:in-sphere/%in_cube_on_foot %2d% %3d% %4d% %5d% %6d% %7d%");
+    bind<opcode_01aa>(0x01aa, 8,
+                      "actor %1d% stopped %8b:in-sphere/%in_cube_in_car %2d% %3d% %4d% %5d% %6d% %7d%");
+    bind<opcode_01ab>(0x01ab, 6,
+                      "car %1d% stopped %6b:in-sphere/%in_rectangle %2d% %3d% %4d% %5d%");
+    bind<opcode_01ac>(0x01ac, 8,
+                      "car %1d% stopped %8b:in-sphere/%in_cube %2d% %3d% %4d% %5d% %6d% %7d%");
+    bind<opcode_01ad>(0x01ad, 6,
+                      "car %1d% sphere %6b% near_point %2d% %3d% radius %4d% %5d%");
+    bind<opcode_01ae>(0x01ae, 6,
+                      "car %1d% stopped %6b:in-sphere/%near_point %2d% %3d% %4d% %5d%");
+    bind<opcode_01af>(0x01af, 8,
+                      "car %1d% %8bin-sphere/%near_point %2d% %3d% %4d% radius %5d% %6d% %7d%");
+    bind<opcode_01b0>(0x01b0, 8,
+                      "car %1d% stopped %8b:in-sphere/%near_point %2d% %3d% %4d% radius %5d% %6d% %7d%");
+    bind<opcode_01b1>(0x01b1, 3, "give_player %1d% weapon %2c% ammo %3d%");
+    bind<opcode_01b2>(0x01b2, 3, "give_actor %1d% weapon %2c% ammo %3d%");
+    bind<opcode_01b4>(0x01b4, 2, "set_player %1d% controllable %2btrue/false%");
+    bind<opcode_01b5>(0x01b5, 1, "force_weather %1d%");
+    bind<opcode_01b6>(0x01b6, 1, "set_weather %1d%");
+    bind<opcode_01b7>(0x01b7, 0, "release_weather");
+    bind<opcode_01b8>(0x01b8, 2, "set_player %1d% armed_weapon_to %2c%");
+    bind<opcode_01b9>(0x01b9, 2, "set_actor %1d% armed_weapon_to %2c%");
+    bind<opcode_01bb>(0x01bb, 4,
+                      "store_object %1d% position_to %2d% %3d% %4d%");
+    bind<opcode_01bc>(0x01bc, 4,
+                      "set_object_coordinates %1d% at %2d% %3d% %4d%");
+    bind<opcode_01bd>(0x01bd, 1, "%1d% = current_time_in_ms");
+    bind<opcode_01be>(0x01be, 4,
+                      "set_actor %1d% to_look_at_spot %2d% %3d% %4d%");
+    bind<opcode_01c0>(0x01c0, 2, "%2d% = player %1d% wanted_level");
+    bind<opcode_01c1>(0x01c1, 1, "car %1d% stopped");
+    bind<opcode_01c2>(0x01c2, 1, "remove_references_to_actor %1d%");
+    bind<opcode_01c3>(0x01c3, 1, "remove_references_to_car %1d%");
+    bind<opcode_01c4>(0x01c4, 1, "remove_references_to_object %1d%");
+    bind<opcode_01c5>(0x01c5, 1, "remove_actor_from_mission_cleanup_list %1d%");
+    bind<opcode_01c6>(0x01c6, 1, "remove_car_from_mission_cleanup_list %1d%");
+    bind<opcode_01c7>(0x01c7, 1,
+                      "remove_object_from_mission_cleanup_list %1d%");
+    bind<opcode_01c8>(0x01c8, 5,
+                      "%5d% = create_actor %2d% model %3o% in_car %1d% passenger_seat %4d%");
+    bind<opcode_01c9>(0x01c9, 2, "actor %1d% kill_actor %2d%");
+    bind<opcode_01ca>(0x01ca, 2, "actor %1d% kill_player %2d%");
+    bind<opcode_01cb>(0x01cb, 2, "actor %1d% kill_actor %2d%");
+    bind<opcode_01cc>(0x01cc, 2, "actor %1d% kill_player %2d%");
+    bind<opcode_01ce>(0x01ce, 2, "actor %1d% avoid_player %2d%");
+    bind<opcode_01cf>(0x01cf, 2, "actor %1d% avoid_char %2d%");
+    bind<opcode_01d0>(0x01d0, 2, "actor %1d% avoid_player %2d%");
+    bind<opcode_01d1>(0x01d1, 2, "actor %1d% follow_actor %2d%");
+    bind<opcode_01d2>(0x01d2, 2, "actor %1d% follow_player %2d%");
+    bind<opcode_01d3>(0x01d3, 2, "actor %1d% leave_car %2d%");
+    bind<opcode_01d4>(0x01d4, 2,
+                      "actor %1d% go_to_car %2d% and_enter_it_as_a_passenger");
+    bind<opcode_01d5>(0x01d5, 2, "actor %1d% go_to_and_drive_car %2d%");
+    bind<opcode_01d8>(0x01d8, 2, "actor %1d% destroy_object %2d%");
+    bind<opcode_01d9>(0x01d9, 2, "actor %1d% destroy_car %2d%");
+    bind<opcode_01de>(0x01de, 2, "tie_actor %1d% to_actor %2d%");
+    bind<opcode_01df>(0x01df, 2, "tie_actor %1d% to_player %2d%");
+    bind<opcode_01e0>(0x01e0, 1, "clear_leader %1d%");
+    bind<opcode_01e1>(0x01e1, 3,
+                      "set_actor %1d% follow_route %2d% behaviour %3d%");
+    bind<opcode_01e2>(0x01e2, 4, "add_route_point %1d% at %2d% %3d% %4d%");
+    bind<opcode_01e3>(0x01e3, 4,
+                      "text_1number_styled %1g% number %2d% duration %3d% ms style %4d%");
+    bind<opcode_01e4>(0x01e4, 4,
+                      "text_1number_lowpriority %1g% number %2d% duration %3d% ms flag %4d%");
+    bind<opcode_01e5>(0x01e5, 4,
+                      "text_1number_highpriority %1g% number %2d% duration %3d% ms flag %4d%");
+    bind<opcode_01e7>(0x01e7, 6,
+                      "switch_roads_on %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_01e8>(0x01e8, 6,
+                      "switch_roads_off %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_01e9>(0x01e9, 2, "%2d% = car %1d% num_passengers");
+    bind<opcode_01ea>(0x01ea, 2, "%2d% = car %1d% max_passengers");
+    bind<opcode_01eb>(0x01eb, 1, "set_car_density_to %1d%");
+    bind<opcode_01ec>(0x01ec, 2, "make_car %1d% very_heavy %2h%");
+    bind<opcode_01ed>(0x01ed, 1, "clear_actor %1d% threat_search");
+    bind<opcode_01ee>(0x01ee, 10,
+                      "activate_crane %1d% %2d% %3d% %4d% %5d% %6d% %7d% %8d% %9d% %10d%");
+    bind<opcode_01ef>(0x01ef, 2, "deactivate_crane %1d% %2d%");
+    bind<opcode_01f0>(0x01f0, 1, "set_max_wanted_level_to %1d%");
+    bind<opcode_01f3>(0x01f3, 1, "car %1d% airborne");
+    bind<opcode_01f4>(0x01f4, 1, "car %1d% flipped");
+    bind<opcode_01f5>(0x01f5, 2,
+                      "%2d% = create_emulated_actor_from_player %1d%");
+    bind<opcode_01f6>(0x01f6, 0, "cancel_override_restart");
+    bind<opcode_01f7>(0x01f7, 2,
+                      "set_player %1d% ignored_by_cops_state_to %2b:true/false%");
+    bind<opcode_01f9>(0x01f9, 9,
+                      "init_rampage %1g% weapon %2d% time %3d% %4d% targets %5o% %6o% %7o% %8o% flag %9d%");
+    bind<opcode_01fa>(0x01fa, 1, "%1d% = rampage_status");
+    bind<opcode_01fb>(0x01fb, 2, "%2d% = square_root %1d%");
+    bind<opcode_01fc>(0x01fc, 5,
+                      "player %1d% near_car %2d% radius %3d% %4d% unknown %5d%");
+    bind<opcode_01fd>(0x01fd, 5,
+                      "player %1d% near_car_on_foot %2d% radius %3d% %4d% unknown %5d%");
+    bind<opcode_01fe>(0x01fe, 5,
+                      "player %1d% near_car_in_car %2d% radius %3d% %4d% unknown %5d%");
+    bind<opcode_01ff>(0x01ff, 6,
+                      "player %1d% near_car %2d% radius %3d% %4d% %5d% unknown %6h%");
+    bind<opcode_0200>(0x0200, 6,
+                      "player %1d% near_car_on_foot %2d% radius %3d% %4d% %5d% unknown %6h%");
+    bind<opcode_0201>(0x0201, 6,
+                      "player %1d% near_car_in_car %2d% radius %3d% %4d% %5d% unknown %6h%");
+    bind<opcode_0202>(0x0202, 5,
+                      "actor %1d% near_car %2d% radius %3d% %4d% sphere %5d%");
+    bind<opcode_0203>(0x0203, 5,
+                      "actor %1d% near_car_on_foot %2d% radius %3d% %4d% unknown %5d%");
+    bind<opcode_0204>(0x0204, 5,
+                      "actor %1d% near_car_in_car %2d% radius %3d% %4d% unknown %5d%");
+    bind<opcode_0205>(0x0205, 6,
+                      "actor %1d% near_car %2d% radius %3d% %4d% %5d% unknown %6h%");
+    bind<opcode_0206>(0x0206, 6,
+                      "actor %1d% near_car_on_foot %2d% radius %3d% %4d% %5d% unknown %6h%");
+    bind<opcode_0207>(0x0207, 6,
+                      "actor %1d% near_car_in_car %2d% radius %3d% %4d% %5d% unknown %6h%");
+    bind<opcode_0208>(0x0208, 3, "%3d% = random_float %1d% %2d%");
+    bind<opcode_0209>(0x0209, 3, "%3d% = random_int_in_ranges %1d% %2d%");
+    bind<opcode_020a>(0x020a, 2, "set_car %1d% door_status_to %2d%");
+    bind<opcode_020b>(0x020b, 1, "explode_car %1d%");
+    bind<opcode_020c>(0x020c, 4, "create_explosion %4d% at %1d% %2d% %3d%");
+    bind<opcode_020d>(0x020d, 1, "car %1d% is_upright");
+    bind<opcode_020e>(0x020e, 2, "actor %1d% look_at_actor %2d%");
+    bind<opcode_020f>(0x020f, 2, "actor %1d% look_at_player %2d%");
+    bind<opcode_0210>(0x0210, 2, "player %1d% look_at_actor %2d%");
+    bind<opcode_0211>(0x0211, 3, "actor %1d% walk_to %2d% %3d%");
+    bind<opcode_0213>(0x0213, 6,
+                      "%6d% = create_pickup %1o% type %2d% at %3d% %4d% %5d%");
+    bind<opcode_0214>(0x0214, 1, "pickup %1d% picked_up");
+    bind<opcode_0215>(0x0215, 1, "destroy_pickup %1d%");
+    bind<opcode_0216>(0x0216, 2,
+                      "set_car %1d% taxi_available_light_to %2b:on/off%");
+    bind<opcode_0217>(0x0217, 3,
+                      "text_big_styled %1g% duration %2d% ms style %3d%");
+    bind<opcode_0218>(0x0218, 4,
+                      "text_big_1number_styled %1g% number %2d% duration %3d% ms style %4d%");
+    bind<opcode_0219>(0x0219, 8,
+                      "%8h% = create_garage %7h% from %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_021b>(0x021b, 2, "set_garage %1d% to_accept_car %2d%");
+    bind<opcode_021c>(0x021c, 1, "car_inside_garage %1d%");
+    bind<opcode_021d>(0x021d, 1, "set_free_bomb_shop_to %1btrue/false%");
+    bind<opcode_0220>(0x0220, 1, "car %d has_car_bomb");
+    bind<opcode_0221>(0x0221, 2, "set_player %1d% apply_brakes_to_car %2d%");
+    bind<opcode_0222>(0x0222, 2, "set_player %1d% health_to %2d%");
+    bind<opcode_0223>(0x0223, 2, "set_actor %1d% health_to %2d%");
+    bind<opcode_0224>(0x0224, 2, "set_car %1d% health_to %2d%");
+    bind<opcode_0225>(0x0225, 2, "%2d% = player %1d% health");
+    bind<opcode_0226>(0x0226, 2, "%2d% = actor %1d% health");
+    bind<opcode_0227>(0x0227, 2, "%2d% = car %1d% health");
+    bind<opcode_0228>(0x0228, 2, "car %1d% bomb_status == %2d%");
+    bind<opcode_0229>(0x0229, 3, "set_car %1d% color_to %2d% %3d%");
+    bind<opcode_022a>(0x022a, 6,
+                      "switch_ped_roads_on %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_022b>(0x022b, 6,
+                      "switch_ped_roads_off %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_022c>(0x022c, 2, "set_actor %1d% to_look_at_actor %2d%");
+    bind<opcode_022d>(0x022d, 2, "set_actor %1d% to_look_at_player %2d%");
+    bind<opcode_022e>(0x022e, 2, "set_player %1d% to_look_at_actor %2d%");
+    bind<opcode_022f>(0x022f, 1, "set_actor %1d% stop_looking");
+    bind<opcode_0230>(0x0230, 1, "set_player %1d% stop_looking");
+    bind<opcode_0231>(0x0231, 1, "script_heli %1bon/off%");
+    bind<opcode_0235>(0x0235, 3, "set_gang %1h% models_to %2o% %3o%");
+    bind<opcode_0236>(0x0236, 2, "set_gang %1d% car_to %2o%");
+    bind<opcode_0237>(0x0237, 3,
+                      "set_gang %1d% primary_weapon_to %2c% secondary_weapon_to %3c%");
+    bind<opcode_0239>(0x0239, 3, "actor %1d% run_to %2d% %3d%");
+    bind<opcode_023a>(0x023a, 2, "has_player_collided_with_object %1d% %2d%");
+    bind<opcode_023b>(0x023b, 2, "has_actor_collided_with_object %1d% %2d%");
+    bind<opcode_023c>(0x023c, 2, "load_special_actor %2d% as %1d%");
+    bind<opcode_023d>(0x023d, 1, "special_actor %1d% loaded");
+    bind<opcode_0240>(0x0240, 2, "flash_object %1d% %2d%");
+    bind<opcode_0241>(0x0241, 1, "player %1d% in_remote_mode");
+    bind<opcode_0242>(0x0242, 2, "set_car %1d% bomb_status_to %2d%");
+    bind<opcode_0243>(0x0243, 2, "set_actor %1d% ped_stats_to %2d%");
+    bind<opcode_0244>(0x0244, 3, "set_cutscene_pos %1d% %2d% %3d%");
+    bind<opcode_0245>(0x0245, 2, "set_actor %1d% walk_style_to %2d%");
+    bind<opcode_0247>(0x0247, 1, "request_model %1o%");
+    bind<opcode_0248>(0x0248, 1, "model %1o% available");
+    bind<opcode_0249>(0x0249, 1, "release_model %1o%");
+    bind<opcode_024a>(0x024a, 3, "%3d% = create_payphone_at %1d% %2d%");
+    bind<opcode_024b>(0x024b, 2, "text_payphone_repeatedly %1d% %2g%");
+    bind<opcode_024c>(0x024c, 2, "text_payphone %1d% %2g%");
+    bind<opcode_024d>(0x024d, 1, "payphone_text_been_displayed %1d%");
+    bind<opcode_024e>(0x024e, 1, "disable_payphone %1d%");
+    bind<opcode_024f>(0x024f, 9,
+                      "create_corona %4d% %5d% %6d% with_color %7d% %8d% %9d% at_point %1d% %2d% %3d%");
+    bind<opcode_0250>(0x0250, 6,
+                      "create_light_at %1d% %2d% %3d% RGB_values %4d% %5d% %6d%");
+    bind<opcode_0253>(0x0253, 0, "save_current_time");
+    bind<opcode_0254>(0x0254, 0, "restore_time_of_day");
+    bind<opcode_0255>(0x0255, 4,
+                      "set_critical_mission_restart_at %1d% %2d% %3d% angle %4d%");
+    bind<opcode_0256>(0x0256, 1, "is_player %1d% defined");
+    bind<opcode_0291>(0x0291, 2, "set_actor %1d% attack_when_provoked %2d%");
+    bind<opcode_0293>(0x0293, 1, "%1d% = get_controller_mode");
+    bind<opcode_0294>(0x0294, 2,
+                      "set_car %1d% resprayable_to %2benabled/disabled%");
+    bind<opcode_0296>(0x0296, 1, "unload_special_actor %1d%");
+    bind<opcode_0297>(0x0297, 0, "clear_rampage_kills");
+    bind<opcode_0298>(0x0298, 2, "%2d% = rampage_kills %1o%");
+    bind<opcode_0299>(0x0299, 1, "activate_garage %1d%");
+    bind<opcode_029b>(0x029b, 5, "%5d% = create_object %1o% at %2d% %3d% %4d%");
+    bind<opcode_029c>(0x029c, 1, "is_boat %1d%");
+    bind<opcode_029f>(0x029f, 1, "player %1d% stopped");
+    bind<opcode_02a0>(0x02a0, 1, "actor %1d% stopped");
+    bind<opcode_02a1>(0x02a1, 2, "skippable_wait");
+    bind<opcode_02a2>(0x02a2, 5, "create_particle %1a% %5d% at %2d% %3d% %4d%");
+    bind<opcode_02a3>(0x02a3, 1, "toggle_widescreen %1bon/off%");
+    bind<opcode_02a7>(0x02a7, 5,
+                      "%5d% = create_icon_marker_and_sphere %4d% at %1d% %2d% %3d%");
+    bind<opcode_02a8>(0x02a8, 5, "%5d% = create_marker %4d% at %1d% %2d% %3d%");
+    bind<opcode_02a9>(0x02a9, 2,
+                      "set_char_only_damaged_by_player %1d% to %2d%");
+    bind<opcode_02aa>(0x02aa, 2, "set_car %1d% immune_to_nonplayer %2d%");
+    bind<opcode_02ab>(0x02ab, 6,
+                      "set_actor %1d% immunities BP %2d% FP %3d% EP %4d% CP %5d% MP %6d%");
+    bind<opcode_02ac>(0x02ac, 6,
+                      "set_car %1d% immunities %2d% %3d% %4d% %5d% %6d%");
+    bind<opcode_02ad>(0x02ad, 7,
+                      "player %1d% in_area %2d% %3d% %4d% %5d% radius %6d% sphere %7h%");
+    bind<opcode_02ae>(0x02ae, 7,
+                      "player %1d% in_area_on_foot %2d% %3d% %4d% %5d% radius %6d% sphere %7h%");
+    bind<opcode_02af>(0x02af, 7,
+                      "player %1d% in_area_in_car %2d% %3d% %4d% %5d% radius %6d% sphere %7h%");
+    bind<opcode_02b0>(0x02b0, 7,
+                      "player %1d% stopped_in_area %2d% %3d% %4d% %5d% radius %6d% sphere %7h%");
+    bind<opcode_02b1>(0x02b1, 7,
+                      "player %1d% stopped_in_area_on_foot %2d% %3d% %4d% %5d% radius %6d% sphere %7h%");
+    bind<opcode_02b2>(0x02b2, 7,
+                      "player %1d% stopped_in_area_in_car %2d% %3d% %4d% %5d% radius %6d% sphere %7h%");
+    bind<opcode_02b3>(0x02b3, 9,
+                      "player %1d% in_cube %2d% %3d% %4d% %5d% %6d% %7d% radius %8d% sphere %9h%");
+    bind<opcode_02b4>(0x02b4, 9,
+                      "player %1d% in_cube_on_foot %2d% %3d% %4d% %5d% %6d% %7d% radius %8d% sphere %9h%");
+    bind<opcode_02b5>(0x02b5, 9,
+                      "player %1d% in_cube_in_car %2d% %3d% %4d% %5d% %6d% %7d% radius %8d% sphere %9h%");
+    bind<opcode_02b6>(0x02b6, 9,
+                      "player %1d% stopped_in_cube %2d% %3d% %4d% %5d% %6d% %7d% radius %8d% sphere %9h%");
+    bind<opcode_02b7>(0x02b7, 9,
+                      "player %1d% stopped_in_cube_on_foot %2d% %3d% %4d% %5d% %6d% %7d% radius %8d% sphere %9h%");
+    bind<opcode_02b8>(0x02b8, 9,
+                      "player %1d% stopped_in_cube_in_car %2d% %3d% %4d% %5d% %6d% %7d% radius %8d% sphere %9h%");
+    bind<opcode_02b9>(0x02b9, 1, "deactivate_garage %1d%");
+    bind<opcode_02bc>(0x02bc, 1, "set_cop_behaviour %1b:kill/arrest%");
+    bind<opcode_02bf>(0x02bf, 1, "car %1d% sunk");
+    bind<opcode_02c0>(0x02c0, 6,
+                      "set %4d% %5d% %6d% to_ped_path_coords_closest_to %1d% %2d% %3d%");
+    bind<opcode_02c1>(0x02c1, 6,
+                      "set %4d% %5d% %6d% to_car_path_coords_closest_to %1d% %2d% %3d%");
+    bind<opcode_02c2>(0x02c2, 4, "car %1d% drive_to_point %2d% %3d% %4d%");
+    bind<opcode_02c3>(0x02c3, 1, "create_donkey_mags %1d%");
+    bind<opcode_02c5>(0x02c5, 1, "%1d% = donkey_mags_picked_up");
+    bind<opcode_02c6>(0x02c6, 0, "remove_pickup_items_from_ground");
+    bind<opcode_02c7>(0x02c7, 5,
+                      "scatter_platinum %5d% at %1d% %2d% %3d% %4d%");
+    bind<opcode_02c8>(0x02c8, 1, "%1d% = platinum_pieces_in_car");
+    bind<opcode_02c9>(0x02c9, 0, "remove_platinum_from_car");
+    bind<opcode_02ca>(0x02ca, 1, "is_car_on_screen %1d%");
+    bind<opcode_02cb>(0x02cb, 1, "is_actor_on_screen %1d%");
+    bind<opcode_02cc>(0x02cc, 1, "is_object_on_screen %1d%");
+    bind<opcode_02cd>(0x02cd, 2, "call %1p% %2p%");
+    bind<opcode_02ce>(0x02ce, 4,
+                      "get_ground_z_for_3d_coord %1d% %2d% %3d% store_to %4d%");
+    bind<opcode_02cf>(0x02cf, 4, "%4d% = create_fire_at %1d% %2d% %3d%");
+    bind<opcode_02d0>(0x02d0, 1, "fire %1d% extinguished");
+    bind<opcode_02d1>(0x02d1, 1, "remove_fire %1d%");
+    bind<opcode_02d3>(0x02d3, 4, "boat %1d% drive_to %2d% %3d% %4d%");
+    bind<opcode_02d4>(0x02d4, 1, "boat_stop %1d%");
+    bind<opcode_02d5>(0x02d5, 6,
+                      "player %1d% firing_weapons_in_rectangle %2d% %3d% %4d% %5d% %6d%");
+    bind<opcode_02d7>(0x02d7, 2, "player %1d% currentweapon == %2c%");
+    bind<opcode_02d8>(0x02d8, 2, "actor %1d% current_weapon == %2c%");
+    bind<opcode_02d9>(0x02d9, 0, "donkey_mags_picked_up = none");
+    bind<opcode_02db>(0x02db, 2, "set_boat %1d% speed_to %2d%");
+    bind<opcode_02dd>(0x02dd, 2, "get_random_actor %2d% in_zone %1s%");
+    bind<opcode_02de>(0x02de, 1, "player %1d% driving_taxi_vehicle");
+    bind<opcode_02df>(0x02df, 1, "player %1d% agressive");
+    bind<opcode_02e0>(0x02e0, 1, "actor %1d% firing_weapon");
+    bind<opcode_02e1>(0x02e1, 5,
+                      "%5d% = create_cash_pickup %4d% at %1d% %2d% %3d%");
+    bind<opcode_02e2>(0x02e2, 2, "set_actor %1d% weapon_accuracy_to %2d%");
+    bind<opcode_02e3>(0x02e3, 2, "%2d% = car %1d% speed");
+    bind<opcode_02e4>(0x02e4, 1, "load_cutscene_data %1s%");
+    bind<opcode_02e5>(0x02e5, 2, "%2d% = create_cutscene_object %1o%");
+    bind<opcode_02e6>(0x02e6, 2, "set_cutscene_anim %1d% %2s%");
+    bind<opcode_02e7>(0x02e7, 0, "start_cutscene");
+    bind<opcode_02e8>(0x02e8, 1, "%1d% = cutscenetime");
+    bind<opcode_02e9>(0x02e9, 0, "cutscene_reached_end");
+    bind<opcode_02ea>(0x02ea, 0, "end_cutscene");
+    bind<opcode_02eb>(0x02eb, 0, "restore_camera_jumpcut");
+    bind<opcode_02ec>(0x02ec, 3, "put_hidden_package_at %1d% %2d% %3d%");
+    bind<opcode_02ed>(0x02ed, 1, "set_total_hidden_packages_to %1d%");
+    bind<opcode_02ee>(0x02ee, 6,
+                      "is_projectile_in_cube %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_02ef>(0x02ef, 6,
+                      "destroy_projectiles_in_cube %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_02f1>(0x02f1, 3, "drop_nautical_mine_at %1d% %2d% %3d%");
+    bind<opcode_02f2>(0x02f2, 2, "actor %1d% model == %2h%");
+    bind<opcode_02f3>(0x02f3, 2, "load_object %1o% %2f%");
+    bind<opcode_02f4>(0x02f4, 3,
+                      "create_cutscene_actor %3d% from_head %2o% and_body %1d%");
+    bind<opcode_02f5>(0x02f5, 2, "set_head_anim %1d% %2s%");
+    bind<opcode_02f6>(0x02f6, 2, "%2d% = sine %1d%");
+    bind<opcode_02f7>(0x02f7, 2, "%2d% = cosine %1d%");
+    bind<opcode_02f8>(0x02f8, 2, "get_car %1d% Z_angle_sine_to %2d%");
+    bind<opcode_02f9>(0x02f9, 2, "get_car %1d% Z_angle_cosine_to %2d%");
+    bind<opcode_02fa>(0x02fa, 2, "garage %1d% change_to_type %2d%");
+    bind<opcode_02fb>(0x02fb, 10,
+                      "create_crusher_crane %1d% %2d% %3d% %4d% %5d% %6d% %7d% %8d% %9d% %10d%");
+    bind<opcode_02fc>(0x02fc, 5,
+                      "text_2numbers %1g% numbers %2d% %3d% duration %4d% ms flag %5d%");
+    bind<opcode_02fd>(0x02fd, 5,
+                      "text_2numbers_lowpriority %1g% numbers %2d% %3d% duration %4d% ms flag %5d%");
+    bind<opcode_02fe>(0x02fe, 5,
+                      "text_2numbers_highpriority %1g% numbers %2d% %3d% duration %4d% ms flag %5d%");
+    bind<opcode_02ff>(0x02ff, 6,
+                      "text_3numbers %1g% numbers %2d% %3d% %4d% duration %5d% ms flag %6h%");
+    bind<opcode_0300>(0x0300, 6,
+                      "text_3numbers_highpriority %1g% numbers %2d% %3d% %4d% duration %5d% ms flag %6h%");
+    bind<opcode_0301>(0x0301, 6,
+                      "text_3numbers_lowpriority %1g% numbers %2d% %3d% %4d% duration %5d% ms flag %6h%");
+    bind<opcode_0302>(0x0302, 7,
+                      "text_4numbers %1g% numbers %2d% %3d% %4d% %5d% duration %6d% ms flag %7d%");
+    bind<opcode_0303>(0x0303, 7,
+                      "text_4numbers_highpriority %1g% numbers %2d% %3d% %4d% %5d% duration %6d% ms flag %7d%");
+    bind<opcode_0304>(0x0304, 7,
+                      "text_4numbers_lowpriority %1g% numbers %2d% %3d% %4d% %5d% duration %6d% ms flag %7d%");
+    bind<opcode_0305>(0x0305, 8,
+                      "text_5numbers %1g% numbers %2d% %3d% %4d% %5d% %6d% duration %7d% ms flag %8d%");
+    bind<opcode_0306>(0x0306, 8,
+                      "text_5numbers_highpriority %1g% numbers %2d% %3d% %4d% %5d% %6d% duration %7d% ms flag %8d%");
+    bind<opcode_0307>(0x0307, 8,
+                      "text_5numbers_lowpriority %1g% numbers %2d% %3d% %4d% %5d% %6d% duration %7d% ms flag %8d%");
+    bind<opcode_0308>(0x0308, 9,
+                      "text_6numbers %1g% numbers %2d% %3d% %4d% %5d% %6d% %7d% duration %8d% ms flag %9d%");
+    bind<opcode_0309>(0x0309, 9,
+                      "text_6numbers_highpriority %1g% numbers %2d% %3d% %4d% %5d% %6d% %7d% duration %8d% ms flag %9d%");
+    bind<opcode_030a>(0x030a, 9,
+                      "text_6numbers_lowpriority %1g% numbers %2d% %3d% %4d% %5d% %6d% %7d% duration %8d% ms flag %9d%");
+    bind<opcode_030c>(0x030c, 1, "set_mission_points += %1d%");
+    bind<opcode_030d>(0x030d, 1, "set_total_mission_points_to %1d%");
+    bind<opcode_030e>(0x030e, 1, "save_jump_distance %1d%");
+    bind<opcode_030f>(0x030f, 1, "save_jump_height %1d%");
+    bind<opcode_0310>(0x0310, 1, "save_jump_flips %1d%");
+    bind<opcode_0311>(0x0311, 1, "save_jump_rotation %1d%");
+    bind<opcode_0312>(0x0312, 1, "save_jump_type %1d%");
+    bind<opcode_0313>(0x0313, 0, "increment_unique_jumps_found");
+    bind<opcode_0314>(0x0314, 1, "set_total_unique_jumps_to %1d%");
+    bind<opcode_0315>(0x0315, 0, "increment_taxi_dropoffs");
+    bind<opcode_0316>(0x0316, 1, "save_taxi_earnings_from %1d%");
+    bind<opcode_0317>(0x0317, 0, "increment_mission_attempts");
+    bind<opcode_0318>(0x0318, 1, "set_latest_mission_passed %1g%");
+    bind<opcode_0319>(0x0319, 2, "set_actor %1d% running %2b:true/false%");
+    bind<opcode_031a>(0x031a, 0, "remove_all_fires");
+    bind<opcode_031d>(0x031d, 2, "actor %1d% hit_by_weapon %2d%");
+    bind<opcode_031e>(0x031e, 2, "vehicle %1d% hit_by_weapon %2h%");
+    bind<opcode_031f>(0x031f, 2, "unknown_actor %1d% unknown_actor %2d%");
+    bind<opcode_0320>(0x0320, 2, "actor %1d% in_range_of_player %2d%");
+    bind<opcode_0321>(0x0321, 1, "kill_actor %1d%");
+    bind<opcode_0322>(0x0322, 1, "kill_player %1d%");
+    bind<opcode_0323>(0x0323, 2, "enable_boat %1d% anchor %2d%");
+    bind<opcode_0324>(0x0324, 3,
+                      "set_zone_pedgroup_info %1z% %2b:day/night% %3u%");
+    bind<opcode_0325>(0x0325, 2, "set_car_on_fire %1d% store_to %2d%");
+    bind<opcode_0326>(0x0326, 2, "set_actor_on_fire %1d% fire store_to %2d%");
+    bind<opcode_0327>(0x0327, 6,
+                      "%6d% = get_random_car_of_type %5d% in_area %1d% %2d% to %3d% %4d%");
+    bind<opcode_0329>(0x0329, 1, "garage %1d% respray_done");
+    bind<opcode_032a>(0x032a, 1, "set_behind_camera_mode_to %1h%");
+    bind<opcode_032b>(0x032b, 7,
+                      "%7d% = create_weapon_pickup %1o% type %2d% ammo %3d% at %4d% %5d% %6d%");
+    bind<opcode_032c>(0x032c, 2, "car %1d% ram %2d%");
+    bind<opcode_032d>(0x032d, 2, "car %1d% block %2d%");
+    bind<opcode_0330>(0x0330, 2,
+                      "set_player %1d% infinite_run_to %2b:true/false%");
+    bind<opcode_0331>(0x0331, 2, "set_player %1d% fast_reload %2h%");
+    bind<opcode_0332>(0x0332, 2, "set_actor %1d% bleeding_to %2b:true/false%");
+    bind<opcode_0335>(0x0335, 1, "set_free_paynspray_to %1b:true/false%");
+    bind<opcode_0336>(0x0336, 2, "set_player %1d% visible %2d%");
+    bind<opcode_0337>(0x0337, 2, "set_actor %1d% visible %2h%");
+    bind<opcode_0339>(0x0339, 11,
+                      "objects_in_cube %1d% %2d% %3d% to %4d% %5d% %6d% flags %7d% %8d% %9d% %10d% %11d%");
+    bind<opcode_033a>(0x033a, 0, "create_incoming_cessna");
+    bind<opcode_033b>(0x033b, 0, "incoming_cessna_landed");
+    bind<opcode_033c>(0x033c, 0, "incoming_cessna_destroyed");
+    bind<opcode_033e>(0x033e, 3, "text_draw %1d% %2d% %3g%");
+    bind<opcode_033f>(0x033f, 2, "set_text_draw_letter_width_height %1d% %2d%");
+    bind<opcode_0340>(0x0340, 4, "set_text_draw_color %1d% %2d% %3d% %4d%");
+    bind<opcode_0341>(0x0341, 1, "set_text_draw_align_justify %1d%");
+    bind<opcode_0342>(0x0342, 1, "set_text_draw_centered %1d%");
+    bind<opcode_0343>(0x0343, 1, "set_text_linewidth %1d%");
+    bind<opcode_0344>(0x0344, 1,
+                      "set_text_draw_linewidth %1d% for_centered_text");
+    bind<opcode_0345>(0x0345, 1, "enable_text_draw_background %1d%");
+    bind<opcode_0346>(0x0346, 4,
+                      "set_text_draw_background_color %1d% %2d% %3d% %4d%");
+    bind<opcode_0348>(0x0348, 1, "enable_text_draw_proportional %1d%");
+    bind<opcode_0349>(0x0349, 1, "text_draw_style = %1d%");
+    bind<opcode_034a>(0x034a, 0, "portland_complete");
+    bind<opcode_034b>(0x034b, 0, "staunton_complete");
+    bind<opcode_034c>(0x034c, 0, "shoreside_complete");
+    bind<opcode_034d>(0x034d, 4,
+                      "rotate_object %1d% from_angle %2d% to %3d% collision_check %4d%");
+    bind<opcode_034e>(0x034e, 8,
+                      "move_object %1d% to %2d% %3d% %4d% speed %5d% %6d% %7d% collision_check %8d%");
+    bind<opcode_034f>(0x034f, 1, "destroy_actor_with_fade %1d%");
+    bind<opcode_0350>(0x0350, 2,
+                      "set_actor %1d% maintain_position_when_attacked %2d%");
+    bind<opcode_0351>(0x0351, 0, "gore_enabled");
+    bind<opcode_0352>(0x0352, 2, "set_actor %1d% skin_to %2s%");
+    bind<opcode_0353>(0x0353, 1, "refresh_actor %1d%");
+    bind<opcode_0354>(0x0354, 1, "set_up_chase_scene %1d%");
+    bind<opcode_0355>(0x0355, 0, "clean_up_chase_scene");
+    bind<opcode_0356>(0x0356, 7,
+                      "explosion_type %1d% in_cube %2d% %3d% %4d% to %5d% %6d% %7d%");
+    bind<opcode_0357>(0x0357, 2, "explosion_type %1d% in_zone %2z%");
+    bind<opcode_0358>(0x0358, 0, "start_drug_drop_off");
+    bind<opcode_0359>(0x0359, 0, "drop_off_cessna_shot_down");
+    bind<opcode_035a>(0x035a, 3, "find_drop_off_plane_coords %1d% %2d% %3d%");
+    bind<opcode_035b>(0x035b, 4,
+                      "%4d% = create_drop_off_package %1d% %2d% %3d%");
+    bind<opcode_035c>(0x035c, 5,
+                      "place_object %1d% relative_to_car %2d% offset %3d% %4d% %5d%");
+    bind<opcode_035d>(0x035d, 1, "make_object %1d% targetable");
+    bind<opcode_035e>(0x035e, 2, "set_player %1d% armour_to %2d%");
+    bind<opcode_035f>(0x035f, 2, "set_actor %1d% armour_to %2d%");
+    bind<opcode_0360>(0x0360, 1, "open_garage %1d%");
+    bind<opcode_0361>(0x0361, 1, "close_garage %1d%");
+    bind<opcode_0362>(0x0362, 4,
+                      "remove_actor %1d% from_car_and_place_at %2d% %3d% %4d%");
+    bind<opcode_0363>(0x0363, 6,
+                      "toggle_model_render_at %1d% %2d% %3d% radius %4d% object %5o% %6d%");
+    bind<opcode_0365>(0x0365, 1, "set_actor %1d% objective_hail_taxi");
+    bind<opcode_0366>(0x0366, 1, "had_object_been_damaged %1d%");
+    bind<opcode_0367>(0x0367, 9,
+                      "init_headshot_rampage %1g% weapon %2d% time %3d% %4d% targets %5o% %6o% %7o% %8o% flag %9d%");
+    bind<opcode_0368>(0x0368, 10,
+                      "create_ev_crane %1d% %2d% %3d% %4d% %5d% %6d% %7d% %8d% %9d% %10d%");
+    bind<opcode_0369>(0x0369, 2, "put_player %1d% in_car %2d%");
+    bind<opcode_036a>(0x036a, 2, "put_actor %1d% in_car %2d%");
+    bind<opcode_036d>(0x036d, 5,
+                      "text_2numbers_styled %1g% numbers %2d% %3d% duration %4d% ms style %5d%");
+    bind<opcode_036e>(0x036e, 6,
+                      "text_3numbers_styled %1g% numbers %2d% %3d% %4d% duration %5d% ms style %6d%");
+    bind<opcode_036f>(0x036f, 7,
+                      "text_4numbers_styled %1g% numbers %2d% %3d% %4d% %5d% duration %6d% ms flag %7d%");
+    bind<opcode_0370>(0x0370, 8,
+                      "text_5numbers_styled %1g% numbers %2d% %3d% %4d% %5d% %6d% duration %7d% ms flag %8d%");
+    bind<opcode_0371>(0x0371, 9,
+                      "text_6numbers_styled %1g% numbers %2d% %3d% %4d% %5d% %6d% %7d% duration %8d% ms flag %9d%");
+    bind<opcode_0372>(0x0372, 3,
+                      "set_actor %1d% anim %2d% wait_state_time %3d% ms");
+    bind<opcode_0373>(0x0373, 0, "set_camera_directly_behind_player");
+    bind<opcode_0374>(0x0374, 1, "set_motion_blur %1d%");
+    bind<opcode_0375>(0x0375, 4,
+                      "text_1string %1g% %2g% duration %3d% ms flag %4d%");
+    bind<opcode_0376>(0x0376, 4, "%4d% = create_random_actor %1d% %2d% %3d%");
+    bind<opcode_0377>(0x0377, 1, "set_actor %1d% steal_any_car");
+    bind<opcode_0378>(0x0378, 3,
+                      "text_payphone_1string_repeatedly %1d% %2g% %3g%");
+    bind<opcode_0379>(0x0379, 3, "text_payphone_1string %1d% %2g% %3g%");
+    bind<opcode_037a>(0x037a, 4,
+                      "text_payphone_2strings_repeatedly %1d% %2g% %3g% %4g%");
+    bind<opcode_037b>(0x037b, 4, "text_payphone_2strings %1d% %2g% %3g% %4g%");
+    bind<opcode_037c>(0x037c, 5,
+                      "text_payphone_3strings_repeatedly %1d% %2g% %3g% %4g% %5g%");
+    bind<opcode_037d>(0x037d, 5,
+                      "text_payphone_3strings %1d% %2g% %3g% %4g% %5g%");
+    bind<opcode_037e>(0x037e, 6,
+                      "is_sniper_bullet_in_area %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_037f>(0x037f, 0, "give_player_detonator");
+    bind<opcode_0381>(0x0381, 4, "throw_object %1d% distance %2d% %3d% %4d%");
+    bind<opcode_0382>(0x0382, 2, "set_object %1d% collision_detection %2d%");
+    bind<opcode_0383>(0x0383, 1, "player %1d% car_horn_activated");
+    bind<opcode_0384>(0x0384, 4,
+                      "text_1string %1g% string %2g% duration %3d% ms flag %4d%");
+    bind<opcode_0385>(0x0385, 4,
+                      "text_1string_lowpriority %1g% string %2g% duration %3d% ms flag %4d%");
+    bind<opcode_0386>(0x0386, 6,
+                      "text_payphone_4strings_repeatedly %1d% %2g% %3g% %4g% %5g% %6g%");
+    bind<opcode_0387>(0x0387, 6,
+                      "text_payphone_4strings %1d% %2g% %3g% %4g% %5g% %6g%");
+    bind<opcode_0388>(0x0388, 7,
+                      "text_payphone_5strings_repeatedly %1d% %2g% %3g% %4g% %5g% %6g% %7g%");
+    bind<opcode_0389>(0x0389, 7,
+                      "text_payphone_5strings %1d% %2g% %3g% %4g% %5g% %6g% %7g%");
+    bind<opcode_038a>(0x038a, 6,
+                      "car_in_cube %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_038b>(0x038b, 0, "load_all_models_now");
+    bind<opcode_038c>(0x038c, 4, "object %1d% scatter %2d% %3d% %4d%");
+    bind<opcode_038d>(0x038d, 9,
+                      "draw_texture %1h% position %2d% %3d% size %4d% %5d% RGBA %6d% %7d% %8d% %9d%");
+    bind<opcode_038f>(0x038f, 2, "load_texture %2h% as %1d%");
+    bind<opcode_0390>(0x0390, 1, "load_txd_dictionary %1h%");
+    bind<opcode_0391>(0x0391, 0, "release_textures");
+    bind<opcode_0392>(0x0392, 2, "object %1d% toggle_in_moving_list %2d%");
+    bind<opcode_0394>(0x0394, 1, "play_mission_passed_music %1d%");
+    bind<opcode_0395>(0x0395, 5,
+                      "clear_area %5d% at %1d% %2d% range %3d% %4d%");
+    bind<opcode_0396>(0x0396, 1, "pause_timer %1d%");
+    bind<opcode_0397>(0x0397, 2, "car %1d% siren = %2b:on/off%");
+    bind<opcode_0398>(0x0398, 7,
+                      "remove_forbidden_for_peds_angled_cube %1d% %2d% %3d% to %4d% %5d% %6d% angle %7d%");
+    bind<opcode_0399>(0x0399, 7,
+                      "create_forbidden_for_peds_angled_cube %1d% %2d% %3d% to %4d% %5d% %6d% angle %7d%");
+    bind<opcode_039a>(0x039a, 7,
+                      "remove_forbidden_for_cars_angled_cube %1d% %2d% %3d% to %4d% %5d% %6d% angle %7d%");
+    bind<opcode_039b>(0x039b, 7,
+                      "create_forbidden_for_cars_angled_cube %1d% %2d% %3d% to %4d% %5d% %6d% angle %7d%");
+    bind<opcode_039c>(0x039c, 2, "set_car %1d% watertight %2h%");
+    bind<opcode_039d>(0x039d, 12,
+                      "scatter_particles type %1a% %8d% %9d% %10d% %11d% %12d% from %2d% %3d% %4d% to %5d% %6d% %7d%");
+    bind<opcode_039e>(0x039e, 2, "set_char_cant_be_dragged_out %1d% to %2d%");
+    bind<opcode_039f>(0x039f, 3, "turn_car %1d% to_face %2d% %3d%");
+    bind<opcode_03a0>(0x03a0, 3, "car %3d% picked_up_by_crane %1d% %2d%");
+    bind<opcode_03a1>(0x03a1, 4,
+                      "unknown_clear_point %1d% %2d% %3d% radius %4d%");
+    bind<opcode_03a2>(0x03a2, 2, "set_car_status %1d% to %2h%");
+    bind<opcode_03a3>(0x03a3, 1, "is_char_male %1d%");
+    bind<opcode_03a4>(0x03a4, 1, "name_thread %1s%");
+    bind<opcode_03a5>(0x03a5, 3, "set_garage %1d% type_to %2d% %3d%");
+    bind<opcode_03a6>(0x03a6, 3, "get_drug_plane_coords %1d% %2d% %3d%");
+    bind<opcode_03aa>(0x03aa, 3, "play_suspect_last_seen_at %1d% %2d% %3d%");
+    bind<opcode_03ab>(0x03ab, 2, "set_car %1d% strong %2d%");
+    bind<opcode_03ac>(0x03ac, 1, "clear_route %1d%");
+    bind<opcode_03ad>(0x03ad, 1, "set_rubbish %1b:visible/invisible%");
+    bind<opcode_03ae>(0x03ae, 6,
+                      "remove_objects_from_cube %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_03af>(0x03af, 1, "set_streaming %1b:enabled/disabled%");
+    bind<opcode_03b0>(0x03b0, 1, "garage %1d% door_open");
+    bind<opcode_03b1>(0x03b1, 1, "garage %1d% door_closed");
+    bind<opcode_03b2>(0x03b2, 0, "start_catalina_flyby");
+    bind<opcode_03b3>(0x03b3, 0, "catalina_take_off");
+    bind<opcode_03b4>(0x03b4, 0, "remove_catalina_heli");
+    bind<opcode_03b5>(0x03b5, 0, "catalina_shot_down");
+    bind<opcode_03b6>(0x03b6, 6,
+                      "replace_model_at %1d% %2d% %3d% radius %4d% from %5o% to %6o%");
+    bind<opcode_03b7>(0x03b7, 1, "process_cut_scene_only %1b:false/true%");
+    bind<opcode_03b8>(0x03b8, 1, "clear_weapons_from_player %1d%");
+    bind<opcode_03b9>(0x03b9, 1, "create_catalinas_chopper %1d%");
+    bind<opcode_03ba>(0x03ba, 6,
+                      "clear_cars_from_cube %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_03bb>(0x03bb, 1, "set_garage %1d% door_type_to_swing_open");
+    bind<opcode_03bc>(0x03bc, 5,
+                      "%5d% = create_sphere_at %1d% %2d% %3d% radius %4d%");
+    bind<opcode_03bd>(0x03bd, 1, "destroy_sphere %1d%");
+    bind<opcode_03be>(0x03be, 0, "catalina_heli_drop_explosives_on_player");
+    bind<opcode_03bf>(0x03bf, 2,
+                      "set_player %1d% ignored_by_everyone_to %2b:true/false%");
+    bind<opcode_03c0>(0x03c0, 2, "%2d% = actor %1d% car");
+    bind<opcode_03c1>(0x03c1, 2, "%2d% = player %1d% car_no_save");
+    bind<opcode_03c2>(0x03c2, 1, "payphone %1d% answered");
+    bind<opcode_03c3>(0x03c3, 3,
+                      "set_timer_with_text_to %1d% type %2h% text %3g%");
+    bind<opcode_03c4>(0x03c4, 3,
+                      "set_status_text_to %1d% %2b:bar/number% %3g%");
+    bind<opcode_03c5>(0x03c5, 4,
+                      "create_random_car_for_carpark %1d% %2d% %3d% %4d%");
+    bind<opcode_03c6>(0x03c6, 1, "current_island == %1d%");
+    bind<opcode_03c7>(0x03c7, 1, "set_sensitivity_to_crime_to %1d%");
+    bind<opcode_03c8>(0x03c8, 0, "set_camera_directly_before_player");
+    bind<opcode_03c9>(0x03c9, 1, "car %1d% damaged");
+    bind<opcode_03ca>(0x03ca, 1, "object %1d% exists");
+    bind<opcode_03cb>(0x03cb, 3, "load_scene %1d% %2d% %3d%");
+    bind<opcode_03cc>(0x03cc, 3, "car %1d% add_to_stuck_car_check %2d% = %3d%");
+    bind<opcode_03cd>(0x03cd, 1, "car %1d% remove_from_stuck_car_check");
+    bind<opcode_03ce>(0x03ce, 1, "car %1d% stuck");
+    bind<opcode_03cf>(0x03cf, 1, "load_wav %1s%");
+    bind<opcode_03d0>(0x03d0, 0, "wav_loaded");
+    bind<opcode_03d1>(0x03d1, 0, "play_wav");
+    bind<opcode_03d2>(0x03d2, 0, "wav_ended");
+    bind<opcode_03d3>(0x03d3, 7,
+                      "get_closest_car_node_at %1d% %2d% %3d% store_to %4d% %5d% %6d% heading %7d%");
+    bind<opcode_03d4>(0x03d4, 2, "garage %1d% contains_neededcar %2d%");
+    bind<opcode_03d5>(0x03d5, 1, "remove_text %1g%");
+    bind<opcode_03d6>(0x03d6, 1, "remove_styled_text %1g%");
+    bind<opcode_03d7>(0x03d7, 3, "set_wav_location %1d% %2d% %3d%");
+    bind<opcode_03d8>(0x03d8, 0, "show_save_screen");
+    bind<opcode_03d9>(0x03d9, 0, "save_done");
+    bind<opcode_03da>(0x03da, 1, "set_garage %1d% camera_follows_player");
+    bind<opcode_03dc>(0x03dc, 2, "%2d% = create_marker_above_pickup %1d%");
+    bind<opcode_03dd>(0x03dd, 3, "pickup %1d% show_on_radar %2d% %3d%");
+    bind<opcode_03de>(0x03de, 1, "set_ped_density_multiplier %1d%");
+    bind<opcode_03df>(0x03df, 1, "all_random_peds %1o%");
+    bind<opcode_03e0>(0x03e0, 1, "set_text_draw_before_fade %1h%");
+    bind<opcode_03e1>(0x03e1, 1, "%1d% = packages_found");
+    bind<opcode_03e2>(0x03e2, 1, "save_turismo_time %1d%");
+    bind<opcode_03e3>(0x03e3, 1, "set_sprites_draw_before_fade %1h%");
+    bind<opcode_03e4>(0x03e4, 1, "set_text_draw_align_right %1h%");
+    bind<opcode_03e5>(0x03e5, 1, "text_box %1g%");
+    bind<opcode_03e6>(0x03e6, 0, "remove_text_box");
+    bind<opcode_03e7>(0x03e7, 1, "flash_hud %1d%");
+    bind<opcode_03ea>(0x03ea, 1, "generate_cars_around_camera %1d%");
+    bind<opcode_03eb>(0x03eb, 0, "clear_small_messages_only");
+    bind<opcode_03ec>(0x03ec, 0, "ev_crane_collected_all_cars");
+    bind<opcode_03ed>(0x03ed, 2,
+                      "set_car %1d% not_damaged_when_upside_down %2h%");
+    bind<opcode_03ee>(0x03ee, 1, "player %1d% controllable");
+    bind<opcode_03ef>(0x03ef, 1, "player %1d% make_safe");
+    bind<opcode_03f0>(0x03f0, 1, "enable_text_draw %1d%");
+    bind<opcode_03f1>(0x03f1, 2, "pedtype %1e% add_threat %2e%");
+    bind<opcode_03f2>(0x03f2, 2, "pedgroup %1e% remove_threat %2e%");
+    bind<opcode_03f3>(0x03f3, 3, "get_car %1d% color %2d% %3d%");
+    bind<opcode_03f4>(0x03f4, 1, "set_all_cars_can_be_damaged %1b:true/false%");
+    bind<opcode_03f5>(0x03f5, 2, "set_car %1d% can_be_damaged %1b:true/false%");
+    bind<opcode_03f7>(0x03f7, 1, "load_island_data %1d%");
+    bind<opcode_03f8>(0x03f8, 1, "get_body_cast_health %1d%");
+    bind<opcode_03f9>(0x03f9, 3, "make_actors %1d% %2d% converse_in %3d% ms");
+    bind<opcode_03fb>(0x03fb, 2, "set_car %1d% stays_on_current_island %2d%");
+    bind<opcode_03fc>(0x03fc, 2, "set_actor %1d% stays_on_current_island %2d%");
+    bind<opcode_03fd>(0x03fd, 1, "save_offroad_time %1d%");
+    bind<opcode_03fe>(0x03fe, 1, "save_offroadII_time %1d%");
+    bind<opcode_03ff>(0x03ff, 1, "save_offroadIII_time %1d%");
+    bind<opcode_0400>(0x0400, 1, "save_mayhem_time %1d%");
+    bind<opcode_0401>(0x0401, 0, "increment_people_saved_in_ambulance");
+    bind<opcode_0402>(0x0402, 0, "increment_criminals_stopped");
+    bind<opcode_0403>(0x0403, 1, "save_highest_ambulance_level %1d%");
+    bind<opcode_0404>(0x0404, 0, "increment_fires_extinguished");
+    bind<opcode_0405>(0x0405, 1, "enable_payphone %1d%");
+    bind<opcode_0406>(0x0406, 1, "save_dodo_flight_time %1d%");
+    bind<opcode_0407>(0x0407, 1, "time_taken_defuse_mission = %1d%");
+    bind<opcode_0408>(0x0408, 1, "set_total_rampages_to %1d%");
+    bind<opcode_0409>(0x0409, 0, "blow_up_rc_buggy");
+    bind<opcode_040a>(0x040a, 1, "remove_car_from_chase %1d%");
+    bind<opcode_040b>(0x040b, 0, "is_french_game");
+    bind<opcode_040c>(0x040c, 0, "is_german_game");
+    bind<opcode_040d>(0x040d, 0, "clear_mission_audio");
+    bind<opcode_040e>(0x040e, 1, "%1b:set/clear% FadeInAfterNextArrest");
+    bind<opcode_040f>(0x040f, 1, "%1b:set/clear% FadeInAfterNextDeath");
+    bind<opcode_0410>(0x0410, 2, "override_gang_model %1d% %2d%");
+    bind<opcode_0411>(0x0411, 2,
+                      "set_actor %1d% use_pednode_seek %2d:true/false%");
+    bind<opcode_0412>(0x0412, 2, "");
+    bind<opcode_0413>(0x0413, 2, "enable %1d% get_out_of_jail_free %2d%");
+    bind<opcode_0414>(0x0414, 2, "toggle_player %1d% free_treatment_once %2d%");
+    bind<opcode_0415>(0x0415, 2, "");
+    bind<opcode_0417>(0x0417, 1, "start_mission %1d%");
+    bind<opcode_0418>(0x0418, 2, "set_object %1d% draw_last %2h%");
+    bind<opcode_0419>(0x0419, 3,
+                      "get_ammo_of_player %1d% weapon %2c% store_to %3d%");
+    bind<opcode_041a>(0x041a, 3,
+                      "get_ammo_of_actor %1d% weapon %2c% store_to %3d%");
+    bind<opcode_041c>(0x041c, 2, "make_actor %1d% say %2d%");
+    bind<opcode_041d>(0x041d, 1, "set_camera_near_clip %1d%");
+    bind<opcode_041e>(0x041e, 2, "set_radio_station %1d% %2d%");
+    bind<opcode_041f>(0x041f, 1, "override_hospital %1d%");
+    bind<opcode_0420>(0x0420, 1, "override_police_station %1d%");
+    bind<opcode_0421>(0x0421, 1, "force_rain %1d%");
+    bind<opcode_0422>(0x0422, 2, "garage_contain_car %1d% %2d%");
+    bind<opcode_0423>(0x0423, 2, "car %1d% improve_handling %2d%");
+    bind<opcode_0424>(0x0424, 0, "metric");
+    bind<opcode_0425>(0x0425, 2, "%2d% = meters_to_feet %1d%");
+    bind<opcode_0426>(0x0426, 6,
+                      "create_save_cars_between_levels_cube %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_0427>(0x0427, 6,
+                      "create_save_peds_between_levels_cube %1d% %2d% %3d% to %4d% %5d% %6d%");
+    bind<opcode_0428>(0x0428, 2, "set_car %1d% avoid_level_transitions %2d%");
+    bind<opcode_042a>(0x042a, 2, "ped_threat_exists %1u% %2u%");
+    bind<opcode_042b>(0x042b, 6,
+                      "clear_peds_from_cube %1d% %2d% %3d% %4d% %5d% %6d%");
+    bind<opcode_042c>(0x042c, 1, "set_total_missions_to %1d%");
+    bind<opcode_042d>(0x042d, 2, "%2d% = round(meters_to_feet(%1d%))");
+    bind<opcode_042e>(0x042e, 2, "register_lowest_int_stat %1h% to %2d%");
+    bind<opcode_042f>(0x042f, 2, "save_record %1d% %2d%");
+    bind<opcode_0431>(0x0431, 2, "car %1d% passenger_seat_free %2d%");
+    bind<opcode_0432>(0x0432, 3, "%3d% = get_passenger_in_car %1d% seat %2h%");
+    bind<opcode_0433>(0x0433, 2, "set_actor %1d% criminal_flag %2h%");
+    bind<opcode_0434>(0x0434, 0, "show_credits");
+    bind<opcode_0435>(0x0435, 0, "end_credits");
+    bind<opcode_0436>(0x0436, 0, "reached_end_of_credits");
+    bind<opcode_0437>(0x0437, 8,
+                      "scatter_particle %1a% %8d% at %2d% %3d% %4d% to %5d% %6d% %7d%");
+    bind<opcode_0438>(0x0438, 2,
+                      "set_actor %1d% ignore_level_transitions %2d%");
+    bind<opcode_043a>(0x043a, 0, "start_boat_foam_animation");
+    bind<opcode_043b>(0x043b, 1, "update_boat %1d% foam_animation");
+    bind<opcode_043c>(0x043c, 1, "set_game_sounds_fade %1d%");
+    bind<opcode_043d>(0x043d, 1, "set_intro_is_playing %1d%");
+    bind<opcode_043f>(0x043f, 0, "play_cutscene_music");
+    bind<opcode_0440>(0x0440, 0, "stop_cutscene_music");
+    bind<opcode_0441>(0x0441, 2, "%2d% = car %1d% model");
+    bind<opcode_0442>(0x0442, 2, "player %1d% in_car %2d%");
+    bind<opcode_0443>(0x0443, 1, "player %1d% in_a_car");
+    bind<opcode_0444>(0x0444, 2, "create_fire_audio %1d% %2d%");
+    bind<opcode_0445>(0x0445, 0, "are_any_car_cheats_activated");
+    bind<opcode_0446>(0x0446, 2, "set_actor %1d% dismemberment_possible %2d%");
+    bind<opcode_0447>(0x0447, 1, "is_player_lifting_a_payphone %1d%");
+    bind<opcode_0448>(0x0448, 2, "actor %1d% in_car %2d%");
+    bind<opcode_0449>(0x0449, 1, "actor %1d% in_a_car");
+    bind<opcode_044a>(0x044a, 1, "player %1d% on_foot");
+    bind<opcode_044b>(0x044b, 1, "is_char_on_foot %1d%");
+    bind<opcode_044c>(0x044c, 1, "change_to_island %1d%");
+    bind<opcode_044d>(0x044d, 1, "load_splash %1x%");
+    bind<opcode_044e>(0x044e, 2, "car %1d% level %2b:set_from_position/clear%");
+    bind<opcode_044f>(0x044f, 2, "make_craigs_car_a_bit_stronger %1d% %2d%");
+    bind<opcode_0450>(0x0450, 1, "car %1d% warp_to_player");
+    bind<opcode_0451>(0x0451, 0, "load_end_of_game_audio");
+    bind<opcode_0452>(0x0452, 0, "enable_player_control_camera");
+    bind<opcode_0453>(0x0453, 4, "object %1d% set_rotation %2d% %3d% %4d%");
+    bind<opcode_0454>(0x0454, 3,
+                      "store_debug_camera_position_to %1d% %2d% %3d%");
+    bind<opcode_0455>(0x0455, 3, "");
+    bind<opcode_0456>(0x0456, 1, "is_player_targeting_any_char %1d%");
+    bind<opcode_0457>(0x0457, 2, "is_player_targeting_char %1d% %2d%");
+    bind<opcode_0458>(0x0458, 2, "is_player_targeting_object %1d% %1d%");
+    bind<opcode_0459>(0x0459, 1, "end_threads_named %1s%");
+    bind<opcode_045b>(0x045b, 5,
+                      "text_draw_2numbers %3g% numbers %4d% %5d% at %1d% %2d%");
+    bind<opcode_0463>(0x0463, 3, "get_debug_camera_point_at %1d% %2d% %3d%");
+    bind<opcode_0477>(0x0477, 3, "set_car_temp_action %1d% to %2h% time %3d%");
+    bind<opcode_0494>(0x0494, 5,
+                      "get_joystick %1h% direction_offset_to %2d% %3d% %4d% %5d%");
 }
@@ -6014,7 +6014,7 @@ void opcode_0211(const ScriptArguments& args, const ScriptCharacter character, S
     }
 
     character->controller->setNextActivity(
-            std::make_unique<ai::Activities::GoTo>(target));
+            std::make_unique<ai::Activities::GoTo>(target, false, true));
 }
 
 /**
@@ -6439,7 +6439,7 @@ void opcode_0237(const ScriptArguments& args, const ScriptGang gangID, const Scr
 void opcode_0239(const ScriptArguments& args, const ScriptCharacter character, ScriptVec2 coord) {
     auto target = script::getGround(args, glm::vec3(coord, -100.f));
     character->controller->setNextActivity(
-            std::make_unique<ai::Activities::GoTo>(target, true));
+            std::make_unique<ai::Activities::GoTo>(target, true, true));
 }
 
 /**
@@ -10900,8 +10900,8 @@ void opcode_03b6(const ScriptArguments& args, ScriptVec3 coord, const ScriptFloa
 
     for(auto& p : args.getWorld()->instancePool.objects) {
         auto o = p.second.get();
-    	if( !o->getClump() ) continue;
-    	if( o->getModelInfo<BaseModelInfo>()->name != oldmodel ) continue;
+    	auto modelinfo = o->getModelInfo<BaseModelInfo>();
+    	if( !modelinfo || modelinfo->name != oldmodel ) continue;
     	float d = glm::distance(coord, o->getPosition());
     	if( d < radius ) {
     		InstanceObject* inst = static_cast<InstanceObject*>(o);
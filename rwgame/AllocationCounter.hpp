@@ -0,0 +1,12 @@
+#ifndef RWGAME_ALLOCATIONCOUNTER_HPP
+#define RWGAME_ALLOCATIONCOUNTER_HPP
+
+#include <cstdint>
+
+/**
+ * @return The number of times operator new has been called by any thread
+ * since the game started
+ */
+std::uint64_t getAllocationCount();
+
+#endif
@@ -19,11 +19,13 @@ GameBase::GameBase(Logger &inlog, const std::optional<RWArgConfigLayer> &args) :
 
     bool fullscreen = config.fullscreen();
     size_t w = config.width(), h = config.height();
+    bool headless = args.has_value() && args->headless;
 
     if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_TIMER) < 0)
         throw std::runtime_error("Failed to initialize SDL2!");
 
-    window.create(kWindowTitle + " [" + kBuildStr + "]", w, h, fullscreen);
+    window.create(kWindowTitle + " [" + kBuildStr + "]", w, h, fullscreen,
+                  !headless);
 
     SET_RW_ABORT_CB([this]() {window.showCursor();},
             [this]() {window.hideCursor();});
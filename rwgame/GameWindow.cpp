@@ -6,7 +6,7 @@
 #include <SDL_mouse.h>
 
 void GameWindow::create(const std::string& title, size_t w, size_t h,
-                        bool fullscreen) {
+                        bool fullscreen, bool visible) {
     Uint32 style = SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE | SDL_WINDOW_HIDDEN;
     if (fullscreen) style |= SDL_WINDOW_FULLSCREEN;
 
@@ -56,7 +56,9 @@ void GameWindow::create(const std::string& title, size_t w, size_t h,
         rmask, gmask, bmask, amask);
     SDL_SetWindowIcon(window, icon);
 
-    SDL_ShowWindow(window);
+    if (visible) {
+        SDL_ShowWindow(window);
+    }
 }
 
 void GameWindow::close() {
@@ -16,7 +16,12 @@ class GameWindow {
 public:
     GameWindow() = default;
 
-    void create(const std::string& title, size_t w, size_t h, bool fullscreen);
+    /**
+     * Creates the window and its GL context. Hidden windows still have a
+     * context, for loading resources without presenting anything.
+     */
+    void create(const std::string& title, size_t w, size_t h, bool fullscreen,
+                bool visible = true);
     void close();
 
     void showCursor();
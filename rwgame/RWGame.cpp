@@ -11,8 +11,11 @@
 #include "states/LoadingState.hpp"
 #include "states/MenuState.hpp"
 
+#include <core/JobPool.hpp>
 #include <core/Profiler.hpp>
 
+#include <render/NullRenderer.hpp>
+
 #include <engine/Payphone.hpp>
 #include <engine/SaveGame.hpp>
 #include <objects/GameObject.hpp>
@@ -26,6 +29,7 @@
 #include <objects/VehicleObject.hpp>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
 #include <functional>
 #include <iomanip>
 #include <iostream>
@@ -47,6 +51,15 @@ static constexpr std::array<
                     {GameRenderer::Arrow, "arrow.dff", ""}}};
 
 constexpr float kMaxPhysicsSubSteps = 2;
+
+std::unique_ptr<Renderer> createRenderer(
+    const std::optional<RWArgConfigLayer>& args) {
+    // Headless runs go through the whole frame without drawing it
+    if (args.has_value() && args->headless) {
+        return std::make_unique<NullRenderer>();
+    }
+    return std::make_unique<OpenGLRenderer>();
+}
 }  // namespace
 
 #define MOUSE_SENSITIVITY_SCALE 2.5f
@@ -54,7 +67,7 @@ constexpr float kMaxPhysicsSubSteps = 2;
 RWGame::RWGame(Logger& log, const std::optional<RWArgConfigLayer> &args)
     : GameBase(log, args)
     , data(&log, config.gamedataPath())
-    , renderer(&log, &data)
+    , renderer(&log, &data, createRenderer(args))
     , imgui(*this) {
     RW_PROFILE_THREAD("Main");
     RW_TIMELINE_ENTER("Startup", MP_YELLOW);
@@ -63,11 +76,14 @@ RWGame::RWGame(Logger& log, const std::optional<RWArgConfigLayer> &args)
     bool test = false;
     std::optional<std::string> startSave;
     std::optional<std::string> benchFile;
+    std::optional<std::string> benchOutput;
     if (args.has_value()) {
         newgame = args->newGame;
         test = args->test;
         startSave = args->loadGamePath;
         benchFile = args->benchmarkPath;
+        benchOutput = args->benchmarkOutput;
+        headless = args->headless;
     }
 
     log.info("Game", "Game directory: " + config.gamedataPath());
@@ -80,6 +96,9 @@ RWGame::RWGame(Logger& log, const std::optional<RWArgConfigLayer> &args)
     imgui.init();
 
     data.load();
+    data.residency.setBudget(
+        static_cast<std::size_t>(std::max(config.modelBudget(), 0)) * 1024 *
+        1024);
 
     for (const auto& [specialModel, fileName, name] : kSpecialModels) {
         auto model = data.loadClump(fileName, name);
@@ -93,6 +112,12 @@ RWGame::RWGame(Logger& log, const std::optional<RWArgConfigLayer> &args)
 
     hudDrawer.applyHUDScale(config.hudScale());
     renderer.map.scaleHUD(config.hudScale());
+    renderer.setRenderListThreads(
+        static_cast<unsigned int>(std::max(config.renderThreads(), 0)));
+    if (config.animationThreads() != 1) {
+        animationJobs = std::make_unique<JobPool>(
+            static_cast<unsigned int>(std::max(config.animationThreads(), 0)));
+    }
 
     debug.setDebugMode(btIDebugDraw::DBG_DrawWireframe |
                        btIDebugDraw::DBG_DrawConstraints |
@@ -115,7 +140,7 @@ RWGame::RWGame(Logger& log, const std::optional<RWArgConfigLayer> &args)
 
     stateManager.enter<LoadingState>(this, [=]() {
         if (benchFile.has_value()) {
-            stateManager.enter<BenchmarkState>(this, *benchFile);
+            stateManager.enter<BenchmarkState>(this, *benchFile, benchOutput);
         } else if (test) {
             stateManager.enter<IngameState>(this, true, "test");
         } else if (newgame) {
@@ -147,10 +172,12 @@ void RWGame::newGame() {
     state.world = world.get();
     world->state = &state;
 
+    std::vector<std::string> ipls;
     for (auto ipl : world->data->iplLocations) {
         world->data->loadZone(ipl.second);
-        world->placeItems(ipl.second);
+        ipls.push_back(ipl.second);
     }
+    world->placeItems(ipls);
 }
 
 bool RWGame::hitWorldRay(glm::vec3 &hit, glm::vec3 &normal, GameObject **object) {
@@ -428,6 +455,12 @@ int RWGame::run() {
             chrono::duration<float>(currentFrame - lastFrame).count();
         lastFrame = currentFrame;
 
+        // Without a display to keep up with, step exactly one tick a frame
+        // so that runs are repeatable
+        if (headless) {
+            frameTime = deltaTime;
+        }
+
         if (!world->isPaused()) {
             accumulatedTime += frameTime;
 
@@ -439,9 +472,13 @@ int RWGame::run() {
             accumulatedTime = tickWorld(deltaTime, accumulatedTime);
         }
 
-        render(1, frameTime);
+        if (headless) {
+            renderHeadless(1);
+        } else {
+            render(1, frameTime);
 
-        getWindow().swap();
+            getWindow().swap();
+        }
 
         // Make sure the topmost state is the correct state
         stateManager.updateStack();
@@ -606,6 +643,7 @@ void RWGame::tick(float dt) {
 void RWGame::tickObjects(float dt) const {
     RW_PROFILE_SCOPEC(__func__, MP_MAGENTA1);
     world->updateEffects();
+    world->prepareAnimations(dt, animationJobs.get());
 
     {
         RW_PROFILE_SCOPEC("allObjects", MP_HOTPINK1);
@@ -641,6 +679,22 @@ void RWGame::render(float alpha, float time) {
     getRenderer().getRenderer().swap();
     imgui.startFrame();
 
+    auto viewCam = renderFrame(alpha, true);
+
+    imgui.endFrame(viewCam);
+}
+
+void RWGame::renderHeadless(float alpha) {
+    RW_PROFILE_SCOPE(__func__);
+
+    lastDraws = getRenderer().getRenderer().getDrawCount();
+
+    getRenderer().getRenderer().swap();
+
+    renderFrame(alpha, false);
+}
+
+ViewCamera RWGame::renderFrame(float alpha, bool debugViews) {
     // Update the camera
     if (!stateManager.states.empty()) {
         currentCam = stateManager.states.back()->getCamera(alpha);
@@ -660,8 +714,10 @@ void RWGame::render(float alpha, float time) {
 
     world->sound.updateListenerTransform(viewCam);
 
-    glEnable(GL_DEPTH_TEST);
-    glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT);
+    world->data->streamer.update(viewCam.position);
+    world->data->residency.update();
+
+    renderer.getRenderer().clear(glm::vec4(0.f, 0.f, 0.f, 1.f));
 
     renderer.getRenderer().pushDebugGroup("World");
 
@@ -669,7 +725,9 @@ void RWGame::render(float alpha, float time) {
 
     renderer.getRenderer().popDebugGroup();
 
-    renderDebugView();
+    if (debugViews) {
+        renderDebugView();
+    }
 
     if (!world->isPaused()) hudDrawer.drawOnScreenText(world.get(), renderer);
 
@@ -678,7 +736,7 @@ void RWGame::render(float alpha, float time) {
         stateManager.draw(renderer);
     }
 
-    imgui.endFrame(viewCam);
+    return viewCam;
 }
 
 void RWGame::renderDebugView() {
@@ -21,6 +21,8 @@
 
 #include <chrono>
 
+class JobPool;
+
 class RWGame final : public GameBase {
 public:
     enum class DebugViewMode {
@@ -41,6 +43,9 @@ private:
 
     std::unique_ptr<GameWorld> world;
 
+    /// Threads posing animated objects, if they aren't posed sequentially
+    std::unique_ptr<JobPool> animationJobs;
+
     GTA3Module opcodes;
     std::unique_ptr<ScriptMachine> vm;
     SCMFile script;
@@ -48,6 +53,8 @@ private:
     StateManager stateManager;
 
     bool inFocus = true;
+    /// Steps one tick per frame and only builds the render list
+    bool headless = false;
     ViewCamera currentCam;
 
     DebugViewMode debugview_ = DebugViewMode::Disabled;
@@ -111,6 +118,10 @@ public:
         return inFocus;
     }
 
+    bool isHeadless() const {
+        return headless;
+    }
+
     void saveGame(const std::string& savename);
     void loadGame(const std::string& savename);
 
@@ -118,6 +129,18 @@ private:
     void tick(float dt);
     void render(float alpha, float dt);
 
+    /// Renders the frame through the null renderer, without the debug views
+    /// and UI
+    void renderHeadless(float alpha);
+
+    /**
+     * Draws the world, HUD and game state for the frame
+     *
+     * @param debugViews Whether to draw the selected debug view
+     * @return The camera the frame was drawn with
+     */
+    ViewCamera renderFrame(float alpha, bool debugViews);
+
     void renderDebugPaths();
 
     void handleCheatInput(char symbol);
@@ -1,14 +1,53 @@
 #include "BenchmarkState.hpp"
 #include <engine/GameState.hpp>
+#include <render/NullRenderer.hpp>
+#include "AllocationCounter.hpp"
 #include "RWGame.hpp"
 
 #include <glm/gtc/quaternion.hpp>
 
+#include <algorithm>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 
-BenchmarkState::BenchmarkState(RWGame* game, const std::string& benchfile)
-    : State(game), benchfile(benchfile) {
+namespace {
+/// The renderer of a headless run, if this is one
+NullRenderer* getNullRenderer(RWGame* game) {
+    return dynamic_cast<NullRenderer*>(&game->getRenderer().getRenderer());
+}
+
+double toMilliseconds(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::milli>(time).count();
+}
+
+std::string jsonString(const std::string& str) {
+    std::ostringstream oss;
+    oss << '"';
+    for (char c : str) {
+        switch (c) {
+            case '"':
+                oss << "\\\"";
+                break;
+            case '\\':
+                oss << "\\\\";
+                break;
+            case '\n':
+                oss << "\\n";
+                break;
+            default:
+                oss << c;
+        }
+    }
+    oss << '"';
+    return oss.str();
+}
+}  // namespace
+
+BenchmarkState::BenchmarkState(RWGame* game, const std::string& benchfile,
+                               const std::optional<std::string>& outputPath)
+    : State(game), benchfile(benchfile), outputPath(outputPath) {
 }
 
 void BenchmarkState::enter() {
@@ -57,16 +96,119 @@ void BenchmarkState::enter() {
     }
 
     std::cout << "Loaded " << track.size() << " points" << '\n';
+
+    if (auto nullRenderer = getNullRenderer(game)) {
+        nullRenderer->resetStatistics();
+    }
+    scopeTimings.install();
 }
 
 void BenchmarkState::exit() {
+    scopeTimings.uninstall();
+
+    auto sortedTimes = frameTimes;
+    std::sort(sortedTimes.begin(), sortedTimes.end());
+
     std::cout << "Results =============\n"
               << "Benchmark: " << benchfile << "\n"
               << "Frames: " << frameCounter << "\n"
               << "Duration: " << duration << " seconds\n"
               << "Avg frametime: " << std::setprecision(3)
               << (duration / frameCounter) << " (" << (frameCounter / duration)
-              << " fps)" << '\n';
+              << " fps)" << '\n'
+              << "Frametime p50/p95/p99: "
+              << toMilliseconds(percentile(sortedTimes, 50.f)) << " / "
+              << toMilliseconds(percentile(sortedTimes, 95.f)) << " / "
+              << toMilliseconds(percentile(sortedTimes, 99.f)) << " ms"
+              << '\n';
+
+    if (outputPath) {
+        std::ofstream out(*outputPath);
+        if (!out) {
+            std::cerr << "Could not write benchmark results to " << *outputPath
+                      << '\n';
+            return;
+        }
+        writeResults(out);
+    }
+}
+
+void BenchmarkState::writeResults(std::ostream& out) const {
+    auto sortedTimes = frameTimes;
+    std::sort(sortedTimes.begin(), sortedTimes.end());
+    auto sortedAllocations = frameAllocations;
+    std::sort(sortedAllocations.begin(), sortedAllocations.end());
+
+    std::chrono::nanoseconds totalTime{};
+    for (auto time : frameTimes) {
+        totalTime += time;
+    }
+    uint64_t totalAllocations = 0;
+    for (auto allocations : frameAllocations) {
+        totalAllocations += allocations;
+    }
+    const auto frames = std::max<std::size_t>(frameTimes.size(), 1);
+
+    out << std::fixed << std::setprecision(4);
+    out << "{\n"
+        << "  \"benchmark\": " << jsonString(benchfile) << ",\n"
+        << "  \"headless\": " << (game->isHeadless() ? "true" : "false")
+        << ",\n"
+        << "  \"frames\": " << frameTimes.size() << ",\n"
+        << "  \"duration\": " << duration << ",\n";
+
+    out << "  \"frametime_ms\": {\n"
+        << "    \"mean\": " << toMilliseconds(totalTime) / frames << ",\n"
+        << "    \"p50\": " << toMilliseconds(percentile(sortedTimes, 50.f))
+        << ",\n"
+        << "    \"p95\": " << toMilliseconds(percentile(sortedTimes, 95.f))
+        << ",\n"
+        << "    \"p99\": " << toMilliseconds(percentile(sortedTimes, 99.f))
+        << ",\n"
+        << "    \"max\": "
+        << toMilliseconds(sortedTimes.empty() ? std::chrono::nanoseconds{}
+                                              : sortedTimes.back())
+        << "\n  },\n";
+
+    out << "  \"allocations\": {\n"
+        << "    \"total\": " << totalAllocations << ",\n"
+        << "    \"mean\": " << double(totalAllocations) / frames << ",\n"
+        << "    \"p50\": " << percentile(sortedAllocations, 50.f) << ",\n"
+        << "    \"p95\": " << percentile(sortedAllocations, 95.f) << ",\n"
+        << "    \"p99\": " << percentile(sortedAllocations, 99.f) << "\n"
+        << "  },\n";
+
+    // What a headless run asked the renderer to do, per frame
+    if (auto nullRenderer = getNullRenderer(game)) {
+        const auto& stats = nullRenderer->getStatistics();
+        const auto perFrame = [&](std::uint64_t count) {
+            return double(count) / frames;
+        };
+        out << "  \"renderer\": {\n"
+            << "    \"draws\": " << perFrame(stats.draws) << ",\n"
+            << "    \"primitives\": " << perFrame(stats.primitives) << ",\n"
+            << "    \"programs\": " << perFrame(stats.programs) << ",\n"
+            << "    \"uniforms\": " << perFrame(stats.uniforms) << ",\n"
+            << "    \"textures\": " << perFrame(stats.textures) << ",\n"
+            << "    \"buffers\": " << perFrame(stats.buffers) << ",\n"
+            << "    \"uploads\": " << perFrame(stats.uploads) << ",\n"
+            << "    \"states\": " << perFrame(stats.states) << "\n"
+            << "  },\n";
+    }
+
+    // Inclusive time spent in each profiled scope on the main thread
+    out << "  \"scopes\": [";
+    const auto scopes = scopeTimings.getScopes();
+    for (auto i = 0u; i < scopes.size(); ++i) {
+        const auto& scope = scopes[i];
+        out << (i == 0 ? "\n" : ",\n") << "    {\"name\": "
+            << jsonString(scope.label) << ", \"calls\": " << scope.calls
+            << ", \"total_ms\": " << toMilliseconds(scope.time)
+            << ", \"per_frame_ms\": " << toMilliseconds(scope.time) / frames
+            << "}";
+    }
+    out << "\n  ]\n"
+        << "}\n";
 }
 
 void BenchmarkState::tick(float dt) {
@@ -93,6 +235,15 @@ void BenchmarkState::tick(float dt) {
 }
 
 void BenchmarkState::draw(GameRenderer& r) {
+    auto now = std::chrono::steady_clock::now();
+    auto allocations = getAllocationCount();
+    if (frameCounter > 0) {
+        frameTimes.push_back(now - lastFrame);
+        frameAllocations.push_back(allocations - lastAllocations);
+    }
+    lastFrame = now;
+    lastAllocations = allocations;
+
     frameCounter++;
     State::draw(r);
 }
@@ -3,11 +3,16 @@
 
 #include "State.hpp"
 
+#include <core/Profiler.hpp>
 #include <render/ViewCamera.hpp>
 
 #include <glm/gtc/quaternion.hpp>
 #include <glm/vec3.hpp>
 
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -22,13 +27,26 @@ class BenchmarkState final : public State {
     ViewCamera trackCam;
 
     std::string benchfile;
+    /// Where to write the results as JSON
+    std::optional<std::string> outputPath;
 
     float benchmarkTime{0.f};
     float duration{0.f};
     uint32_t frameCounter{0};
 
+    // Per-frame measurements, from one draw to the next
+    std::chrono::steady_clock::time_point lastFrame;
+    uint64_t lastAllocations{0};
+    std::vector<std::chrono::nanoseconds> frameTimes;
+    std::vector<uint64_t> frameAllocations;
+
+    ScopeTimings scopeTimings;
+
+    void writeResults(std::ostream& out) const;
+
 public:
-    BenchmarkState(RWGame* game, const std::string& benchfile);
+    BenchmarkState(RWGame* game, const std::string& benchfile,
+                   const std::optional<std::string>& outputPath = {});
 
     void enter() override;
 
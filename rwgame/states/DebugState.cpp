@@ -10,10 +10,14 @@
 #include <objects/InstanceObject.hpp>
 #include <objects/VehicleObject.hpp>
 #include <script/SCMFile.hpp>
+#include <script/ScriptMachine.hpp>
 
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/string_cast.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 
@@ -70,6 +74,9 @@ void DebugState::drawDebugMenu() {
         if (ImGui::MenuItem("Cull Here")) {
             game->getRenderer().setCullOverride(true, _debugCam);
         }
+        if (ImGui::MenuItem("Capture Render List")) {
+            game->getRenderer().captureRenderList("render_list.rwcapture");
+        }
 
         ImGui::EndMenu();
     }
@@ -104,7 +111,14 @@ void DebugState::drawDebugMenu() {
         ImGui::EndMenu();
     }
 
+    if (ImGui::BeginMenu("Script")) {
+        drawScriptMenu();
+        ImGui::EndMenu();
+    }
+
     ImGui::End();
+
+    drawScriptProfile();
 }
 
 void DebugState::drawMapMenu() {
@@ -343,6 +357,7 @@ void DebugState::drawMissionsMenu() {
                     if (thread.baseAddress >= offsets[0]) {
                         thread.wakeCounter = -1;
                         thread.finished = true;
+                        vm->wakeThread(thread);
                     }
                 }
 
@@ -356,6 +371,75 @@ void DebugState::drawMissionsMenu() {
     }
 }
 
+void DebugState::drawScriptMenu() {
+    ScriptMachine* vm = game->getScriptVM();
+    if (!vm) {
+        return;
+    }
+
+    auto profiler = vm->getProfiler();
+    if (ImGui::MenuItem("Profile", nullptr, profiler != nullptr)) {
+        vm->setProfiling(profiler == nullptr);
+        profiler = vm->getProfiler();
+    }
+    if (!profiler) {
+        return;
+    }
+    if (ImGui::MenuItem("Reset Profile")) {
+        profiler->clear();
+    }
+    if (ImGui::MenuItem("Save Profile")) {
+        std::ofstream csv("script_profile.csv");
+        profiler->writeCSV(csv);
+        std::ofstream json("script_profile.json");
+        profiler->writeJSON(json);
+        std::cout << "Wrote script_profile.csv and script_profile.json\n";
+    }
+}
+
+void DebugState::drawScriptProfile() {
+    static constexpr std::size_t kShownEntries = 15;
+
+    ScriptMachine* vm = game->getScriptVM();
+    auto profiler = vm ? vm->getProfiler() : nullptr;
+    if (!profiler) {
+        return;
+    }
+
+    auto toMs = [](std::chrono::nanoseconds time) {
+        return std::chrono::duration<double, std::milli>(time).count();
+    };
+
+    ImGui::Begin("Script Profile");
+
+    ImGui::Text("%-6s %-32s %10s %10s %8s", "Opcode", "Signature", "Calls",
+                "Total ms", "Max ms");
+    auto opcodes = profiler->getOpcodes();
+    for (std::size_t i = 0; i < std::min(opcodes.size(), kShownEntries);
+         ++i) {
+        const auto& entry = opcodes[i];
+        ImGui::Text("%04x   %-32s %10llu %10.3f %8.3f", entry.opcode,
+                    entry.signature.c_str(),
+                    static_cast<unsigned long long>(entry.counter.calls),
+                    toMs(entry.counter.time), toMs(entry.counter.max));
+    }
+
+    ImGui::Separator();
+
+    ImGui::Text("%-39s %10s %10s %8s", "Thread", "Ticks", "Total ms",
+                "Max ms");
+    auto threads = profiler->getThreads();
+    for (std::size_t i = 0; i < std::min(threads.size(), kShownEntries);
+         ++i) {
+        const auto& entry = threads[i];
+        ImGui::Text("%-39s %10llu %10.3f %8.3f", entry.name.c_str(),
+                    static_cast<unsigned long long>(entry.counter.calls),
+                    toMs(entry.counter.time), toMs(entry.counter.max));
+    }
+
+    ImGui::End();
+}
+
 DebugState::DebugState(RWGame* game, const glm::vec3& vp, const glm::quat& vd)
     : State(game), _invertedY(game->getConfig().invertY()) {
     _debugCam.position = vp;
@@ -25,6 +25,8 @@ class DebugState final : public State {
     void drawWeaponMenu();
     void drawWeatherMenu();
     void drawMissionsMenu();
+    void drawScriptMenu();
+    void drawScriptProfile();
 
 public:
     DebugState(RWGame* game, const glm::vec3& vp = {},
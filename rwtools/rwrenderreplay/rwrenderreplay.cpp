@@ -0,0 +1,335 @@
+#define SDL_MAIN_HANDLED
+
+#include <core/Profiler.hpp>
+#include <data/Clump.hpp>
+#include <gl/DrawBuffer.hpp>
+#include <gl/GeometryBuffer.hpp>
+#include <gl/gl_core_3_3.h>
+#include <render/GameShaders.hpp>
+#include <render/NullRenderer.hpp>
+#include <render/OpenGLRenderer.hpp>
+#include <render/RenderCapture.hpp>
+#include <render/RenderSort.hpp>
+
+#include <SDL.h>
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+/**
+ * Stands in for a draw buffer of the captured frame. Every index points at
+ * the same vertex, so draws bind the same buffers and index ranges as in
+ * the game without rasterising anything.
+ */
+class StandInBuffer {
+public:
+    StandInBuffer(GLenum faceType, std::size_t indexCount) {
+        std::vector<GeometryVertex> vertices(1);
+        gb.uploadVertices(vertices);
+        db.setFaceType(faceType);
+        db.addGeometry(&gb);
+
+        std::vector<std::uint32_t> indices(indexCount, 0);
+        glGenBuffers(1, &ebo);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                     static_cast<GLsizeiptr>(sizeof(std::uint32_t) *
+                                             indices.size()),
+                     indices.data(), GL_STATIC_DRAW);
+    }
+
+    ~StandInBuffer() {
+        glDeleteBuffers(1, &ebo);
+    }
+
+    DrawBuffer* getDrawBuffer() {
+        return &db;
+    }
+
+private:
+    GeometryBuffer gb;
+    DrawBuffer db;
+    GLuint ebo = 0;
+};
+
+/**
+ * Recreates a captured render list on stand-in buffers and textures
+ */
+class ReplayScene {
+public:
+    /**
+     * @param standIns Whether to create GL objects in place of the
+     * captured ones. Without them the draws only keep their buffers apart.
+     */
+    ReplayScene(const RenderCapture& capture, bool standIns)
+        : standIns(standIns) {
+        // Each buffer needs as many indices as its furthest draw uses
+        std::map<GLuint, std::pair<GLenum, std::size_t>> bufferSizes;
+        for (const auto& draw : capture.draws) {
+            auto& size = bufferSizes[draw.buffer];
+            size.first = draw.faceType;
+            size.second = std::max(size.second,
+                                   draw.drawInfo.start + draw.drawInfo.count);
+        }
+        for (const auto& [name, size] : bufferSizes) {
+            if (standIns) {
+                auto& buffer = buffers[name];
+                buffer = std::make_unique<StandInBuffer>(size.first,
+                                                         size.second);
+                drawBuffers[name] = buffer->getDrawBuffer();
+            } else {
+                auto& buffer = placeholders[name];
+                buffer = std::make_unique<DrawBuffer>();
+                buffer->setFaceType(size.first);
+                drawBuffers[name] = buffer.get();
+            }
+        }
+
+        for (const auto& draw : capture.draws) {
+            auto drawInfo = draw.drawInfo;
+            for (auto& texture : drawInfo.textures) {
+                texture = getTexture(texture);
+            }
+            list.emplace_back(draw.sortKey, draw.model,
+                              drawBuffers[draw.buffer], drawInfo);
+        }
+    }
+
+    ~ReplayScene() {
+        for (const auto& [captured, name] : textures) {
+            glDeleteTextures(1, &name);
+        }
+    }
+
+    const RenderList& getList() const {
+        return list;
+    }
+
+private:
+    GLuint getTexture(GLuint captured) {
+        if (captured == 0 || !standIns) {
+            return captured;
+        }
+        auto it = textures.find(captured);
+        if (it != textures.end()) {
+            return it->second;
+        }
+
+        const std::uint32_t white = 0xFFFFFFFF;
+        GLuint name;
+        glGenTextures(1, &name);
+        glBindTexture(GL_TEXTURE_2D, name);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA,
+                     GL_UNSIGNED_BYTE, &white);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        textures[captured] = name;
+        return name;
+    }
+
+    bool standIns;
+    std::map<GLuint, std::unique_ptr<StandInBuffer>> buffers;
+    /// Draw buffers without any GL objects, for the null renderer
+    std::map<GLuint, std::unique_ptr<DrawBuffer>> placeholders;
+    std::map<GLuint, DrawBuffer*> drawBuffers;
+    std::map<GLuint, GLuint> textures;
+    RenderList list;
+};
+
+double toMilliseconds(std::chrono::nanoseconds time) {
+    return std::chrono::duration<double, std::milli>(time).count();
+}
+
+/**
+ * Draws the scene for a number of frames and prints how long they took
+ */
+void replay(Renderer& renderer, Renderer::ShaderProgram* program,
+            const RenderCapture& capture, const ReplayScene& scene,
+            unsigned int frames, bool sort, bool finish) {
+    std::vector<std::chrono::nanoseconds> frameTimes;
+    frameTimes.reserve(frames);
+    int draws = 0, textures = 0, buffers = 0;
+    for (auto frame = 0u; frame < frames; ++frame) {
+        auto start = std::chrono::steady_clock::now();
+
+        RenderList list = scene.getList();
+        if (sort) {
+            sortRenderList(list);
+        }
+
+        renderer.swap();
+        renderer.invalidate();
+        renderer.clear(glm::vec4(0.f));
+        renderer.setSceneParameters(capture.scene);
+        renderer.useProgram(program);
+        renderer.drawBatched(list);
+        if (finish) {
+            glFinish();
+        }
+
+        frameTimes.push_back(std::chrono::steady_clock::now() - start);
+        draws = renderer.getDrawCount();
+        textures = renderer.getTextureCount();
+        buffers = renderer.getBufferCount();
+    }
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    std::cout << std::fixed << std::setprecision(3)
+              << "Renderer: " << renderer.getIDString() << "\n"
+              << "Instructions: " << capture.draws.size() << "\n"
+              << "Frames: " << frames << "\n"
+              << "Draws: " << draws << "\n"
+              << "Texture binds: " << textures << "\n"
+              << "Buffer binds: " << buffers << "\n"
+              << "Frame time p50: "
+              << toMilliseconds(percentile(frameTimes, 50.f)) << " ms\n"
+              << "Frame time p95: "
+              << toMilliseconds(percentile(frameTimes, 95.f)) << " ms\n"
+              << "Frame time p99: "
+              << toMilliseconds(percentile(frameTimes, 99.f)) << " ms\n";
+}
+}  // namespace
+
+int main(int argc, const char* argv[]) {
+    namespace po = boost::program_options;
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help", "Show this help message")
+        ("capture,c", po::value<std::string>()->value_name("PATH")->required(), "Render capture to replay")
+        ("frames,f", po::value<unsigned>()->value_name("FRAMES")->default_value(100), "Number of frames to draw")
+        ("sort,s", "Sort the render list again every frame")
+        ("no-instancing", "Draw every instruction on its own")
+        ("null,n", "Replay through the null renderer, without a GL context")
+        ("width,w", po::value<int>()->value_name("WIDTH")->default_value(1280), "Width of the framebuffer")
+        ("height,h", po::value<int>()->value_name("HEIGHT")->default_value(720), "Height of the framebuffer")
+    ;
+
+    po::positional_options_description positional;
+    positional.add("capture", 1);
+
+    po::variables_map vm;
+    try {
+        po::store(po::command_line_parser(argc, argv)
+                      .options(desc)
+                      .positional(positional)
+                      .run(),
+                  vm);
+        if (vm.count("help")) {
+            std::cout << desc;
+            return EXIT_SUCCESS;
+        }
+        po::notify(vm);
+    } catch (po::error &ex) {
+        std::cerr << "Error parsing arguments: " << ex.what() << std::endl;
+        std::cerr << desc;
+        return EXIT_FAILURE;
+    }
+
+    RenderCapture capture;
+    try {
+        std::ifstream in(vm["capture"].as<std::string>(), std::ios::binary);
+        if (!in) {
+            std::cerr << "Failed to open " << vm["capture"].as<std::string>()
+                      << "\n";
+            return EXIT_FAILURE;
+        }
+        capture = RenderCapture::read(in);
+    } catch (const std::runtime_error& ex) {
+        std::cerr << ex.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    const auto frames = vm["frames"].as<unsigned>();
+    const bool sort = vm.count("sort") > 0;
+
+    if (vm.count("null")) {
+        NullRenderer renderer;
+        auto worldProg = renderer.createShader(
+            GameShaders::WorldObject::VertexShader,
+            GameShaders::WorldObject::FragmentShader);
+        ReplayScene scene(capture, false);
+        replay(renderer, worldProg.get(), capture, scene, frames, sort,
+               false);
+
+        const auto& stats = renderer.getStatistics();
+        std::cout << "Uploads: " << stats.uploads << "\n"
+                  << "State changes: " << stats.states << "\n";
+        return EXIT_SUCCESS;
+    }
+
+    SDL_SetMainReady();
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        std::cerr << "SDL_Init failed: " << SDL_GetError() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK,
+                        SDL_GL_CONTEXT_PROFILE_CORE);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+    SDL_GL_SetAttribute(SDL_GL_DEPTH_SIZE, 24);
+
+    const auto width = vm["width"].as<int>();
+    const auto height = vm["height"].as<int>();
+    auto window = SDL_CreateWindow("rwrenderreplay", SDL_WINDOWPOS_CENTERED,
+                                   SDL_WINDOWPOS_CENTERED, width, height,
+                                   SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+    if (window == nullptr) {
+        std::cerr << "SDL_CreateWindow failed: " << SDL_GetError() << "\n";
+        SDL_Quit();
+        return EXIT_FAILURE;
+    }
+    auto context = SDL_GL_CreateContext(window);
+    if (context == nullptr) {
+        std::cerr << "SDL_GL_CreateContext failed: " << SDL_GetError()
+                  << "\n";
+        SDL_DestroyWindow(window);
+        SDL_Quit();
+        return EXIT_FAILURE;
+    }
+
+    {
+        OpenGLRenderer renderer;
+        renderer.setViewport({width, height});
+
+        auto worldProg = renderer.createShader(
+            GameShaders::WorldObject::VertexShader,
+            GameShaders::WorldObject::FragmentShader);
+        renderer.setUniformTexture(worldProg.get(), "texture", 0);
+        renderer.setProgramBlockBinding(worldProg.get(), "SceneData", 1);
+        renderer.setProgramBlockBinding(worldProg.get(), "ObjectData", 2);
+
+        auto worldInstancedProg = renderer.createShader(
+            GameShaders::WorldObject::InstancedVertexShader,
+            GameShaders::WorldObject::FragmentShader);
+        renderer.setUniformTexture(worldInstancedProg.get(), "texture", 0);
+        renderer.setProgramBlockBinding(worldInstancedProg.get(), "SceneData",
+                                        1);
+        renderer.setProgramBlockBinding(worldInstancedProg.get(),
+                                        "ObjectData", 2);
+        if (!vm.count("no-instancing")) {
+            renderer.setInstancedProgram(worldProg.get(),
+                                         worldInstancedProg.get());
+        }
+
+        ReplayScene scene(capture, true);
+        replay(renderer, worldProg.get(), capture, scene, frames, sort, true);
+    }
+
+    SDL_GL_DeleteContext(context);
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+    return EXIT_SUCCESS;
+}
@@ -11,6 +11,7 @@
 #include <objects/VehicleObject.hpp>
 #include <render/GameRenderer.hpp>
 #include <render/ObjectRenderer.hpp>
+#include <render/RenderSort.hpp>
 #include <render/TextRenderer.hpp>
 
 #include <QFileDialog>
@@ -106,11 +107,8 @@ void ViewerWidget::drawObject(GameRenderer &r, GameObject *object) {
     ObjectRenderer objectRenderer(world(), vc, 1.f);
     RenderList renders;
     objectRenderer.buildRenderList(object, renders);
-    std::sort(renders.begin(), renders.end(),
-              [](const Renderer::RenderInstruction& a,
-                 const Renderer::RenderInstruction& b) {
-                  return a.sortKey < b.sortKey;
-              });
+    objectRenderer.flush();
+    sortRenderList(renders);
     r.getRenderer().drawBatched(renders);
     r.renderPostProcess();
 }
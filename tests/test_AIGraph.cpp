@@ -0,0 +1,167 @@
+#include <boost/test/unit_test.hpp>
+
+#include <ai/AIGraph.hpp>
+#include <ai/AIGraphNode.hpp>
+#include <data/PathData.hpp>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <limits>
+#include <vector>
+
+namespace {
+/// A short road from (0,0) to (20,0), and a longer one around through y=30
+void createLoop(ai::AIGraph& graph) {
+    PathData shortPath{PathData::PATH_PED,
+                       0,
+                       "",
+                       {
+                           {PathNode::EXTERNAL, 1, {0.f, 0.f, 0.f}, 1.f, 0, 0},
+                           {PathNode::INTERNAL, 2, {10.f, 0.f, 0.f}, 1.f, 0, 0},
+                           {PathNode::EXTERNAL, -1, {20.f, 0.f, 0.f}, 1.f, 0, 0},
+                       }};
+    PathData longPath{PathData::PATH_PED,
+                      1,
+                      "",
+                      {
+                          {PathNode::EXTERNAL, 1, {0.f, 0.f, 0.f}, 1.f, 0, 0},
+                          {PathNode::INTERNAL, 2, {0.f, 30.f, 0.f}, 1.f, 0, 0},
+                          {PathNode::INTERNAL, 3, {20.f, 30.f, 0.f}, 1.f, 0, 0},
+                          {PathNode::EXTERNAL, -1, {20.f, 0.f, 0.f}, 1.f, 0, 0},
+                      }};
+    PathData road{PathData::PATH_CAR,
+                  2,
+                  "",
+                  {
+                      {PathNode::EXTERNAL, 1, {0.f, 1.f, 0.f}, 1.f, 1, 1},
+                      {PathNode::EXTERNAL, -1, {20.f, 1.f, 0.f}, 1.f, 1, 1},
+                  }};
+    const glm::quat identity{1.0f, 0.0f, 0.0f, 0.0f};
+    graph.createPathNodes(glm::vec3(), identity, shortPath);
+    graph.createPathNodes(glm::vec3(), identity, longPath);
+    graph.createPathNodes(glm::vec3(), identity, road);
+}
+
+std::vector<glm::vec3> positions(const std::vector<ai::AIGraphNode*>& route) {
+    std::vector<glm::vec3> result;
+    for (const auto node : route) {
+        result.push_back(node->position);
+    }
+    return result;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(AIGraphTests)
+
+BOOST_AUTO_TEST_CASE(test_nearest_node) {
+    ai::AIGraph graph;
+    createLoop(graph);
+
+    auto node = graph.findNearestNode({1.f, 2.f, 0.f}, ai::NodeType::Pedestrian);
+    BOOST_REQUIRE(node != nullptr);
+    BOOST_CHECK(node->position == glm::vec3(0.f, 0.f, 0.f));
+
+    node = graph.findNearestNode({1.f, 2.f, 0.f}, ai::NodeType::Vehicle);
+    BOOST_REQUIRE(node != nullptr);
+    BOOST_CHECK(node->position == glm::vec3(0.f, 1.f, 0.f));
+
+    // Far away nodes are found by searching further cells
+    node = graph.findNearestNode({1000.f, 1000.f, 0.f},
+                                 ai::NodeType::Pedestrian);
+    BOOST_REQUIRE(node != nullptr);
+    BOOST_CHECK(node->position == glm::vec3(20.f, 30.f, 0.f));
+
+    BOOST_CHECK(graph.findNearestNode({1000.f, 1000.f, 0.f},
+                                      ai::NodeType::Pedestrian,
+                                      100.f) == nullptr);
+
+    node = graph.findNearestNode(
+        {1.f, 2.f, 0.f}, ai::NodeType::Pedestrian,
+        std::numeric_limits<float>::max(),
+        [](const ai::AIGraphNode& n) { return n.position.x > 5.f; });
+    BOOST_REQUIRE(node != nullptr);
+    BOOST_CHECK(node->position == glm::vec3(10.f, 0.f, 0.f));
+}
+
+BOOST_AUTO_TEST_CASE(test_find_route) {
+    ai::AIGraph graph;
+    createLoop(graph);
+
+    auto start = graph.findNearestNode({0.f, 0.f, 0.f}, ai::NodeType::Pedestrian);
+    auto goal = graph.findNearestNode({20.f, 0.f, 0.f}, ai::NodeType::Pedestrian);
+    BOOST_REQUIRE(start != nullptr && goal != nullptr);
+
+    std::vector<ai::AIGraphNode*> route;
+    BOOST_REQUIRE(graph.findRoute(start, goal, ai::NodeType::Pedestrian, route));
+    std::vector<glm::vec3> expected{
+        {0.f, 0.f, 0.f}, {10.f, 0.f, 0.f}, {20.f, 0.f, 0.f}};
+    BOOST_CHECK(positions(route) == expected);
+
+    // Disabled nodes are walked around
+    graph.findNearestNode({10.f, 0.f, 0.f}, ai::NodeType::Pedestrian)
+        ->disabled = true;
+    graph.clearRouteCache();
+    BOOST_REQUIRE(graph.findRoute(start, goal, ai::NodeType::Pedestrian, route));
+    expected = {{0.f, 0.f, 0.f},
+                {0.f, 30.f, 0.f},
+                {20.f, 30.f, 0.f},
+                {20.f, 0.f, 0.f}};
+    BOOST_CHECK(positions(route) == expected);
+
+    // Pedestrians can't use roads
+    auto road = graph.findNearestNode({20.f, 0.f, 0.f}, ai::NodeType::Vehicle);
+    BOOST_CHECK(!graph.findRoute(start, road, ai::NodeType::Pedestrian, route));
+    BOOST_CHECK(route.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_route_cache) {
+    ai::AIGraph graph;
+    createLoop(graph);
+
+    auto start = graph.findNearestNode({0.f, 0.f, 0.f}, ai::NodeType::Pedestrian);
+    auto goal = graph.findNearestNode({20.f, 0.f, 0.f}, ai::NodeType::Pedestrian);
+
+    std::vector<ai::AIGraphNode*> route;
+    graph.findRoute(start, goal, ai::NodeType::Pedestrian, route);
+    BOOST_CHECK_EQUAL(graph.getCachedRouteCount(), 1);
+
+    // Cached routes are reused
+    std::vector<ai::AIGraphNode*> cached;
+    graph.findRoute(start, goal, ai::NodeType::Pedestrian, cached);
+    BOOST_CHECK_EQUAL(graph.getCachedRouteCount(), 1);
+    BOOST_CHECK(cached == route);
+
+    // Unreachable routes are remembered too
+    graph.findRoute(start, goal, ai::NodeType::Vehicle, route);
+    BOOST_CHECK_EQUAL(graph.getCachedRouteCount(), 2);
+
+    // The cache stops growing once it is full
+    PathData line{PathData::PATH_PED, 3, "", {}};
+    for (int n = 0; n < 20; ++n) {
+        line.nodes.push_back({PathNode::INTERNAL, n < 19 ? n + 1 : -1,
+                              {50.f + n, 0.f, 0.f}, 1.f, 0, 0});
+    }
+    graph.createPathNodes(glm::vec3(), glm::quat{1.0f, 0.0f, 0.0f, 0.0f},
+                          line);
+    BOOST_CHECK_EQUAL(graph.getCachedRouteCount(), 0);
+
+    for (const auto& node : graph.nodes) {
+        for (const auto& other : graph.nodes) {
+            graph.findRoute(node.get(), other.get(), ai::NodeType::Vehicle,
+                            route);
+        }
+    }
+    for (const auto& node : graph.nodes) {
+        for (const auto& other : graph.nodes) {
+            graph.findRoute(node.get(), other.get(), ai::NodeType::Pedestrian,
+                            route);
+        }
+    }
+    BOOST_CHECK_EQUAL(graph.getCachedRouteCount(),
+                      ai::AIGraph::kRouteCacheSize);
+
+    graph.clearRouteCache();
+    BOOST_CHECK_EQUAL(graph.getCachedRouteCount(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,7 +1,10 @@
 #include <boost/test/unit_test.hpp>
+#include <core/JobPool.hpp>
 #include <data/Clump.hpp>
 #include <engine/Animator.hpp>
+#include <engine/GameWorld.hpp>
 #include <loaders/LoaderIFP.hpp>
+#include <objects/CharacterObject.hpp>
 #include <glm/gtx/string_cast.hpp>
 #include "test_Globals.hpp"
 
@@ -18,7 +21,7 @@ BOOST_AUTO_TEST_CASE(test_matrix) {
         Animator animator(test_model);
 
         animation->duration = 1.f;
-        animation->bones.emplace(
+        animation->addBone(
             "player", AnimationBone(
                           "player", 0, 0, 1.0f, AnimationBone::RT0,
                           std::vector<AnimationKeyframe>{
@@ -44,4 +47,96 @@ BOOST_AUTO_TEST_CASE(test_matrix) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_cursor_sampling) {
+    std::vector<AnimationKeyframe> frames;
+    for (int i = 0; i < 8; ++i) {
+        auto angle = static_cast<float>(i) * 0.25f;
+        frames.emplace_back(glm::angleAxis(angle, glm::vec3(0.f, 0.f, 1.f)),
+                            glm::vec3(static_cast<float>(i), 0.f, 0.f),
+                            glm::vec3(1.f), static_cast<float>(i) * 0.5f, i);
+    }
+    AnimationBone bone("bone", 0, 0, 3.5f, AnimationBone::RT0, frames);
+
+    BOOST_REQUIRE_EQUAL(bone.getFrameCount(), 8u);
+
+    // Play forwards, then restart from the beginning
+    std::uint32_t cursor = 0;
+    for (float t : {0.f, 0.1f, 0.6f, 1.2f, 1.2f, 2.9f, 3.5f, 4.f, 0.3f}) {
+        auto expected = bone.getInterpolatedKeyframe(t);
+        auto sampled = bone.getInterpolatedKeyframe(t, cursor);
+        BOOST_CHECK(sampled.position == expected.position);
+        BOOST_CHECK(sampled.rotation == expected.rotation);
+    }
+
+    // Rotations are quantized, but stay close to the source
+    auto kf = bone.getFrame(3);
+    BOOST_CHECK_LT(glm::abs(glm::dot(kf.rotation, frames[3].rotation) - 1.f),
+                   0.001f);
+}
+
+BOOST_AUTO_TEST_CASE(test_prepare_deterministic) {
+    constexpr auto kCharacters = 40u;
+    constexpr auto kTicks = 10;
+    constexpr float kStep = 1.f / 30.f;
+    const AnimCycle cycles[] = {AnimCycle::Walk, AnimCycle::Run,
+                                AnimCycle::Sprint, AnimCycle::Idle};
+
+    // Poses a set of characters and returns the world transform of every
+    // frame, preparing the animations on the given number of threads or
+    // not at all
+    auto pose = [&](unsigned int threads) {
+        auto e = Global::get().e;
+        std::vector<CharacterObject*> characters;
+        for (auto i = 0u; i < kCharacters; ++i) {
+            auto character = e->createPedestrian(
+                1, {static_cast<float>(i) * 2.f, 0.f, 0.f});
+            BOOST_REQUIRE(character != nullptr);
+            auto animation = character->animations->animation(cycles[i % 4]);
+            character->animator->playAnimation(0, animation, 1.f, true);
+            character->animator->setAnimationTime(
+                0, static_cast<float>(i) * 0.05f);
+            characters.push_back(character);
+        }
+
+        std::unique_ptr<JobPool> jobs;
+        if (threads > 1) {
+            jobs = std::make_unique<JobPool>(threads);
+        }
+        for (auto t = 0; t < kTicks; ++t) {
+            if (threads > 0) {
+                // Gameplay code still sees the current pose until the tick
+                auto hand = characters[0]->getClump()->findFrame("srhand");
+                BOOST_REQUIRE(hand != nullptr);
+                const auto before = hand->getWorldTransform();
+                e->prepareAnimations(kStep, jobs.get());
+                BOOST_CHECK(hand->getWorldTransform() == before);
+            }
+            for (auto character : characters) {
+                character->animator->tick(kStep);
+            }
+        }
+
+        std::vector<glm::mat4> transforms;
+        for (auto character : characters) {
+            for (auto frame : character->getClump()->getPoseFrames()) {
+                transforms.push_back(frame->getWorldTransform());
+            }
+            e->destroyObject(character);
+        }
+        return transforms;
+    };
+
+    auto ticked = pose(0);
+    auto sequential = pose(1);
+    auto threaded = pose(4);
+
+    BOOST_REQUIRE(!ticked.empty());
+    BOOST_REQUIRE_EQUAL(ticked.size(), sequential.size());
+    BOOST_REQUIRE_EQUAL(ticked.size(), threaded.size());
+    for (auto i = 0u; i < ticked.size(); ++i) {
+        BOOST_CHECK(ticked[i] == sequential[i]);
+        BOOST_CHECK(ticked[i] == threaded[i]);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
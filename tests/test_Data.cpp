@@ -99,8 +99,7 @@ BOOST_AUTO_TEST_CASE(test_model_archive_loaded) {
     auto& d = Global::get().d;
     auto& e = Global::get().e;
 
-    /// @todo Implement streaming
-    // Currently, instanciating an entity will load the model
+    // Vehicles, peds and pickups still load their model when created
     {
         auto crim = d->findModelInfo<PedModelInfo>(24);
         auto pickup = e->createPickup({}, 24, PickupObject::InShop);
@@ -110,15 +109,118 @@ BOOST_AUTO_TEST_CASE(test_model_archive_loaded) {
 
         e->destroyObject(pickup);
     }
+    // Instances stream their model in the background once drawn
     {
         auto info = d->findModelInfo<SimpleModelInfo>(2202);
         auto inst = e->createInstance(2202, {});
 
         BOOST_REQUIRE(info->type() == ModelDataType::SimpleInfo);
+
+        d->streamer.request(2202, inst->getPosition());
+        d->streamer.finish();
+        inst->tick(0.f);
+
         BOOST_CHECK_NE(info->getAtomic(0), nullptr);
+        BOOST_CHECK_NE(inst->getAtomic(), nullptr);
 
         e->destroyObject(inst);
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_model_streaming) {
+    auto& d = Global::get().d;
+
+    auto info = d->findModelInfo<SimpleModelInfo>(1337);
+    BOOST_REQUIRE(info != nullptr);
+    info->unload();
+
+    d->streamer.request(1337, {});
+    d->streamer.request(1337, {100.f, 0.f, 0.f});
+    BOOST_CHECK(d->streamer.isPending(1337));
+    BOOST_CHECK_EQUAL(d->streamer.getPendingCount(), 1u);
+    BOOST_CHECK(!info->isLoaded());
+
+    d->streamer.finish();
+
+    BOOST_CHECK(!d->streamer.isPending(1337));
+    BOOST_CHECK(info->isLoaded());
+    BOOST_CHECK_NE(info->getAtomic(0), nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(test_model_eviction) {
+    auto& d = Global::get().d;
+
+    auto info = d->findModelInfo<SimpleModelInfo>(1337);
+    BOOST_REQUIRE(info != nullptr);
+    info->unload();
+    BOOST_REQUIRE(d->loadModel(1337));
+    BOOST_CHECK_GT(d->residency.getModelMemory().total(), 0u);
+
+    d->residency.setBudget(1);
+
+    // Models that are still being used stay resident
+    for (int i = 0; i < 300; ++i) {
+        d->residency.markUsed(info);
+        d->residency.update();
+    }
+    BOOST_CHECK(info->isLoaded());
+
+    for (int i = 0; i < 300; ++i) {
+        d->residency.update();
+    }
+    BOOST_CHECK(!info->isLoaded());
+    BOOST_CHECK_EQUAL(info->getAtomic(0), nullptr);
+
+    d->residency.setBudget(0);
+}
+
+BOOST_AUTO_TEST_CASE(test_model_reload_eviction) {
+    auto& d = Global::get().d;
+
+    auto info = d->findModelInfo<SimpleModelInfo>(1337);
+    BOOST_REQUIRE(info != nullptr);
+    info->unload();
+    BOOST_REQUIRE(d->loadModel(1337));
+    std::string modelName, slot;
+    d->getModelFiles(info, modelName, slot);
+    const auto memory = d->residency.getModelMemory().total();
+
+    // Registering a loaded model again replaces it
+    d->residency.addModel(info, info->getModel(), slot);
+    BOOST_CHECK_EQUAL(d->residency.getModelMemory().total(), memory);
+
+    // Neither the model nor its texture slot are kept resident by reloading
+    d->residency.setBudget(1);
+    for (int i = 0; i < 300; ++i) {
+        d->residency.update();
+    }
+    BOOST_CHECK(!info->isLoaded());
+    BOOST_CHECK(d->textureSlots.find(slot) == d->textureSlots.end());
+
+    d->residency.setBudget(0);
+}
+
+BOOST_AUTO_TEST_CASE(test_weapon_models_pinned) {
+    auto& d = Global::get().d;
+
+    BOOST_REQUIRE_GT(d->weaponData.size(), 1u);
+    const auto id = d->weaponData[1].modelID;
+    BOOST_CHECK(d->residency.isPinned(id));
+
+    auto info = d->findModelInfo<SimpleModelInfo>(id);
+    BOOST_REQUIRE(info != nullptr);
+    if (!info->isLoaded()) {
+        BOOST_REQUIRE(d->loadModel(id));
+    }
+
+    d->residency.setBudget(1);
+    for (int i = 0; i < 300; ++i) {
+        d->residency.update();
+    }
+    BOOST_CHECK(info->isLoaded());
+    BOOST_CHECK_NE(info->getAtomic(0), nullptr);
+
+    d->residency.setBudget(0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
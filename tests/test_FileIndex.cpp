@@ -1,8 +1,11 @@
 #include <boost/test/unit_test.hpp>
+#include <loaders/LoaderIMG.hpp>
 #include <platform/FileHandle.hpp>
 #include <platform/FileIndex.hpp>
 #include "test_Globals.hpp"
 
+#include <algorithm>
+
 BOOST_AUTO_TEST_SUITE(FileIndexTests)
 
 BOOST_AUTO_TEST_CASE(test_normalizeName) {
@@ -67,6 +70,49 @@ BOOST_AUTO_TEST_CASE(test_indexArchive, DATA_TEST_PREDICATE) {
     {
         auto handle = index.openFile("landstal.dff");
         BOOST_CHECK(handle.data != nullptr);
+        BOOST_CHECK_EQUAL(handle.length % kIMGSectorSize, 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_openArchiveFile, DATA_TEST_PREDICATE) {
+    FileIndex index;
+    index.indexTree(Global::getGamePath());
+    index.indexArchive("models/gta3.img");
+
+    LoaderIMG archive;
+    BOOST_REQUIRE(archive.load(Global::getGamePath() + "/models/gta3.img"));
+    LoaderIMGFile info;
+    BOOST_REQUIRE(archive.findAssetInfo("landstal.dff", info));
+    auto expected = archive.loadToMemory("landstal.dff");
+
+    // Repeated opens must read from the retained archive handle
+    for (int i = 0; i < 2; ++i) {
+        auto handle = index.openFile("landstal.dff");
+        BOOST_REQUIRE(handle.data != nullptr);
+        BOOST_REQUIRE_EQUAL(handle.length, info.size * kIMGSectorSize);
+        BOOST_CHECK(std::equal(handle.data.get(),
+                               handle.data.get() + handle.length,
+                               expected.get()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_openFileView, DATA_TEST_PREDICATE) {
+    FileIndex index;
+    index.indexTree(Global::getGamePath());
+    index.indexArchive("models/gta3.img");
+
+    BOOST_CHECK(index.openFileView("notafile.dff").data == nullptr);
+
+    for (const auto& name : {"landstal.dff", "data/cullzone.dat"}) {
+        auto handle = index.openFile(name);
+        auto view = index.openFileView(name);
+        BOOST_REQUIRE(view.data != nullptr);
+        BOOST_REQUIRE_EQUAL(view.length, handle.length);
+        BOOST_CHECK(std::equal(view.data, view.data + view.length,
+                               handle.data.get()));
+
+        // Views of the same file share the same mapping
+        BOOST_CHECK_EQUAL(index.openFileView(name).data, view.data);
     }
 }
 
@@ -1,7 +1,10 @@
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <vector>
 #include <engine/GameData.hpp>
 #include <engine/GameWorld.hpp>
 #include <objects/InstanceObject.hpp>
+#include <render/ViewFrustum.hpp>
 #include "test_Globals.hpp"
 
 BOOST_AUTO_TEST_SUITE(GameWorldTests, DATA_TEST_PREDICATE)
@@ -15,6 +18,26 @@ BOOST_AUTO_TEST_CASE(test_gameobject_id) {
     BOOST_CHECK_NE(object1->getGameObjectID(), object2->getGameObjectID());
 }
 
+BOOST_AUTO_TEST_CASE(test_gameobject_id_stale) {
+    auto& gw = *Global::get().e;
+
+    auto object1 = gw.createInstance(1337, glm::vec3(100.f, 0.f, 0.f));
+    auto id1 = object1->getGameObjectID();
+    BOOST_CHECK_EQUAL(gw.instancePool.find(id1), object1);
+
+    gw.destroyObject(object1);
+    BOOST_CHECK(gw.instancePool.find(id1) == nullptr);
+
+    // The new object may reuse the slot, but never the ID
+    auto object2 = gw.createInstance(1337, glm::vec3(100.f, 0.f, 0.f));
+    auto id2 = object2->getGameObjectID();
+    BOOST_CHECK_NE(id1, id2);
+    BOOST_CHECK(gw.instancePool.find(id1) == nullptr);
+    BOOST_CHECK_EQUAL(gw.instancePool.find(id2), object2);
+
+    gw.destroyObject(object2);
+}
+
 BOOST_AUTO_TEST_CASE(test_offsetgametime) {
     auto& gw = *Global::get().e;
     gw.state = new GameState();
@@ -67,4 +90,83 @@ BOOST_AUTO_TEST_CASE(test_offsetgametime) {
     BOOST_CHECK_EQUAL(25, gw.getMinute());
 }
 
+BOOST_AUTO_TEST_CASE(test_object_grid) {
+    auto& gw = *Global::get().e;
+
+    auto object = gw.createInstance(1337, glm::vec3(5000.f, 5000.f, 0.f));
+    BOOST_REQUIRE(object != nullptr);
+    BOOST_CHECK(gw.objectGrid.contains(object));
+
+    auto found = [&](const glm::vec3& center, float radius) {
+        std::vector<GameObject*> nearby;
+        gw.objectGrid.query(center, radius, nearby);
+        return std::find(nearby.begin(), nearby.end(), object) !=
+               nearby.end();
+    };
+    auto foundInBox = [&](const glm::vec3& min, const glm::vec3& max) {
+        std::vector<GameObject*> nearby;
+        gw.objectGrid.query(min, max, nearby);
+        return std::find(nearby.begin(), nearby.end(), object) !=
+               nearby.end();
+    };
+
+    BOOST_CHECK(found({5000.f, 5000.f, 0.f}, 1.f));
+    BOOST_CHECK(!found({-5000.f, 5000.f, 0.f}, 1.f));
+    BOOST_CHECK(foundInBox({4990.f, 4990.f, -10.f}, {5010.f, 5010.f, 10.f}));
+
+    // Moving the object moves its entry
+    object->setPosition({-5000.f, 5000.f, 0.f});
+    BOOST_CHECK(!found({5000.f, 5000.f, 0.f}, 1.f));
+    BOOST_CHECK(found({-5000.f, 5000.f, 0.f}, 1.f));
+    BOOST_CHECK(!foundInBox({4990.f, 4990.f, -10.f}, {5010.f, 5010.f, 10.f}));
+
+    gw.destroyObject(object);
+    BOOST_CHECK(!gw.objectGrid.contains(object));
+}
+
+BOOST_AUTO_TEST_CASE(test_static_objects) {
+    auto& gw = *Global::get().e;
+
+    // Looking down -Z from the origin
+    ViewFrustum frustum(0.1f, 100.f, glm::half_pi<float>(), 1.f);
+    frustum.update(frustum.projection());
+
+    std::vector<GameObject*> objects;
+    auto visible = gw.createInstance(1337, glm::vec3(0.f, 0.f, -50.f));
+    objects.push_back(visible);
+    for (int i = 0; i < 32; ++i) {
+        objects.push_back(gw.createInstance(
+            1337, glm::vec3(i * 100.f - 1600.f, 0.f, 200.f)));
+    }
+
+    ObjectBVH bvh;
+    bvh.build(objects);
+    BOOST_CHECK_EQUAL(bvh.size(), objects.size());
+    BOOST_CHECK_GT(bvh.getNodeCount(), 1u);
+
+    std::vector<GameObject*> found;
+    bvh.query(frustum, found);
+    BOOST_REQUIRE_EQUAL(found.size(), 1u);
+    BOOST_CHECK_EQUAL(found[0], visible);
+
+    found.clear();
+    bvh.query(glm::vec3(-1600.f, 0.f, 200.f), 1.f, found);
+    BOOST_REQUIRE_EQUAL(found.size(), 1u);
+    BOOST_CHECK_EQUAL(found[0], objects[1]);
+
+    // Moved objects no longer fit in the tree
+    BOOST_CHECK(bvh.update(visible));
+    visible->setPosition(glm::vec3(0.f, 0.f, -60.f));
+    BOOST_CHECK(!bvh.update(visible));
+
+    BOOST_CHECK(bvh.remove(visible));
+    found.clear();
+    bvh.query(frustum, found);
+    BOOST_CHECK(found.empty());
+
+    for (auto object : objects) {
+        gw.destroyObject(object);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
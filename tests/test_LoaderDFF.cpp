@@ -25,6 +25,33 @@ BOOST_AUTO_TEST_CASE(test_load_dff, DATA_TEST_PREDICATE) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_decode_dff, DATA_TEST_PREDICATE) {
+    {
+        auto d = Global::get().e->data->index.openFileView("landstal.dff");
+
+        LoaderDFF loader;
+
+        auto m = loader.decodeFromMemory(d);
+
+        BOOST_REQUIRE(m.get() != nullptr);
+        BOOST_REQUIRE(!m->getAtomics().empty());
+        const auto& geometry = m->getAtomics()[0]->getGeometry();
+        BOOST_REQUIRE(geometry);
+
+        // Decoding alone must not create any GL objects
+        BOOST_CHECK(!geometry->isUploaded());
+        BOOST_CHECK_EQUAL(geometry->EBO, 0);
+        BOOST_CHECK(!geometry->vertices.empty());
+        BOOST_CHECK(!geometry->subgeom.empty());
+
+        m->upload();
+
+        BOOST_CHECK(geometry->isUploaded());
+        BOOST_CHECK_NE(geometry->EBO, 0);
+        BOOST_CHECK(geometry->vertices.empty());
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_clump_clone) {
     {
         auto frame1 = std::make_shared<ModelFrame>(0);
@@ -65,4 +92,55 @@ BOOST_AUTO_TEST_CASE(test_clump_clone) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_clump_pose) {
+    {
+        auto root = std::make_shared<ModelFrame>(0);
+        root->setName("root");
+        auto arm = std::make_shared<ModelFrame>(1, glm::mat3{1.0f},
+                                                glm::vec3(1.f, 0.f, 0.f));
+        arm->setName("arm");
+        auto hand = std::make_shared<ModelFrame>(2, glm::mat3{1.0f},
+                                                 glm::vec3(0.f, 2.f, 0.f));
+        hand->setName("hand");
+        auto head = std::make_shared<ModelFrame>(3, glm::mat3{1.0f},
+                                                 glm::vec3(0.f, 0.f, 3.f));
+        head->setName("head");
+
+        arm->addChild(hand);
+        root->addChild(arm);
+        root->addChild(head);
+
+        auto clump = std::make_shared<Clump>();
+        clump->setFrame(root);
+
+        const auto& frames = clump->getPoseFrames();
+        BOOST_REQUIRE_EQUAL(frames.size(), 4);
+        BOOST_CHECK_EQUAL(frames[0], root.get());
+        BOOST_CHECK_EQUAL(clump->findPoseIndex("missing"), -1);
+
+        // Parents must come before their children
+        auto handIndex = clump->findPoseIndex("hand");
+        auto armIndex = clump->findPoseIndex("arm");
+        BOOST_REQUIRE_GE(handIndex, 0);
+        BOOST_REQUIRE_GE(armIndex, 0);
+        BOOST_CHECK_LT(armIndex, handIndex);
+        BOOST_CHECK_EQUAL(frames[handIndex], hand.get());
+
+        root->setTranslation(glm::vec3(10.f, 0.f, 0.f));
+
+        // Posed frames are only applied by updatePose
+        glm::mat4 raised{1.0f};
+        raised[3] = glm::vec4(1.f, 0.f, 5.f, 1.f);
+        clump->setPoseTransform(armIndex, raised);
+        BOOST_CHECK(glm::vec3(hand->getWorldTransform()[3]) ==
+                    glm::vec3(11.f, 2.f, 0.f));
+
+        clump->updatePose();
+        BOOST_CHECK(glm::vec3(hand->getWorldTransform()[3]) ==
+                    glm::vec3(11.f, 2.f, 5.f));
+        BOOST_CHECK(glm::vec3(head->getWorldTransform()[3]) ==
+                    glm::vec3(10.f, 0.f, 3.f));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
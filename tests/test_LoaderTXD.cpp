@@ -0,0 +1,60 @@
+#include <boost/test/unit_test.hpp>
+#include <gl/TextureData.hpp>
+#include <loaders/LoaderTXD.hpp>
+#include <platform/FileHandle.hpp>
+#include "test_Globals.hpp"
+
+BOOST_AUTO_TEST_SUITE(LoaderTXDTests)
+
+BOOST_AUTO_TEST_CASE(test_decode_txd, DATA_TEST_PREDICATE) {
+    auto d = Global::get().e->data->index.openFileView("landstal.txd");
+    BOOST_REQUIRE(d.data != nullptr);
+
+    TextureLoader loader;
+
+    TextureArchive decoded;
+    BOOST_REQUIRE(loader.decodeFromMemory(d, decoded));
+    BOOST_REQUIRE(!decoded.empty());
+
+    // Decoding alone must not create any GL objects
+    for (const auto& [name, texture] : decoded) {
+        BOOST_REQUIRE(texture);
+        BOOST_CHECK(!texture->isUploaded());
+        BOOST_CHECK_EQUAL(texture->getName(), 0u);
+
+        const auto image = texture->getImage();
+        BOOST_REQUIRE(image != nullptr);
+        BOOST_CHECK(image->size == texture->getSize());
+        BOOST_CHECK_GT(image->size.x, 0);
+        BOOST_CHECK_GT(image->size.y, 0);
+        BOOST_CHECK(image->format == GL_RGBA || image->format == GL_BGRA);
+
+        const std::size_t bytesPerPixel =
+            image->type == GL_UNSIGNED_SHORT_1_5_5_5_REV ? 2 : 4;
+        BOOST_CHECK_EQUAL(image->pixels.size(),
+                          static_cast<std::size_t>(image->size.x) *
+                              image->size.y * bytesPerPixel);
+        BOOST_CHECK_EQUAL(texture->getCPUSize(), image->pixels.size());
+    }
+
+    // Decoding gives the same textures as loading
+    TextureArchive loaded;
+    BOOST_REQUIRE(loader.loadFromMemory(d, loaded));
+    BOOST_CHECK_EQUAL(decoded.size(), loaded.size());
+    for (const auto& [name, texture] : loaded) {
+        auto it = decoded.find(name);
+        BOOST_REQUIRE(it != decoded.end());
+        BOOST_CHECK(it->second->getSize() == texture->getSize());
+        BOOST_CHECK(texture->isUploaded());
+        BOOST_CHECK_NE(texture->getName(), 0u);
+    }
+
+    TextureLoader::upload(decoded);
+    for (const auto& [name, texture] : decoded) {
+        BOOST_CHECK(texture->isUploaded());
+        BOOST_CHECK(texture->getImage() == nullptr);
+        BOOST_CHECK_NE(texture->getName(), 0u);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,5 +1,45 @@
 #include <boost/test/unit_test.hpp>
+#include <engine/GameData.hpp>
+#include <engine/GameWorld.hpp>
+#include <objects/CharacterObject.hpp>
+#include <objects/InstanceObject.hpp>
+#include <objects/VehicleObject.hpp>
 #include <render/GameRenderer.hpp>
+#include <render/NullRenderer.hpp>
+#include <render/RenderCapture.hpp>
+#include <render/RenderSort.hpp>
+#include "test_Globals.hpp"
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+void checkSameRenderList(const RenderList& sequential,
+                         const RenderList& threaded) {
+    BOOST_CHECK(!sequential.empty());
+    BOOST_REQUIRE_EQUAL(sequential.size(), threaded.size());
+    for (auto i = 0u; i < sequential.size(); ++i) {
+        const auto& a = sequential[i];
+        const auto& b = threaded[i];
+        BOOST_CHECK_EQUAL(a.sortKey, b.sortKey);
+        BOOST_CHECK(a.model == b.model);
+        BOOST_CHECK_EQUAL(a.dbuff, b.dbuff);
+        BOOST_CHECK_EQUAL(a.drawInfo.count, b.drawInfo.count);
+        BOOST_CHECK_EQUAL(a.drawInfo.start, b.drawInfo.start);
+        BOOST_CHECK(a.drawInfo.textures == b.drawInfo.textures);
+        BOOST_CHECK(a.drawInfo.blendMode == b.drawInfo.blendMode);
+        BOOST_CHECK(a.drawInfo.depthMode == b.drawInfo.depthMode);
+        BOOST_CHECK_EQUAL(a.drawInfo.depthWrite, b.drawInfo.depthWrite);
+        BOOST_CHECK(a.drawInfo.colour == b.drawInfo.colour);
+        BOOST_CHECK_EQUAL(a.drawInfo.ambient, b.drawInfo.ambient);
+        BOOST_CHECK_EQUAL(a.drawInfo.diffuse, b.drawInfo.diffuse);
+        BOOST_CHECK_EQUAL(a.drawInfo.visibility, b.drawInfo.visibility);
+    }
+}
+}  // namespace
 
 BOOST_AUTO_TEST_SUITE(RendererTests)
 
@@ -23,4 +63,252 @@ BOOST_AUTO_TEST_CASE(frustum_test_visible) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(frustum_test_box) {
+    ViewFrustum f(0.1f, 100.f, glm::half_pi<float>(), 1.f);
+
+    f.update(f.projection());
+
+    BOOST_CHECK(f.intersects(glm::vec3(-1.f, -1.f, -11.f),
+                             glm::vec3(1.f, 1.f, -9.f)));
+    BOOST_CHECK(!f.intersects(glm::vec3(-1.f, -1.f, 9.f),
+                              glm::vec3(1.f, 1.f, 11.f)));
+    // Straddling the near plane
+    BOOST_CHECK(f.intersects(glm::vec3(-1.f, -1.f, -1.f),
+                             glm::vec3(1.f, 1.f, 1.f)));
+}
+
+BOOST_AUTO_TEST_CASE(test_render_key_order) {
+    Renderer::DrawParameters opaque;
+    opaque.textures = {{5, 0}};
+    Renderer::DrawParameters transparent = opaque;
+    transparent.blendMode = BlendMode::BLEND_ALPHA;
+
+    // Opaque first, front to back
+    BOOST_CHECK_LT(createRenderKey(0.2f, nullptr, opaque),
+                   createRenderKey(0.8f, nullptr, opaque));
+    BOOST_CHECK_LT(createRenderKey(1.f, nullptr, opaque),
+                   createRenderKey(0.f, nullptr, transparent));
+    // Transparent back to front
+    BOOST_CHECK_GT(createRenderKey(0.2f, nullptr, transparent),
+                   createRenderKey(0.8f, nullptr, transparent));
+
+    // Opaque grouped by texture before depth
+    Renderer::DrawParameters other = opaque;
+    other.textures = {{6, 0}};
+    BOOST_CHECK_LT(createRenderKey(0.9f, nullptr, opaque),
+                   createRenderKey(0.1f, nullptr, other));
+}
+
+BOOST_AUTO_TEST_CASE(test_render_list_sort) {
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<int> texture(0, 7);
+    std::uniform_int_distribution<int> depth(0, 15);
+    std::bernoulli_distribution transparent(0.25);
+
+    RenderList list;
+    for (auto i = 0u; i < 2000; ++i) {
+        Renderer::DrawParameters dp;
+        dp.textures = {{GLuint(texture(random)), 0}};
+        dp.blendMode = transparent(random) ? BlendMode::BLEND_ALPHA
+                                           : BlendMode::BLEND_NONE;
+        // Remember where it was added to check the sort is stable
+        dp.start = i;
+        list.emplace_back(createRenderKey(depth(random) / 15.f, nullptr, dp),
+                          glm::mat4(1.f), nullptr, dp);
+    }
+
+    auto expected = list;
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const Renderer::RenderInstruction& a,
+                        const Renderer::RenderInstruction& b) {
+                         return a.sortKey < b.sortKey;
+                     });
+
+    sortRenderList(list);
+
+    BOOST_REQUIRE_EQUAL(list.size(), expected.size());
+    for (auto i = 0u; i < list.size(); ++i) {
+        BOOST_CHECK_EQUAL(list[i].sortKey, expected[i].sortKey);
+        BOOST_CHECK_EQUAL(list[i].drawInfo.start, expected[i].drawInfo.start);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_render_capture) {
+    Renderer::SceneUniformData scene;
+    scene.campos = glm::vec4(1.f, 2.f, 3.f, 0.f);
+    scene.fogEnd = 250.f;
+
+    Renderer::DrawParameters dp;
+    dp.start = 12;
+    dp.count = 36;
+    dp.textures = {{5, 0}};
+    dp.blendMode = BlendMode::BLEND_ALPHA;
+    dp.depthWrite = false;
+    dp.colour = {10, 20, 30, 40};
+
+    RenderList list;
+    list.emplace_back(createRenderKey(0.5f, nullptr, dp),
+                      glm::mat4(2.f), nullptr, dp);
+
+    std::stringstream stream;
+    RenderCapture::create(list, scene).write(stream);
+    auto capture = RenderCapture::read(stream);
+
+    BOOST_CHECK(capture.scene.campos == scene.campos);
+    BOOST_CHECK_EQUAL(capture.scene.fogEnd, 250.f);
+    BOOST_REQUIRE_EQUAL(capture.draws.size(), 1u);
+    const auto& draw = capture.draws[0];
+    BOOST_CHECK_EQUAL(draw.sortKey, list[0].sortKey);
+    BOOST_CHECK(draw.model == glm::mat4(2.f));
+    BOOST_CHECK_EQUAL(draw.buffer, 0u);
+    BOOST_CHECK_EQUAL(draw.drawInfo.start, 12u);
+    BOOST_CHECK_EQUAL(draw.drawInfo.count, 36u);
+    BOOST_CHECK(draw.drawInfo.textures == dp.textures);
+    BOOST_CHECK(draw.drawInfo.blendMode == BlendMode::BLEND_ALPHA);
+    BOOST_CHECK(!draw.drawInfo.depthWrite);
+    BOOST_CHECK(draw.drawInfo.colour == dp.colour);
+
+    std::stringstream garbage("not a capture");
+    BOOST_CHECK_THROW(RenderCapture::read(garbage), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(test_null_renderer) {
+    NullRenderer renderer;
+    DrawBuffer first, second;
+    auto program = renderer.createShader("", "");
+
+    Renderer::DrawParameters dp;
+    dp.count = 6;
+    dp.textures = {{1, 0}};
+
+    RenderList list;
+    list.emplace_back(0, glm::mat4(1.f), &first, dp);
+    list.emplace_back(0, glm::mat4(1.f), &first, dp);
+    dp.textures = {{2, 0}};
+    list.emplace_back(0, glm::mat4(1.f), &second, dp);
+
+    renderer.useProgram(program.get());
+    renderer.pushDebugGroup("Objects");
+    renderer.drawBatched(list);
+    const auto& group = renderer.popDebugGroup();
+
+    BOOST_CHECK_EQUAL(group.draws, 3u);
+    BOOST_CHECK_EQUAL(group.primitives, 18u);
+    BOOST_CHECK_EQUAL(group.buffers, 2u);
+    BOOST_CHECK_EQUAL(group.textures, 2u);
+    BOOST_CHECK_EQUAL(renderer.getDrawCount(), 3);
+
+    // Only changes of state are counted
+    const auto& stats = renderer.getStatistics();
+    BOOST_CHECK_EQUAL(stats.programs, 1u);
+    BOOST_CHECK_EQUAL(stats.states, 2u);
+    dp.blendMode = BlendMode::BLEND_ALPHA;
+    renderer.draw(glm::mat4(1.f), &second, dp);
+    BOOST_CHECK_EQUAL(stats.states, 3u);
+    BOOST_CHECK_EQUAL(stats.buffers, 2u);
+    // The object data of a batch is uploaded at once
+    BOOST_CHECK_EQUAL(stats.uploads, 2u);
+
+    renderer.swap();
+    BOOST_CHECK_EQUAL(renderer.getDrawCount(), 0);
+    BOOST_CHECK_EQUAL(stats.draws, 4u);
+
+    // Identical opaque draws are instanced like OpenGLRenderer does
+    auto instancedProgram = renderer.createShader("", "");
+    renderer.setInstancedProgram(program.get(), instancedProgram.get());
+    renderer.resetStatistics();
+    renderer.drawBatched(list);
+    BOOST_CHECK_EQUAL(stats.draws, 2u);
+    BOOST_CHECK_EQUAL(stats.primitives, 18u);
+    BOOST_CHECK_EQUAL(stats.programs, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(test_render_list_threads, DATA_TEST_PREDICATE) {
+    auto& d = Global::get().d;
+    auto& e = Global::get().e;
+    GameRenderer renderer(&Global::get().log, d);
+
+    // Enough instances in front of the camera to fill several chunks
+    std::vector<InstanceObject*> instances;
+    for (int x = 0; x < 24; ++x) {
+        for (int y = 0; y < 24; ++y) {
+            glm::vec3 position(20.f + x * 4.f, y * 4.f - 46.f, 0.f);
+            instances.push_back(e->createInstance(1337, position));
+            d->streamer.request(1337, position);
+        }
+    }
+    d->streamer.finish();
+    for (auto instance : instances) {
+        instance->tick(0.f);
+    }
+
+    ViewCamera camera;
+    camera.frustum.update(camera.frustum.projection() * camera.getView());
+
+    renderer.setRenderListThreads(1);
+    auto sequential = renderer.createObjectRenderList(e, camera, 1.f);
+    renderer.setRenderListThreads(4);
+    auto threaded = renderer.createObjectRenderList(e, camera, 1.f);
+
+    checkSameRenderList(sequential, threaded);
+
+    for (auto instance : instances) {
+        e->destroyObject(instance);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_render_list_threads_characters,
+                     DATA_TEST_PREDICATE) {
+    auto& e = Global::get().e;
+    GameRenderer renderer(&Global::get().log, Global::get().d);
+
+    // Characters on foot and in vehicles, and vehicles at both levels of
+    // detail, to fill several chunks
+    std::vector<GameObject*> objects;
+    for (int x = 0; x < 20; ++x) {
+        for (int y = 0; y < 15; ++y) {
+            glm::vec3 position(10.f + x * 8.f, y * 8.f - 56.f, 0.f);
+            auto vehicle = e->createVehicle(90u, position,
+                                            glm::quat{1.0f, 0.0f, 0.0f, 0.0f});
+            BOOST_REQUIRE(vehicle != nullptr);
+            auto driver = e->createPedestrian(1, position);
+            BOOST_REQUIRE(driver != nullptr);
+            driver->enterVehicle(vehicle, 0);
+            auto walker =
+                e->createPedestrian(1, position + glm::vec3(0.f, 4.f, 0.f));
+            BOOST_REQUIRE(walker != nullptr);
+            objects.insert(objects.end(), {vehicle, driver, walker});
+        }
+    }
+
+    ViewCamera camera;
+    camera.frustum.update(camera.frustum.projection() * camera.getView());
+
+    renderer.setRenderListThreads(1);
+    auto sequential = renderer.createObjectRenderList(e, camera, 1.f);
+    renderer.setRenderListThreads(4);
+    auto threaded = renderer.createObjectRenderList(e, camera, 1.f);
+
+    checkSameRenderList(sequential, threaded);
+
+    // Drivers are drawn in their seats
+    auto driver = static_cast<CharacterObject*>(objects[1]);
+    auto vehicle = driver->getCurrentVehicle();
+    BOOST_REQUIRE(vehicle != nullptr);
+    auto seat = vehicle->getClump()->getFrame()->getWorldTransform() *
+                glm::vec4(vehicle->info->seats[0].offset, 1.f);
+    auto drawn = driver->getClump()->getFrame()->getWorldTransform()[3];
+    BOOST_CHECK_SMALL(glm::distance(glm::vec3(seat), glm::vec3(drawn)),
+                      0.001f);
+
+    for (auto object : objects) {
+        if (object->type() == GameObject::Character) {
+            static_cast<CharacterObject*>(object)->enterVehicle(nullptr, 0);
+        }
+    }
+    for (auto object : objects) {
+        e->destroyObject(object);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,12 @@
 #include <boost/test/unit_test.hpp>
+#include <engine/GameState.hpp>
 #include <script/SCMFile.hpp>
 #include <script/ScriptMachine.hpp>
+#include <script/ScriptModule.hpp>
+#include "test_Globals.hpp"
+
+#include <sstream>
+#include <vector>
 
 SCMByte data[] = {0x02, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
                   0x01, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -8,6 +14,43 @@ SCMByte data[] = {0x02, 0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
                   0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
                   0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
+namespace {
+void test_add(ScriptInt& var, const ScriptInt value) {
+    var += value;
+}
+
+void test_wait(const ScriptArguments& args, const ScriptInt time) {
+    args.getThread()->wakeCounter = time > 0 ? time : -1;
+}
+
+void test_jump(const ScriptArguments& args, const ScriptLabel label) {
+    args.getThread()->programCounter = label;
+}
+
+ScriptModule& getTestModule() {
+    static ScriptModule module("Test");
+    static bool bound = false;
+    if (!bound) {
+        module.bind<test_add>(0x0010, 2, "%1d% += %2d%");
+        module.bind<test_wait>(0x0011, 1, "wait %1d% ms");
+        module.bind<test_jump>(0x0012, 1, "goto %1p%");
+        bound = true;
+    }
+    return module;
+}
+
+/// Header from data with code appended, running from the end of the header
+SCMFile loadProgram(const std::vector<SCMByte>& code) {
+    std::vector<SCMByte> bytes(std::begin(data), std::end(data));
+    bytes.insert(bytes.end(), code.begin(), code.end());
+    SCMFile f;
+    f.loadFile(bytes.data(), bytes.size());
+    return f;
+}
+
+constexpr SCMAddress kProgramStart = sizeof(data);
+}  // namespace
+
 BOOST_AUTO_TEST_SUITE(ScriptMachineTests)
 
 BOOST_AUTO_TEST_CASE(scmfile_test) {
@@ -19,4 +62,106 @@ BOOST_AUTO_TEST_CASE(scmfile_test) {
     BOOST_CHECK_EQUAL(f.getCodeSection(), 0x28);
 }
 
+BOOST_AUTO_TEST_CASE(test_execute_loop, DATA_TEST_PREDICATE) {
+    // start: add global 4, 5; add local 1, 2; wait 0; jump start
+    auto f = loadProgram({0x10, 0x00, 0x02, 0x04, 0x00, 0x04, 0x05,
+                          0x10, 0x00, 0x03, 0x01, 0x00, 0x04, 0x02,
+                          0x11, 0x00, 0x04, 0x00,
+                          0x12, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00});
+    GameState state;
+    state.world = Global::get().e;
+    ScriptMachine vm(&state, f, &getTestModule());
+    vm.startThread(kProgramStart);
+    vm.startThread(kProgramStart);
+
+    // Each thread runs the loop once per tick, the second time from the
+    // decoded instructions
+    for (int i = 0; i < 3; ++i) {
+        vm.execute(0.f);
+    }
+
+    auto global = reinterpret_cast<ScriptInt*>(vm.getGlobals() + 4);
+    BOOST_CHECK_EQUAL(*global, 30);
+    for (auto& thread : vm.getThreads()) {
+        auto local = reinterpret_cast<ScriptInt*>(thread.locals.data() +
+                                                  SCM_VARIABLE_SIZE);
+        BOOST_CHECK_EQUAL(*local, 6);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_execute_sleep, DATA_TEST_PREDICATE) {
+    // start: add global 4, 1; wait 50; jump start
+    auto f = loadProgram({0x10, 0x00, 0x02, 0x04, 0x00, 0x04, 0x01,
+                          0x11, 0x00, 0x04, 0x32,
+                          0x12, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00});
+    GameState state;
+    state.world = Global::get().e;
+    ScriptMachine vm(&state, f, &getTestModule());
+    vm.startThread(kProgramStart);
+
+    auto global = reinterpret_cast<ScriptInt*>(vm.getGlobals() + 4);
+
+    // The thread wakes on the first tick ending at least 50ms after the
+    // one it started waiting in
+    const int expected[] = {1, 1, 1, 2, 2, 2, 3};
+    for (int count : expected) {
+        vm.execute(0.02f);
+        BOOST_CHECK_EQUAL(*global, count);
+    }
+
+    // The timers also count the time spent sleeping
+    auto& thread = vm.getThreads().front();
+    auto timer = reinterpret_cast<ScriptInt*>(
+        thread.locals.data() + SCM_TIMER_LOCAL_A * SCM_VARIABLE_SIZE);
+    BOOST_CHECK_EQUAL(*timer, 120);
+}
+
+BOOST_AUTO_TEST_CASE(test_execute_profile, DATA_TEST_PREDICATE) {
+    // start: add global 4, 5; add local 1, 2; wait 0; jump start
+    auto f = loadProgram({0x10, 0x00, 0x02, 0x04, 0x00, 0x04, 0x05,
+                          0x10, 0x00, 0x03, 0x01, 0x00, 0x04, 0x02,
+                          0x11, 0x00, 0x04, 0x00,
+                          0x12, 0x00, 0x01, 0x30, 0x00, 0x00, 0x00});
+    GameState state;
+    state.world = Global::get().e;
+    ScriptMachine vm(&state, f, &getTestModule());
+    BOOST_CHECK(vm.getProfiler() == nullptr);
+    vm.setProfiling(true);
+    vm.startThread(kProgramStart);
+    vm.startThread(kProgramStart);
+
+    for (int i = 0; i < 3; ++i) {
+        vm.execute(0.f);
+    }
+
+    auto profiler = vm.getProfiler();
+    BOOST_REQUIRE(profiler != nullptr);
+
+    auto opcodes = profiler->getOpcodes();
+    BOOST_REQUIRE_EQUAL(opcodes.size(), 3);
+    for (const auto& entry : opcodes) {
+        BOOST_CHECK_EQUAL(entry.counter.calls, entry.opcode == 0x10 ? 12 : 6);
+        if (entry.opcode == 0x10) {
+            BOOST_CHECK_EQUAL(entry.signature, "%1d% += %2d%");
+        }
+    }
+
+    // Both threads have the default name
+    auto threads = profiler->getThreads();
+    BOOST_REQUIRE_EQUAL(threads.size(), 1);
+    BOOST_CHECK_EQUAL(threads[0].name, "THREAD");
+    BOOST_CHECK_EQUAL(threads[0].counter.calls, 6);
+
+    std::stringstream csv;
+    profiler->writeCSV(csv);
+    BOOST_CHECK(csv.str().find("0010,\"%1d% += %2d%\",12,") !=
+                std::string::npos);
+    BOOST_CHECK(csv.str().find("0011,\"wait %1d% ms\",6,") !=
+                std::string::npos);
+    BOOST_CHECK(csv.str().find("\"THREAD\",6,") != std::string::npos);
+
+    vm.setProfiling(false);
+    BOOST_CHECK(vm.getProfiler() == nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -9,4 +9,104 @@ BOOST_AUTO_TEST_CASE(test_light_data) {
     BOOST_CHECK_EQUAL(fx->getType(), Light);
 }
 
+BOOST_AUTO_TEST_CASE(test_particle_pool_handles) {
+    ParticlePool pool;
+
+    ParticleFX particle;
+    particle.position = {1.f, 0.f, 0.f};
+    auto a = pool.create(particle);
+    particle.position = {2.f, 0.f, 0.f};
+    auto b = pool.create(particle);
+    particle.position = {3.f, 0.f, 0.f};
+    auto c = pool.create(particle);
+    BOOST_CHECK_EQUAL(pool.size(), 3);
+
+    // Destroying a particle moves another, without changing its handle
+    pool.destroy(a);
+    BOOST_CHECK_EQUAL(pool.size(), 2);
+    BOOST_CHECK(!pool.isAlive(a));
+    BOOST_CHECK(pool.isAlive(b));
+    BOOST_CHECK(pool.isAlive(c));
+    BOOST_CHECK(pool.get(b).position == glm::vec3(2.f, 0.f, 0.f));
+    BOOST_CHECK(pool.get(c).position == glm::vec3(3.f, 0.f, 0.f));
+
+    // A reused slot doesn't revive the old handle
+    auto d = pool.create(particle);
+    BOOST_CHECK(d != a);
+    BOOST_CHECK(!pool.isAlive(a));
+    pool.destroy(a);
+    BOOST_CHECK_EQUAL(pool.size(), 3);
+
+    pool.setColour(d, glm::vec4(0.5f));
+    BOOST_CHECK(pool.get(d).colour == glm::vec4(0.5f));
+}
+
+BOOST_AUTO_TEST_CASE(test_particle_pool_expiry) {
+    ParticlePool pool;
+
+    ParticleFX particle;
+    particle.starttime = 1.f;
+    particle.lifetime = 0.5f;
+    auto shortLived = pool.create(particle);
+    particle.lifetime = 2.f;
+    auto longLived = pool.create(particle);
+    particle.lifetime = -1.f;
+    auto forever = pool.create(particle);
+
+    pool.removeExpired(1.4f);
+    BOOST_CHECK_EQUAL(pool.size(), 3);
+
+    pool.removeExpired(1.5f);
+    BOOST_CHECK(!pool.isAlive(shortLived));
+    BOOST_CHECK(pool.isAlive(longLived));
+
+    pool.removeExpired(100.f);
+    BOOST_CHECK(!pool.isAlive(longLived));
+    BOOST_CHECK(pool.isAlive(forever));
+    BOOST_CHECK_EQUAL(pool.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_particle_billboards) {
+    TextureData smoke(0, {1, 1}, false);
+    TextureData spark(0, {1, 1}, false);
+    ParticlePool pool;
+
+    ParticleFX particle;
+    particle.orientation = ParticleFX::Camera;
+    for (auto i = 0; i < 5; ++i) {
+        particle.texture = (i % 2) ? &smoke : &spark;
+        particle.position = {0.f, 10.f + static_cast<float>(i), 0.f};
+        pool.create(particle);
+    }
+    // Not drawn
+    particle.size = {0.f, 0.f};
+    pool.create(particle);
+    particle.size = {1.f, 1.f};
+    particle.texture = nullptr;
+    pool.create(particle);
+
+    std::vector<ParticleVertex> vertices;
+    std::vector<ParticleBatch> batches;
+    pool.buildBillboards({0.f, 0.f, 0.f}, {0.f, 1.f, 0.f}, vertices, batches);
+
+    BOOST_REQUIRE_EQUAL(batches.size(), 2);
+    BOOST_CHECK_EQUAL(vertices.size(), 5 * 6);
+    BOOST_CHECK_NE(batches[0].texture, batches[1].texture);
+    BOOST_CHECK_EQUAL(batches[0].start, 0);
+    BOOST_CHECK_EQUAL(batches[1].start, batches[0].count);
+    BOOST_CHECK_EQUAL(batches[0].count + batches[1].count, vertices.size());
+
+    // The quad is centred on the particle, facing the camera
+    glm::vec3 centre{};
+    for (auto i = 0u; i < 6; ++i) {
+        centre += vertices[i].position;
+    }
+    centre /= 6.f;
+    BOOST_CHECK_SMALL(centre.x, 0.001f);
+    BOOST_CHECK_SMALL(centre.z, 0.001f);
+    for (auto i = 0u; i < 6; ++i) {
+        BOOST_CHECK_SMALL(vertices[i].position.y - centre.y, 0.001f);
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()